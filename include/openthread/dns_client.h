@@ -781,6 +781,113 @@ otError otDnsRecordResponseGetQueryName(const otDnsRecordResponse *aResponse,
 otError otDnsRecordResponseGetRecordInfo(const otDnsRecordResponse *aResponse,
                                          uint16_t                   aIndex,
                                          otDnsRecordInfo           *aRecordInfo);
+
+/**
+ * Represents the counters of the DNS client response cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ */
+typedef struct otDnsCacheCounters
+{
+    uint32_t mHits;       ///< Number of queries answered from the cache.
+    uint32_t mMisses;     ///< Number of queries not found in the cache (sent to the server).
+    uint32_t mInsertions; ///< Number of responses added to the cache.
+    uint32_t mEvictions;  ///< Number of unexpired responses evicted to stay within the cache limits.
+} otDnsCacheCounters;
+
+/**
+ * Gets the counters of the DNS client response cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the DNS client cache counters.
+ */
+const otDnsCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the counters of the DNS client response cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ */
+void otDnsClientResetCacheCounters(otInstance *aInstance);
+
+/**
+ * Removes all responses from the DNS client response cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ */
+void otDnsClientClearCache(otInstance *aInstance);
+
+/**
+ * Sets the additional DNS servers to which queries are sent in parallel.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE`.
+ *
+ * A UDP query sent to the server from the default query config is also sent to each additional server using the same
+ * message ID. The first response received from any of the servers is used to finalize the query.
+ *
+ * @param[in]  aInstance    A pointer to an OpenThread instance.
+ * @param[in]  aServers     An array of server socket addresses. Can be NULL if @p aNumServers is zero.
+ * @param[in]  aNumServers  The number of entries in @p aServers. Zero clears the list.
+ *
+ * @retval OT_ERROR_NONE          Successfully set the additional servers.
+ * @retval OT_ERROR_INVALID_ARGS  @p aNumServers exceeds `OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_MAX_SERVERS` or
+ *                                a server address is unspecified.
+ */
+otError otDnsClientSetParallelServers(otInstance *aInstance, const otSockAddr *aServers, uint8_t aNumServers);
+
+#define OT_DNS_LATENCY_HISTOGRAM_NUM_BUCKETS 8  ///< Number of buckets in `otDnsServerLatencyStats` histogram.
+#define OT_DNS_LATENCY_HISTOGRAM_FIRST_LIMIT 32 ///< Upper limit (in msec) of the first latency histogram bucket.
+
+/**
+ * Represents the response latency statistics of a DNS server.
+ *
+ * The latency is measured from sending a query to receiving the response which completes it. Queries which needed
+ * retransmissions are not included since the response cannot be associated with a specific transmission.
+ *
+ * Bucket `i` of `mHistogram` counts responses with latency below `OT_DNS_LATENCY_HISTOGRAM_FIRST_LIMIT << i` msec
+ * (and at or above the limit of bucket `i - 1`). The last bucket counts all responses above the previous limit.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE`.
+ */
+typedef struct otDnsServerLatencyStats
+{
+    otSockAddr mServerSockAddr;                                  ///< The server socket address.
+    uint32_t   mNumResponses;                                    ///< Number of responses measured.
+    uint32_t   mMinLatency;                                      ///< Minimum latency (in msec).
+    uint32_t   mMaxLatency;                                      ///< Maximum latency (in msec).
+    uint32_t   mHistogram[OT_DNS_LATENCY_HISTOGRAM_NUM_BUCKETS]; ///< Latency histogram.
+} otDnsServerLatencyStats;
+
+/**
+ * Gets the response latency statistics of a DNS server.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aIndex     The index of the server entry to get (zero for the first).
+ * @param[out] aStats     A pointer to return the latency statistics.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the statistics.
+ * @retval OT_ERROR_NOT_FOUND  No server entry at @p aIndex.
+ */
+otError otDnsClientGetServerLatencyStats(otInstance *aInstance, uint8_t aIndex, otDnsServerLatencyStats *aStats);
+
+/**
+ * Resets the response latency statistics of all DNS servers.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ */
+void otDnsClientResetServerLatencyStats(otInstance *aInstance);
+
 /**
  * @}
  */
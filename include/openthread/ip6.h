@@ -948,6 +948,7 @@ typedef struct otBorderRoutingCounters
     uint32_t          mRsRx;              ///< The number of received RS packets.
     uint32_t          mRsTxSuccess;       ///< The number of RS packets successfully transmitted.
     uint32_t          mRsTxFailure;       ///< The number of RS packets failed to transmit.
+    uint32_t          mNetDataUpdates;    ///< The number of changes to Network Data entries published by the BR.
 } otBorderRoutingCounters;
 
 /**
@@ -76,6 +76,7 @@ enum
     OT_SETTINGS_KEY_BR_ON_LINK_PREFIXES  = 0x0010, ///< BR local on-link prefixes.
     OT_SETTINGS_KEY_BORDER_AGENT_ID      = 0x0011, ///< Unique Border Agent/Router ID.
     OT_SETTINGS_KEY_TCAT_COMMR_CERT      = 0x0012, ///< TCAT Commissioner certificate
+    OT_SETTINGS_KEY_SRP_SERVER_HOSTS     = 0x0013, ///< The SRP server registered hosts and services.
 
     // Deprecated and reserved key values:
     //
@@ -244,8 +244,9 @@ struct otTcpEndpoint
         uint64_t mAlign;
     } mTcb;
 
-    struct otTcpEndpoint *mNext;    ///< A pointer to the next TCP endpoint (internal use only)
-    void                 *mContext; ///< A pointer to application-specific context
+    struct otTcpEndpoint *mNext;         ///< A pointer to the next TCP endpoint (internal use only)
+    struct otTcpEndpoint *mNextInBucket; ///< A pointer to the next TCP endpoint in hash bucket (internal use only)
+    void                 *mContext;      ///< A pointer to application-specific context
 
     otTcpEstablished      mEstablishedCallback;      ///< "Established" callback function
     otTcpSendDone         mSendDoneCallback;         ///< "Send done" callback function
@@ -258,7 +259,8 @@ struct otTcpEndpoint
     otLinkedBuffer mReceiveLinks[2];
     otSockAddr     mSockAddr;
 
-    uint8_t mPendingCallbacks;
+    uint16_t mBucket;
+    uint8_t  mPendingCallbacks;
 };
 
 /**
@@ -1130,6 +1130,45 @@ otError otThreadWakeup(otInstance         *aInstance,
                        otWakeupCallback    aCallback,
                        void               *aCallbackContext);
 
+#define OT_TMF_PEER_RTT_ITERATOR_INIT 0 ///< Initializer for `otTmfPeerRttIterator`.
+
+typedef uint16_t otTmfPeerRttIterator; ///< Used to iterate through the TMF peer RTT table.
+
+/**
+ * Represents the adaptive retransmission timeout (RTO) state and counters of a TMF peer.
+ */
+typedef struct otTmfPeerRttInfo
+{
+    otIp6Address mPeerAddress;      ///< The peer IPv6 address.
+    uint32_t     mRto;              ///< The current (overall) RTO estimate (in msec).
+    uint32_t     mStrongRtt;        ///< Smoothed RTT from strong samples (in msec).
+    uint32_t     mStrongRttVar;     ///< RTT variation from strong samples (in msec).
+    uint32_t     mWeakRtt;          ///< Smoothed RTT from weak samples (in msec).
+    uint32_t     mWeakRttVar;       ///< RTT variation from weak samples (in msec).
+    uint16_t     mNumStrongSamples; ///< Number of strong RTT samples (acknowledged with no retransmission).
+    uint16_t     mNumWeakSamples;   ///< Number of weak RTT samples (acknowledged after one or two retransmissions).
+    uint16_t     mNumTimeouts;      ///< Number of confirmable requests never acknowledged.
+    uint16_t     mNumDeferred;      ///< Number of requests held back as NSTART exchanges were outstanding.
+} otTmfPeerRttInfo;
+
+/**
+ * Gets the next entry in the TMF peer RTT table.
+ *
+ * Requires `OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE`.
+ *
+ * When congestion control is enabled, the retransmission timeout of confirmable TMF requests is estimated per peer
+ * (CoCoA-style) and the number of outstanding exchanges with each peer is limited (NSTART).
+ *
+ * @param[in]      aInstance  A pointer to an OpenThread instance.
+ * @param[in,out]  aIterator  A pointer to the iterator context. To get the first entry it should be set to
+ *                            OT_TMF_PEER_RTT_ITERATOR_INIT.
+ * @param[out]     aInfo      A pointer to output the peer RTT information.
+ *
+ * @retval OT_ERROR_NONE       Successfully found the next entry in the table.
+ * @retval OT_ERROR_NOT_FOUND  No subsequent entry exists in the table.
+ */
+otError otThreadGetNextTmfPeerRttInfo(otInstance *aInstance, otTmfPeerRttIterator *aIterator, otTmfPeerRttInfo *aInfo);
+
 /**
  * @}
  */
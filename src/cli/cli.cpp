@@ -2176,6 +2176,7 @@ void Interpreter::OutputBorderRouterCounters(void)
     OutputLine("RS Rx: %lu", ToUlong(brCounters->mRsRx));
     OutputLine("RS TxSuccess: %lu", ToUlong(brCounters->mRsTxSuccess));
     OutputLine("RS TxFailed: %lu", ToUlong(brCounters->mRsTxFailure));
+    OutputLine("NetData Updates: %lu", ToUlong(brCounters->mNetDataUpdates));
 }
 #endif // OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
 
@@ -6670,6 +6671,43 @@ template <> otError Interpreter::Process<Cmd("timeinqueue")>(Arg aArgs[])
 }
 #endif // OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+/**
+ * @cli tmfpeerrtt
+ * @code
+ * tmfpeerrtt
+ * fdde:ad00:beef:0:0:ff:fe00:fc00 rto=620 strongRtt=96 strongRttVar=18 weakRtt=0 weakRttVar=0 strongSamples=12
+ * weakSamples=0 timeouts=0 deferred=1
+ * Done
+ * @endcode
+ * @par
+ * Returns the per-peer RTT estimates used for confirmable TMF requests, along with the number of requests which were
+ * never acknowledged and the number held back as NSTART exchanges were outstanding.
+ * @sa otThreadGetNextTmfPeerRttInfo
+ */
+template <> otError Interpreter::Process<Cmd("tmfpeerrtt")>(Arg aArgs[])
+{
+    otError              error    = OT_ERROR_NONE;
+    otTmfPeerRttIterator iterator = OT_TMF_PEER_RTT_ITERATOR_INIT;
+    otTmfPeerRttInfo     info;
+
+    VerifyOrExit(aArgs[0].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+    while (otThreadGetNextTmfPeerRttInfo(GetInstancePtr(), &iterator, &info) == OT_ERROR_NONE)
+    {
+        OutputIp6Address(info.mPeerAddress);
+        OutputFormat(" rto=%lu strongRtt=%lu strongRttVar=%lu", ToUlong(info.mRto), ToUlong(info.mStrongRtt),
+                     ToUlong(info.mStrongRttVar));
+        OutputFormat(" weakRtt=%lu weakRttVar=%lu", ToUlong(info.mWeakRtt), ToUlong(info.mWeakRttVar));
+        OutputLine(" strongSamples=%u weakSamples=%u timeouts=%u deferred=%u", info.mNumStrongSamples,
+                   info.mNumWeakSamples, info.mNumTimeouts, info.mNumDeferred);
+    }
+
+exit:
+    return error;
+}
+#endif
+
 template <> otError Interpreter::Process<Cmd("dataset")>(Arg aArgs[]) { return mDataset.Process(aArgs); }
 
 /**
@@ -8771,6 +8809,9 @@ otError Interpreter::ProcessCommand(Arg aArgs[])
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
         CmdEntry("timeinqueue"),
 #endif
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        CmdEntry("tmfpeerrtt"),
+#endif
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
         CmdEntry("trel"),
 #endif
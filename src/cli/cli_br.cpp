@@ -1189,6 +1189,7 @@ exit:
  * RS Rx: 0
  * RS TxSuccess: 2
  * RS TxFailed: 0
+ * NetData Updates: 1
  * Done
  * @endcode
  * @par api_copy
@@ -749,6 +749,125 @@ const char *Dns::RecordSectionToString(otDnsRecordSection aSection)
 }
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_ARBITRARY_RECORD_QUERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+
+template <> otError Dns::Process<Cmd("parallel")>(Arg aArgs[])
+{
+    /**
+     * @cli dns parallel
+     * @code
+     * dns parallel fd00::1 fd00::2
+     * Done
+     * @endcode
+     * @code
+     * dns parallel clear
+     * Done
+     * @endcode
+     * @cparam dns parallel @ca{clear} | @ca{server-address} [@ca{server-address}]
+     * @par
+     * Sets the additional DNS servers to which UDP queries to the default server are also sent, or clears them.
+     * The port of the default server is used for the additional servers.
+     * @par
+     * `OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE` is required.
+     * @sa otDnsClientSetParallelServers
+     */
+
+    otError    error      = OT_ERROR_NONE;
+    uint8_t    numServers = 0;
+    otSockAddr servers[OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_MAX_SERVERS];
+
+    VerifyOrExit(!aArgs[0].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+    if (aArgs[0] == "clear")
+    {
+        VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+    }
+    else
+    {
+        for (; !aArgs[numServers].IsEmpty(); numServers++)
+        {
+            VerifyOrExit(numServers < OT_ARRAY_LENGTH(servers), error = OT_ERROR_INVALID_ARGS);
+
+            ClearAllBytes(servers[numServers]);
+            SuccessOrExit(error = aArgs[numServers].ParseAsIp6Address(servers[numServers].mAddress));
+        }
+    }
+
+    error = otDnsClientSetParallelServers(GetInstancePtr(), servers, numServers);
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+
+template <> otError Dns::Process<Cmd("latency")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    /**
+     * @cli dns latency
+     * @code
+     * dns latency
+     * [fd00:0:0:0:0:0:0:1]:53
+     *     Responses: 3, Min: 12 ms, Max: 70 ms
+     *     Histogram: 1 1 1 0 0 0 0 0
+     * Done
+     * @endcode
+     * @par
+     * Outputs the response latency statistics of each DNS server. Bucket `i` of the histogram counts the responses
+     * with a latency below `32 << i` msec, the last bucket counts all the remaining responses.
+     * @par
+     * `OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE` is required.
+     * @sa otDnsClientGetServerLatencyStats
+     */
+    if (aArgs[0].IsEmpty())
+    {
+        otDnsServerLatencyStats stats;
+
+        for (uint8_t index = 0; otDnsClientGetServerLatencyStats(GetInstancePtr(), index, &stats) == OT_ERROR_NONE;
+             index++)
+        {
+            OutputSockAddrLine(stats.mServerSockAddr);
+            OutputLine(kIndentSize, "Responses: %lu, Min: %lu ms, Max: %lu ms", ToUlong(stats.mNumResponses),
+                       ToUlong(stats.mMinLatency), ToUlong(stats.mMaxLatency));
+            OutputFormat(kIndentSize, "Histogram:");
+
+            for (uint32_t count : stats.mHistogram)
+            {
+                OutputFormat(" %lu", ToUlong(count));
+            }
+
+            OutputNewLine();
+        }
+    }
+    /**
+     * @cli dns latency reset
+     * @code
+     * dns latency reset
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otDnsClientResetServerLatencyStats
+     */
+    else if (aArgs[0] == "reset")
+    {
+        VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+        otDnsClientResetServerLatencyStats(GetInstancePtr());
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_COMMAND;
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE
 
 #if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
@@ -812,6 +931,12 @@ otError Dns::Process(Arg aArgs[])
 #endif
 #if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE
         CmdEntry("config"),
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+        CmdEntry("latency"),
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+        CmdEntry("parallel"),
+#endif
 #if OPENTHREAD_CONFIG_DNS_CLIENT_ARBITRARY_RECORD_QUERY_ENABLE
         CmdEntry("query"),
 #endif
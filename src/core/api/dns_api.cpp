@@ -293,4 +293,43 @@ otError otDnsRecordResponseGetRecordInfo(const otDnsRecordResponse *aResponse,
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_ARBITRARY_RECORD_QUERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+const otDnsCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<Dns::Client>().GetCacheCounters();
+}
+
+void otDnsClientResetCacheCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<Dns::Client>().ResetCacheCounters();
+}
+
+void otDnsClientClearCache(otInstance *aInstance) { AsCoreType(aInstance).Get<Dns::Client>().ClearCache(); }
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+
+otError otDnsClientSetParallelServers(otInstance *aInstance, const otSockAddr *aServers, uint8_t aNumServers)
+{
+    return AsCoreType(aInstance).Get<Dns::Client>().SetParallelServers(AsCoreTypePtr(aServers), aNumServers);
+}
+
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+
+otError otDnsClientGetServerLatencyStats(otInstance *aInstance, uint8_t aIndex, otDnsServerLatencyStats *aStats)
+{
+    return AsCoreType(aInstance).Get<Dns::Client>().GetServerLatencyStats(aIndex, AsCoreType(aStats));
+}
+
+void otDnsClientResetServerLatencyStats(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<Dns::Client>().ResetServerLatencyStats();
+}
+
+#endif
+
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE
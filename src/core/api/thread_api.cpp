@@ -496,6 +496,14 @@ otError otThreadWakeup(otInstance         *aInstance,
 }
 #endif
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+otError otThreadGetNextTmfPeerRttInfo(otInstance *aInstance, otTmfPeerRttIterator *aIterator, otTmfPeerRttInfo *aInfo)
+{
+    return AsCoreType(aInstance).Get<Tmf::Agent>().GetCongestionControl().GetNextPeerInfo(*aIterator,
+                                                                                          AsCoreType(aInfo));
+}
+#endif
+
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
 void otConvertDurationInSecondsToString(uint32_t aDuration, char *aBuffer, uint16_t aSize)
 {
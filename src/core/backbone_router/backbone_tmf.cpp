@@ -62,19 +62,18 @@ exit:
     return error;
 }
 
-bool BackboneTmfAgent::HandleResource(CoapBase &aCoapBase, const char *aUriPath, ot::Coap::Msg &aMsg)
+bool BackboneTmfAgent::HandleResource(CoapBase &aCoapBase, Uri aUri, ot::Coap::Msg &aMsg)
 {
-    return static_cast<BackboneTmfAgent &>(aCoapBase).HandleResource(aUriPath, aMsg);
+    return static_cast<BackboneTmfAgent &>(aCoapBase).HandleResource(aUri, aMsg);
 }
 
-bool BackboneTmfAgent::HandleResource(const char *aUriPath, ot::Coap::Msg &aMsg)
+bool BackboneTmfAgent::HandleResource(Uri aUri, ot::Coap::Msg &aMsg)
 {
     OT_UNUSED_VARIABLE(aMsg);
 
     bool didHandle = true;
-    Uri  uri       = UriFromPath(aUriPath);
 
-    if ((uri != kUriUnknown) && !aMsg.IsPostRequest())
+    if ((aUri != kUriUnknown) && !aMsg.IsPostRequest())
     {
         IgnoreError(SendAckResponse(aMsg, ot::Coap::kCodeMethodNotAllowed));
         ExitNow();
@@ -85,7 +84,7 @@ bool BackboneTmfAgent::HandleResource(const char *aUriPath, ot::Coap::Msg &aMsg)
         Get<Type>().HandleTmf<kUri>(aMsg); \
         break
 
-    switch (uri)
+    switch (aUri)
     {
     default:
         didHandle = false;
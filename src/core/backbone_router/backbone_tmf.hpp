@@ -90,8 +90,8 @@ public:
     void UnsubscribeMulticast(const Ip6::Address &aAddress);
 
 private:
-    static bool  HandleResource(CoapBase &aCoapBase, const char *aUriPath, ot::Coap::Msg &aMsg);
-    bool         HandleResource(const char *aUriPath, ot::Coap::Msg &aMsg);
+    static bool  HandleResource(CoapBase &aCoapBase, Uri aUri, ot::Coap::Msg &aMsg);
+    bool         HandleResource(Uri aUri, ot::Coap::Msg &aMsg);
     void         LogError(const char *aText, const Ip6::Address &aAddress, Error aError) const;
     static Error Filter(void *aContext, const ot::Coap::Msg &aRxMsg);
     Error        Filter(const ot::Coap::Msg &aRxMsg) const;
@@ -1100,6 +1100,7 @@ Error RoutingManager::OmrPrefixManager::AddOrUpdateLocalInNetData(void)
 
     SuccessOrExit(error = Get<NetworkData::Local>().AddOnMeshPrefix(config));
     Get<NetworkData::Notifier>().HandleServerDataUpdated();
+    Get<Ip6::Ip6>().GetBorderRoutingCounters().mNetDataUpdates++;
 
     LogInfo("%s %s in NetData", !IsLocalAddedInNetData() ? "Added" : "Updated", LocalToString().AsCString());
 
@@ -1115,6 +1116,7 @@ void RoutingManager::OmrPrefixManager::RemoveLocalFromNetData(void)
     case kAdded:
         IgnoreError(Get<NetworkData::Local>().RemoveOnMeshPrefix(mLocalPrefix.GetPrefix()));
         Get<NetworkData::Notifier>().HandleServerDataUpdated();
+        Get<Ip6::Ip6>().GetBorderRoutingCounters().mNetDataUpdates++;
         LogInfo("Removed %s from NetData", LocalToString().AsCString());
         mLocalInNetDataState = kNotAdded;
         break;
@@ -2052,10 +2054,15 @@ const otIp6Prefix RoutingManager::RoutePublisher::kUlaPrefix = {
 RoutingManager::RoutePublisher::RoutePublisher(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mState(kDoNotPublish)
+    , mPublishedState(kDoNotPublish)
     , mPreference(NetworkData::kRoutePreferenceMedium)
+    , mPublishedPreference(NetworkData::kRoutePreferenceMedium)
     , mUserSetPreference(false)
     , mAdvPioFlag(false)
+    , mPublishedAdvPioFlag(false)
+    , mLastUpdateTime(TimerMilli::GetNow() - kMinUpdateInterval)
     , mTimer(aInstance)
+    , mUpdateTimer(aInstance)
 {
 }
 
@@ -2084,8 +2091,8 @@ exit:
     if (newState != mState)
     {
         LogInfo("RoutePublisher state: %s -> %s", StateToString(mState), StateToString(newState));
-        UpdatePublishedRoute(newState);
-        Get<RoutingManager>().mOmrPrefixManager.UpdateDefaultRouteFlag(newState == kPublishDefault);
+        mState = newState;
+        ScheduleUpdate();
     }
 }
 
@@ -2105,64 +2112,115 @@ void RoutingManager::RoutePublisher::DeterminePrefixFor(State aState, Ip6::Prefi
     }
 }
 
-void RoutingManager::RoutePublisher::UpdatePublishedRoute(State aNewState)
+void RoutingManager::RoutePublisher::ScheduleUpdate(void)
 {
-    // Updates the published route entry in Network Data, transitioning
-    // from current `mState` to new `aNewState`. This method can be used
-    // when there is no change to `mState` but a change to `mPreference`
-    // or `mAdvPioFlag`.
+    // Changes to the route to publish are rate limited and coalesced.
+    // A change is published immediately if Network Data was not
+    // updated in the last `kMinUpdateInterval`. Otherwise it is held
+    // until the interval passes, and any further changes in the
+    // meantime are combined with it. This way a route that changes
+    // and then reverts (e.g., while processing RAs from multiple
+    // routers) does not change the Network Data at all.
+
+    uint32_t elapsed;
+
+    VerifyOrExit(!mUpdateTimer.IsRunning());
+
+    elapsed = TimerMilli::GetNow() - mLastUpdateTime;
+
+    if (elapsed >= kMinUpdateInterval)
+    {
+        UpdatePublishedRoute();
+    }
+    else
+    {
+        mUpdateTimer.Start(kMinUpdateInterval - elapsed);
+    }
+
+exit:
+    return;
+}
+
+void RoutingManager::RoutePublisher::UpdatePublishedRoute(void)
+{
+    // Updates the published route entry in Network Data to match
+    // `mState`, `mPreference`, and `mAdvPioFlag`, transitioning from
+    // the currently published one. Nothing is changed if they are
+    // the same.
 
     Ip6::Prefix                      oldPrefix;
     NetworkData::ExternalRouteConfig routeConfig;
 
-    DeterminePrefixFor(mState, oldPrefix);
-
-    if (aNewState == kDoNotPublish)
+    if (mState == mPublishedState)
     {
         VerifyOrExit(mState != kDoNotPublish);
-        IgnoreError(Get<NetworkData::Publisher>().UnpublishPrefix(oldPrefix));
-        ExitNow();
+        VerifyOrExit((mPreference != mPublishedPreference) || (mAdvPioFlag != mPublishedAdvPioFlag));
     }
 
-    routeConfig.Clear();
-    routeConfig.mPreference = mPreference;
-    routeConfig.mAdvPio     = mAdvPioFlag;
-    routeConfig.mStable     = true;
-    DeterminePrefixFor(aNewState, routeConfig.GetPrefix());
+    LogInfo("Updating published route: %s -> %s", StateToString(mPublishedState), StateToString(mState));
+
+    mLastUpdateTime = TimerMilli::GetNow();
 
-    // If we were not publishing a route prefix before, publish the new
-    // `routeConfig`. Otherwise, use `ReplacePublishedExternalRoute()` to
-    // replace the previously published prefix entry. This ensures that we do
-    // not have a situation where the previous route is removed while the new
-    // one is not yet added in the Network Data.
+    DeterminePrefixFor(mPublishedState, oldPrefix);
 
     if (mState == kDoNotPublish)
     {
-        SuccessOrAssert(Get<NetworkData::Publisher>().PublishExternalRoute(
-            routeConfig, NetworkData::Publisher::kFromRoutingManager));
+        IgnoreError(Get<NetworkData::Publisher>().UnpublishPrefix(oldPrefix));
     }
     else
     {
-        SuccessOrAssert(Get<NetworkData::Publisher>().ReplacePublishedExternalRoute(
-            oldPrefix, routeConfig, NetworkData::Publisher::kFromRoutingManager));
+        routeConfig.Clear();
+        routeConfig.mPreference = mPreference;
+        routeConfig.mAdvPio     = mAdvPioFlag;
+        routeConfig.mStable     = true;
+        DeterminePrefixFor(mState, routeConfig.GetPrefix());
+
+        // If we were not publishing a route prefix before, publish the new
+        // `routeConfig`. Otherwise, use `ReplacePublishedExternalRoute()` to
+        // replace the previously published prefix entry. This ensures that we do
+        // not have a situation where the previous route is removed while the new
+        // one is not yet added in the Network Data.
+
+        if (mPublishedState == kDoNotPublish)
+        {
+            SuccessOrAssert(Get<NetworkData::Publisher>().PublishExternalRoute(
+                routeConfig, NetworkData::Publisher::kFromRoutingManager));
+        }
+        else
+        {
+            SuccessOrAssert(Get<NetworkData::Publisher>().ReplacePublishedExternalRoute(
+                oldPrefix, routeConfig, NetworkData::Publisher::kFromRoutingManager));
+        }
+    }
+
+    if (mState != mPublishedState)
+    {
+        Get<RoutingManager>().mOmrPrefixManager.UpdateDefaultRouteFlag(mState == kPublishDefault);
     }
 
+    mPublishedState      = mState;
+    mPublishedPreference = mPreference;
+    mPublishedAdvPioFlag = mAdvPioFlag;
+
 exit:
-    mState = aNewState;
+    return;
 }
 
 void RoutingManager::RoutePublisher::Unpublish(void)
 {
-    // Unpublish the previously published route based on `mState`
-    // and update `mState`.
+    // Unpublish the previously published route and update `mState`.
 
     Ip6::Prefix prefix;
 
-    VerifyOrExit(mState != kDoNotPublish);
-    DeterminePrefixFor(mState, prefix);
-    IgnoreError(Get<NetworkData::Publisher>().UnpublishPrefix(prefix));
+    mUpdateTimer.Stop();
     mState = kDoNotPublish;
 
+    VerifyOrExit(mPublishedState != kDoNotPublish);
+    DeterminePrefixFor(mPublishedState, prefix);
+    IgnoreError(Get<NetworkData::Publisher>().UnpublishPrefix(prefix));
+    mPublishedState = kDoNotPublish;
+    mLastUpdateTime = TimerMilli::GetNow();
+
 exit:
     return;
 }
@@ -2171,7 +2229,7 @@ void RoutingManager::RoutePublisher::UpdateAdvPioFlags(bool aAdvPioFlag)
 {
     VerifyOrExit(mAdvPioFlag != aAdvPioFlag);
     mAdvPioFlag = aAdvPioFlag;
-    UpdatePublishedRoute(mState);
+    ScheduleUpdate();
 
 exit:
     return;
@@ -2248,7 +2306,7 @@ void RoutingManager::RoutePublisher::UpdatePreference(RoutePreference aPreferenc
     LogInfo("Published route preference changed: %s -> %s", RoutePreferenceToString(mPreference),
             RoutePreferenceToString(aPreference));
     mPreference = aPreference;
-    UpdatePublishedRoute(mState);
+    ScheduleUpdate();
 
 exit:
     return;
@@ -887,6 +887,7 @@ private:
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
     void HandleRoutePublisherTimer(void) { mRoutePublisher.HandleTimer(); }
+    void HandleRoutePublisherUpdateTimer(void) { mRoutePublisher.HandleUpdateTimer(); }
 
     class RoutePublisher : public InstanceLocator // Manages the routes that are published in net data
     {
@@ -905,12 +906,21 @@ private:
 
         void HandleNotifierEvents(Events aEvents);
         void HandleTimer(void);
+        void HandleUpdateTimer(void) { UpdatePublishedRoute(); }
 
         static const Ip6::Prefix &GetUlaPrefix(void) { return AsCoreType(&kUlaPrefix); }
 
     private:
+        // `mState`, `mPreference`, and `mAdvPioFlag` track the route
+        // to publish, while `mPublished{State/Preference/AdvPioFlag}`
+        // track the route currently published in Network Data. The
+        // two are synced by `UpdatePublishedRoute()`, at most once
+        // every `kMinUpdateInterval` (see `ScheduleUpdate()`).
+
         static constexpr uint32_t kDelayBeforePrfUpdateOnLinkQuality3 = TimeMilli::SecToMsec(5 * 60);
 
+        static constexpr uint32_t kMinUpdateInterval = OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTE_PUBLISH_MIN_INTERVAL;
+
         static const otIp6Prefix kUlaPrefix;
 
         enum State : uint8_t
@@ -921,20 +931,27 @@ private:
         };
 
         void DeterminePrefixFor(State aState, Ip6::Prefix &aPrefix) const;
-        void UpdatePublishedRoute(State aNewState);
+        void ScheduleUpdate(void);
+        void UpdatePublishedRoute(void);
         void Unpublish(void);
         void SetPreferenceBasedOnRole(void);
         void UpdatePreference(RoutePreference aPreference);
 
         static const char *StateToString(State aState);
 
-        using DelayTimer = TimerMilliIn<RoutingManager, &RoutingManager::HandleRoutePublisherTimer>;
+        using DelayTimer  = TimerMilliIn<RoutingManager, &RoutingManager::HandleRoutePublisherTimer>;
+        using UpdateTimer = TimerMilliIn<RoutingManager, &RoutingManager::HandleRoutePublisherUpdateTimer>;
 
         State           mState;
+        State           mPublishedState;
         RoutePreference mPreference;
+        RoutePreference mPublishedPreference;
         bool            mUserSetPreference;
         bool            mAdvPioFlag;
+        bool            mPublishedAdvPioFlag;
+        TimeMilli       mLastUpdateTime;
         DelayTimer      mTimer;
+        UpdateTimer     mUpdateTimer;
     };
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
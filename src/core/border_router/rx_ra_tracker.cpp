@@ -52,6 +52,7 @@ RxRaTracker::RxRaTracker(Instance &aInstance)
     , mMultiAilDetectorEnabled(false)
     , mIsRunning(false)
     , mInitialDiscoveryFinished(false)
+    , mPrefixTableChanged(false)
     , mRsSender(aInstance)
     , mExpirationTimer(aInstance)
     , mStaleTimer(aInstance)
@@ -62,6 +63,8 @@ RxRaTracker::RxRaTracker(Instance &aInstance)
 {
     mLocalRaHeader.Clear();
     mPendingEvents.Clear();
+    mEvaluationCounters.Clear();
+    ClearAllBytes(mRouterBuckets);
 }
 
 void RxRaTracker::SetEnabled(bool aEnable, Requester aRequester)
@@ -130,6 +133,7 @@ void RxRaTracker::Stop(void)
     mIsRunning = false;
 
     mRouters.Free();
+    ClearAllBytes(mRouterBuckets);
     mIfAddresses.Free();
     mLocalRaHeader.Clear();
     mDecisionFactors.Clear();
@@ -203,7 +207,7 @@ void RxRaTracker::HandleRouterAdvertisement(const InfraIf::Icmp6Packet &aPacket,
 
     VerifyOrExit(origin != kThisBrRoutingManager);
 
-    router = mRouters.FindMatching(aSrcAddress);
+    router = FindRouter(aSrcAddress);
 
     if (router == nullptr)
     {
@@ -221,6 +225,7 @@ void RxRaTracker::HandleRouterAdvertisement(const InfraIf::Icmp6Packet &aPacket,
         router->mAddress      = aSrcAddress;
 
         mRouters.Push(*newEntry);
+        AddToBucket(*newEntry);
     }
 
     // RA message can indicate router provides default route in the RA
@@ -262,7 +267,7 @@ void RxRaTracker::HandleRouterAdvertisement(const InfraIf::Icmp6Packet &aPacket,
 
     router->ResetReachabilityState();
 
-    Evaluate();
+    EvaluateRouter(*router);
 
 exit:
     return;
@@ -326,6 +331,7 @@ void RxRaTracker::ProcessRaHeader(const RouterAdvert::Header &aRaHeader, Router
 
         entry->SetFrom(aRaHeader);
         aRouter.mRoutePrefixes.Push(*entry);
+        mPrefixTableChanged = true;
     }
     else
     {
@@ -359,7 +365,11 @@ void RxRaTracker::ProcessPrefixInfoOption(const PrefixInfoOption &aPio, Router &
 
     if (!aPio.IsOnLinkFlagSet())
     {
-        aRouter.mOnLinkPrefixes.RemoveMatching(prefix);
+        if (aRouter.mOnLinkPrefixes.RemoveAndFreeAllMatching(prefix))
+        {
+            mPrefixTableChanged = true;
+        }
+
         ExitNow();
     }
 
@@ -391,6 +401,7 @@ void RxRaTracker::ProcessPrefixInfoOption(const PrefixInfoOption &aPio, Router &
 
         entry->SetFrom(aPio);
         aRouter.mOnLinkPrefixes.Push(*entry);
+        mPrefixTableChanged = true;
     }
     else
     {
@@ -453,6 +464,7 @@ void RxRaTracker::ProcessRouteInfoOption(const RouteInfoOption &aRio, Router &aR
 
         entry->SetFrom(aRio);
         aRouter.mRoutePrefixes.Push(*entry);
+        mPrefixTableChanged = true;
     }
     else
     {
@@ -766,33 +778,47 @@ void RxRaTracker::RemoveOrDeprecateOldEntries(TimeMilli aTimeThreshold)
     Evaluate();
 }
 
-void RxRaTracker::Evaluate(void)
+void RxRaTracker::RemoveExpiredEntries(Router &aRouter, TimeMilli aNow)
 {
-    DecisionFactors oldFactors = mDecisionFactors;
-    TimeMilli       now        = TimerMilli::GetNow();
-    NextFireTime    routerTimeoutTime(now);
-    NextFireTime    entryExpireTime(now);
-    NextFireTime    staleTime(now);
-    NextFireTime    rdnsssAddrExpireTime(now);
-    RouterList      removedRouters;
+    ExpirationChecker expirationChecker(aNow);
 
-    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    // Remove expired entries associated with each router
+    if (aRouter.mOnLinkPrefixes.RemoveAndFreeAllMatching(expirationChecker))
+    {
+        mPrefixTableChanged = true;
+    }
 
-    for (Router &router : mRouters)
+    if (aRouter.mRoutePrefixes.RemoveAndFreeAllMatching(expirationChecker))
     {
-        ExpirationChecker expirationChecker(now);
+        mPrefixTableChanged = true;
+    }
 
-        router.mOnLinkPrefixes.RemoveAndFreeAllMatching(expirationChecker);
-        router.mRoutePrefixes.RemoveAndFreeAllMatching(expirationChecker);
 #if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
-        router.mNat64Prefixes.RemoveAndFreeAllMatching(expirationChecker);
+    aRouter.mNat64Prefixes.RemoveAndFreeAllMatching(expirationChecker);
 #endif
 
-        if (router.mRdnssAddresses.RemoveAndFreeAllMatching(expirationChecker))
-        {
-            mRdnssAddrTask.Post();
-        }
+    if (aRouter.mRdnssAddresses.RemoveAndFreeAllMatching(expirationChecker))
+    {
+        mRdnssAddrTask.Post();
+    }
+}
+
+void RxRaTracker::Evaluate(void)
+{
+    TimeMilli    now = TimerMilli::GetNow();
+    NextFireTime routerTimeoutTime(now);
+    NextFireTime entryExpireTime(now);
+    NextFireTime staleTime(now);
+    NextFireTime rdnsssAddrExpireTime(now);
+    RouterList   removedRouters;
+
+    mEvaluationCounters.mFullEvaluations++;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove expired entries associated with each router
+
+    for (Router &router : mRouters)
+    {
+        RemoveExpiredEntries(router, now);
     }
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -801,12 +827,14 @@ void RxRaTracker::Evaluate(void)
 
     mRouters.RemoveAllMatching(removedRouters, Router::EmptyChecker());
 
-#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
-    for (Router &router : removedRouters)
+    for (Entry<Router> &router : removedRouters)
     {
+        RemoveFromBucket(router);
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
         ReportChangesToHistoryTracker(router, /* aRemoved */ true);
-    }
 #endif
+    }
 
     removedRouters.Free();
 
@@ -814,47 +842,12 @@ void RxRaTracker::Evaluate(void)
     // Determine decision factors (favored on-link prefix, has any
     // ULA/non-ULA on-link/route prefix, M/O flags).
 
-    mDecisionFactors.Clear();
-
     for (Router &router : mRouters)
     {
-        router.mAllEntriesDisregarded = true;
-
-        mDecisionFactors.UpdateFlagsFrom(router);
-
-        for (OnLinkPrefix &entry : router.mOnLinkPrefixes)
-        {
-            mDecisionFactors.UpdateFrom(entry);
-            entry.SetStaleTimeCalculated(false);
-
-            router.mAllEntriesDisregarded &= entry.ShouldDisregard();
-        }
-
-        for (RoutePrefix &entry : router.mRoutePrefixes)
-        {
-            mDecisionFactors.UpdateFrom(entry);
-            entry.SetStaleTimeCalculated(false);
-
-            router.mAllEntriesDisregarded &= entry.ShouldDisregard();
-        }
-
-#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
-        for (Nat64Prefix &entry : router.mNat64Prefixes)
-        {
-            mDecisionFactors.UpdateFrom(entry);
-        }
-#endif
+        router.DetermineDecisionFactors();
     }
 
-#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
-    mDecisionFactors.mReachablePeerBrCount = CountReachablePeerBrs();
-#endif
-
-    if (oldFactors != mDecisionFactors)
-    {
-        mPendingEvents.mDecisionFactorChanged = true;
-        mEventTask.Post();
-    }
+    UpdateDecisionFactors();
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -866,19 +859,11 @@ void RxRaTracker::Evaluate(void)
     Get<RoutingManager>().mPdPrefixManager.CheckConflict(RoutingManager::PdPrefixManager::kRxRaPrefixTableChanged);
 #endif
 
+    mPrefixTableChanged = false;
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Schedule timers
 
-    // If multiple routers advertise the same on-link or route prefix,
-    // the stale time for the prefix is determined by the latest stale
-    // time among all corresponding entries.
-    //
-    // The "StaleTimeCalculated" flag is used to ensure stale time is
-    // calculated only once for each unique prefix. Initially, this
-    // flag is cleared on all entries. As we iterate over routers and
-    // their entries, `DetermineStaleTimeFor()` will consider all
-    // matching entries and mark "StaleTimeCalculated" flag on them.
-
     for (Router &router : mRouters)
     {
         if (router.ShouldCheckReachability())
@@ -887,24 +872,23 @@ void RxRaTracker::Evaluate(void)
             routerTimeoutTime.UpdateIfEarlier(router.mTimeoutTime);
         }
 
+        // The favored on-link prefix in the decision factors depends
+        // on whether on-link prefixes are deprecated, so the timer is
+        // also used to evaluate again when a prefix gets deprecated.
+
         for (const OnLinkPrefix &entry : router.mOnLinkPrefixes)
         {
             entryExpireTime.UpdateIfEarlier(entry.GetExpireTime());
 
-            if (!entry.IsStaleTimeCalculated())
+            if (!entry.IsDeprecated())
             {
-                DetermineStaleTimeFor(entry, staleTime);
+                entryExpireTime.UpdateIfEarlier(entry.GetDeprecationTime());
             }
         }
 
         for (const RoutePrefix &entry : router.mRoutePrefixes)
         {
             entryExpireTime.UpdateIfEarlier(entry.GetExpireTime());
-
-            if (!entry.IsStaleTimeCalculated())
-            {
-                DetermineStaleTimeFor(entry, staleTime);
-            }
         }
 
 #if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
@@ -920,17 +904,7 @@ void RxRaTracker::Evaluate(void)
         }
     }
 
-    if (mLocalRaHeader.IsValid())
-    {
-        uint16_t interval = kStaleTime;
-
-        if (mLocalRaHeader.GetRouterLifetime() > 0)
-        {
-            interval = Min(interval, mLocalRaHeader.GetRouterLifetime());
-        }
-
-        staleTime.UpdateIfEarlier(CalculateClampedExpirationTime(mLocalRaHeaderUpdateTime, interval));
-    }
+    DetermineStaleTime(staleTime);
 
     mRouterTimer.FireAt(routerTimeoutTime);
     mExpirationTimer.FireAt(entryExpireTime);
@@ -949,6 +923,186 @@ void RxRaTracker::Evaluate(void)
 #endif
 }
 
+void RxRaTracker::EvaluateRouter(Router &aRouter)
+{
+    // Evaluates after an RA or NA from `aRouter` is processed. Only
+    // `aRouter` and its entries can have changed, so the decision
+    // factors of other routers (determined during an earlier
+    // evaluation) are reused. If the decision factors of `aRouter`
+    // stay the same (e.g., an RA with no change), the cost is
+    // proportional to the number of `aRouter` entries.
+    //
+    // Timers are only moved earlier here, so they may fire before
+    // anything is due. Their handlers check for this.
+
+    TimeMilli       now        = TimerMilli::GetNow();
+    DecisionFactors oldFactors = aRouter.mDecisionFactors;
+    NextFireTime    routerTimeoutTime(now);
+    NextFireTime    entryExpireTime(now);
+    NextFireTime    staleTime(now);
+    NextFireTime    rdnsssAddrExpireTime(now);
+
+    RemoveExpiredEntries(aRouter, now);
+
+    if (aRouter.Matches(Router::EmptyChecker()))
+    {
+        // The router entry needs to be removed, which is handled
+        // by a full evaluation.
+
+        Evaluate();
+        ExitNow();
+    }
+
+    mEvaluationCounters.mIncrementalEvaluations++;
+
+    aRouter.DetermineDecisionFactors();
+
+    if (aRouter.mDecisionFactors != oldFactors)
+    {
+        UpdateDecisionFactors();
+    }
+
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE
+    if (mPrefixTableChanged)
+    {
+        Get<RoutingManager>().mPdPrefixManager.CheckConflict(RoutingManager::PdPrefixManager::kRxRaPrefixTableChanged);
+    }
+#endif
+
+    mPrefixTableChanged = false;
+
+    if (aRouter.ShouldCheckReachability())
+    {
+        aRouter.DetermineReachabilityTimeout();
+        routerTimeoutTime.UpdateIfEarlier(aRouter.mTimeoutTime);
+    }
+
+    for (const OnLinkPrefix &entry : aRouter.mOnLinkPrefixes)
+    {
+        entryExpireTime.UpdateIfEarlier(entry.GetExpireTime());
+
+        if (!entry.IsDeprecated())
+        {
+            entryExpireTime.UpdateIfEarlier(entry.GetDeprecationTime());
+            staleTime.UpdateIfEarlier(Max(now, entry.GetStaleTime()));
+        }
+    }
+
+    for (const RoutePrefix &entry : aRouter.mRoutePrefixes)
+    {
+        entryExpireTime.UpdateIfEarlier(entry.GetExpireTime());
+        staleTime.UpdateIfEarlier(Max(now, entry.GetStaleTime()));
+    }
+
+#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
+    for (const Nat64Prefix &entry : aRouter.mNat64Prefixes)
+    {
+        entryExpireTime.UpdateIfEarlier(entry.GetExpireTime());
+    }
+#endif
+
+    for (const RdnssAddress &entry : aRouter.mRdnssAddresses)
+    {
+        rdnsssAddrExpireTime.UpdateIfEarlier(entry.GetExpireTime());
+    }
+
+    DetermineLocalRaHeaderStaleTime(staleTime);
+
+    mRouterTimer.FireAtIfEarlier(routerTimeoutTime);
+    mExpirationTimer.FireAtIfEarlier(entryExpireTime);
+    mStaleTimer.FireAtIfEarlier(staleTime);
+    mRdnssAddrTimer.FireAtIfEarlier(rdnsssAddrExpireTime);
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
+    ReportChangesToHistoryTracker(aRouter, /* aRemoved */ false);
+#endif
+
+exit:
+    return;
+}
+
+void RxRaTracker::UpdateDecisionFactors(void)
+{
+    DecisionFactors oldFactors = mDecisionFactors;
+
+    mDecisionFactors.Clear();
+
+    for (const Router &router : mRouters)
+    {
+        mDecisionFactors.MergeFrom(router.mDecisionFactors);
+    }
+
+    if (oldFactors != mDecisionFactors)
+    {
+        mPendingEvents.mDecisionFactorChanged = true;
+        mEventTask.Post();
+    }
+}
+
+void RxRaTracker::DetermineStaleTime(NextFireTime &aStaleTime)
+{
+    // If multiple routers advertise the same on-link or route prefix,
+    // the stale time for the prefix is determined by the latest stale
+    // time among all corresponding entries.
+    //
+    // The "StaleTimeCalculated" flag is used to ensure stale time is
+    // calculated only once for each unique prefix. Initially, this
+    // flag is cleared on all entries. As we iterate over routers and
+    // their entries, `DetermineStaleTimeFor()` will consider all
+    // matching entries and mark "StaleTimeCalculated" flag on them.
+
+    for (Router &router : mRouters)
+    {
+        for (OnLinkPrefix &entry : router.mOnLinkPrefixes)
+        {
+            entry.SetStaleTimeCalculated(false);
+        }
+
+        for (RoutePrefix &entry : router.mRoutePrefixes)
+        {
+            entry.SetStaleTimeCalculated(false);
+        }
+    }
+
+    for (const Router &router : mRouters)
+    {
+        for (const OnLinkPrefix &entry : router.mOnLinkPrefixes)
+        {
+            if (!entry.IsStaleTimeCalculated())
+            {
+                DetermineStaleTimeFor(entry, aStaleTime);
+            }
+        }
+
+        for (const RoutePrefix &entry : router.mRoutePrefixes)
+        {
+            if (!entry.IsStaleTimeCalculated())
+            {
+                DetermineStaleTimeFor(entry, aStaleTime);
+            }
+        }
+    }
+
+    DetermineLocalRaHeaderStaleTime(aStaleTime);
+}
+
+void RxRaTracker::DetermineLocalRaHeaderStaleTime(NextFireTime &aStaleTime) const
+{
+    uint16_t interval = kStaleTime;
+
+    VerifyOrExit(mLocalRaHeader.IsValid());
+
+    if (mLocalRaHeader.GetRouterLifetime() > 0)
+    {
+        interval = Min(interval, mLocalRaHeader.GetRouterLifetime());
+    }
+
+    aStaleTime.UpdateIfEarlier(CalculateClampedExpirationTime(mLocalRaHeaderUpdateTime, interval));
+
+exit:
+    return;
+}
+
 void RxRaTracker::DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime)
 {
     TimeMilli prefixStaleTime = aStaleTime.GetNow();
@@ -1010,8 +1164,23 @@ void RxRaTracker::DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime
 
 void RxRaTracker::HandleStaleTimer(void)
 {
+    NextFireTime staleTime;
+
     VerifyOrExit(mIsRunning);
 
+    // The timer may fire early after `EvaluateRouter()`, so the
+    // stale time is determined again and if it is still in the
+    // future, the timer is rescheduled.
+
+    DetermineStaleTime(staleTime);
+    VerifyOrExit(staleTime.IsSet());
+
+    if (staleTime.GetNextTime() > staleTime.GetNow())
+    {
+        mStaleTimer.FireAt(staleTime);
+        ExitNow();
+    }
+
     LogInfo("Stale timer expired");
     mRsSender.Start();
 
@@ -1054,14 +1223,14 @@ void RxRaTracker::HandleNeighborAdvertisement(const InfraIf::Icmp6Packet &aPacke
 
     VerifyOrExit(naMsg->IsValid());
 
-    router = mRouters.FindMatching(naMsg->GetTargetAddress());
+    router = FindRouter(naMsg->GetTargetAddress());
     VerifyOrExit(router != nullptr);
 
     LogInfo("Received NA from router %s", router->mAddress.ToString().AsCString());
 
     router->ResetReachabilityState();
 
-    Evaluate();
+    EvaluateRouter(*router);
 
 exit:
     return;
@@ -1069,7 +1238,9 @@ exit:
 
 void RxRaTracker::HandleRouterTimer(void)
 {
-    TimeMilli now = TimerMilli::GetNow();
+    TimeMilli    now                = TimerMilli::GetNow();
+    NextFireTime routerTimeoutTime(now);
+    bool         didMarkUnreachable = false;
 
     for (Router &router : mRouters)
     {
@@ -1091,6 +1262,8 @@ void RxRaTracker::HandleRouterTimer(void)
             LogInfo("No response to all Neighbor Solicitations attempts from router %s - marking it unreachable",
                     router.mAddress.ToString().AsCString());
 
+            didMarkUnreachable = true;
+
             // Remove route prefix entries and deprecate on-link prefix entries
             // of the unreachable router.
 
@@ -1118,7 +1291,27 @@ void RxRaTracker::HandleRouterTimer(void)
         }
     }
 
-    Evaluate();
+    if (didMarkUnreachable)
+    {
+        Evaluate();
+        ExitNow();
+    }
+
+    // No router became unreachable (the timer may also fire early
+    // after `EvaluateRouter()`), so only the timer is rescheduled.
+
+    for (const Router &router : mRouters)
+    {
+        if (router.ShouldCheckReachability())
+        {
+            routerTimeoutTime.UpdateIfEarlier(router.mTimeoutTime);
+        }
+    }
+
+    mRouterTimer.FireAt(routerTimeoutTime);
+
+exit:
+    return;
 }
 
 void RxRaTracker::HandleRdnssAddrTimer(void) { Evaluate(); }
@@ -1151,6 +1344,68 @@ exit:
     return;
 }
 
+uint16_t RxRaTracker::BucketFor(const Ip6::Address &aAddress)
+{
+    uint16_t hash = 0;
+
+    for (uint16_t word : aAddress.mFields.m16)
+    {
+        hash ^= word;
+    }
+
+    hash ^= (hash >> 8);
+
+    return hash & (kNumRouterBuckets - 1);
+}
+
+RxRaTracker::Router *RxRaTracker::FindRouter(const Ip6::Address &aAddress)
+{
+    Entry<Router> *router;
+
+    for (router = mRouterBuckets[BucketFor(aAddress)]; router != nullptr; router = router->mNextInBucket)
+    {
+        if (router->Matches(aAddress))
+        {
+            break;
+        }
+    }
+
+    return router;
+}
+
+void RxRaTracker::AddToBucket(Entry<Router> &aRouter)
+{
+    Entry<Router> *&head = mRouterBuckets[BucketFor(aRouter.mAddress)];
+
+    aRouter.mNextInBucket = head;
+    head                  = &aRouter;
+}
+
+void RxRaTracker::RemoveFromBucket(const Entry<Router> &aRouter)
+{
+    Entry<Router> *&head = mRouterBuckets[BucketFor(aRouter.mAddress)];
+    Entry<Router>  *prev = nullptr;
+
+    for (Entry<Router> *router = head; router != nullptr; router = router->mNextInBucket)
+    {
+        if (router == &aRouter)
+        {
+            if (prev == nullptr)
+            {
+                head = aRouter.mNextInBucket;
+            }
+            else
+            {
+                prev->mNextInBucket = aRouter.mNextInBucket;
+            }
+
+            break;
+        }
+
+        prev = router;
+    }
+}
+
 void RxRaTracker::SetHeaderFlagsOn(RouterAdvert::Header &aHeader) const
 {
     if (mDecisionFactors.mHeaderManagedAddressConfigFlag)
@@ -1337,23 +1592,6 @@ exit:
     return error;
 }
 
-#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
-uint16_t RxRaTracker::CountReachablePeerBrs(void) const
-{
-    uint16_t count = 0;
-
-    for (const Router &router : mRouters)
-    {
-        if (!router.mIsLocalDevice && router.IsPeerBr() && router.IsReachable())
-        {
-            count++;
-        }
-    }
-
-    return count;
-}
-#endif
-
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
 
 void RxRaTracker::ReportChangesToHistoryTracker(Router &aRouter, bool aRemoved)
@@ -1630,6 +1868,37 @@ exit:
     return;
 }
 
+void RxRaTracker::Router::DetermineDecisionFactors(void)
+{
+    mDecisionFactors.Clear();
+    mAllEntriesDisregarded = true;
+
+    mDecisionFactors.UpdateFlagsFrom(*this);
+
+    for (const OnLinkPrefix &entry : mOnLinkPrefixes)
+    {
+        mDecisionFactors.UpdateFrom(entry);
+        mAllEntriesDisregarded &= entry.ShouldDisregard();
+    }
+
+    for (const RoutePrefix &entry : mRoutePrefixes)
+    {
+        mDecisionFactors.UpdateFrom(entry);
+        mAllEntriesDisregarded &= entry.ShouldDisregard();
+    }
+
+#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
+    for (const Nat64Prefix &entry : mNat64Prefixes)
+    {
+        mDecisionFactors.UpdateFrom(entry);
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
+    mDecisionFactors.mReachablePeerBrCount = (!mIsLocalDevice && IsPeerBr() && IsReachable()) ? 1 : 0;
+#endif
+}
+
 bool RxRaTracker::Router::Matches(const EmptyChecker &aChecker)
 {
     OT_UNUSED_VARIABLE(aChecker);
@@ -1790,6 +2059,36 @@ void RxRaTracker::DecisionFactors::UpdateFrom(const Nat64Prefix &aNat64Prefix)
 }
 #endif
 
+void RxRaTracker::DecisionFactors::MergeFrom(const DecisionFactors &aFactors)
+{
+    // Combines the decision factors of two sets of routers, e.g., to
+    // add the factors determined for a single router.
+
+    if (aFactors.HasFavoredOnLink() &&
+        (!HasFavoredOnLink() || (aFactors.mFavoredOnLinkPrefix < mFavoredOnLinkPrefix)))
+    {
+        mFavoredOnLinkPrefix = aFactors.mFavoredOnLinkPrefix;
+    }
+
+#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
+    if ((aFactors.mFavoredNat64Prefix.GetLength() != 0) &&
+        ((mFavoredNat64Prefix.GetLength() == 0) || (aFactors.mFavoredNat64Prefix < mFavoredNat64Prefix)))
+    {
+        mFavoredNat64Prefix = aFactors.mFavoredNat64Prefix;
+    }
+#endif
+
+    mHasNonUlaRoute |= aFactors.mHasNonUlaRoute;
+    mHasNonUlaOnLink |= aFactors.mHasNonUlaOnLink;
+    mHasUlaOnLink |= aFactors.mHasUlaOnLink;
+    mHeaderManagedAddressConfigFlag |= aFactors.mHeaderManagedAddressConfigFlag;
+    mHeaderOtherConfigFlag |= aFactors.mHeaderOtherConfigFlag;
+
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
+    mReachablePeerBrCount += aFactors.mReachablePeerBrCount;
+#endif
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // RxRaTracker::RsSender
 
@@ -99,6 +99,18 @@ public:
         bool mLocalRaHeaderChanged : 1;     ///< Indicates that the tracked local RA header was changed.
     };
 
+    /**
+     * Represents the counters of evaluations of the tracked routers and their entries.
+     *
+     * A full evaluation goes over all routers and their entries. An incremental evaluation is used when an RA or NA
+     * message is received and only goes over the entries of the sending router.
+     */
+    struct EvaluationCounters : public Clearable<EvaluationCounters>
+    {
+        uint32_t mFullEvaluations;        ///< Number of full evaluations.
+        uint32_t mIncrementalEvaluations; ///< Number of incremental evaluations.
+    };
+
     /**
      * Initializes the `RxRaTracker` object.
      *
@@ -327,12 +339,27 @@ public:
      */
     bool ContainsRoutePrefix(const Ip6::Prefix &aPrefix) const;
 
+    /**
+     * Gets the RA table evaluation counters.
+     *
+     * @returns The evaluation counters.
+     */
+    const EvaluationCounters &GetEvaluationCounters(void) const { return mEvaluationCounters; }
+
     // Callbacks notifying of changes
     void HandleLocalOnLinkPrefixChanged(void);
 
 private:
     static constexpr uint32_t kStaleTime = 600; // 10 minutes.
 
+    // Discovered routers are also kept in a hash table keyed by the
+    // router address, where each bucket is a list (`mNextInBucket`).
+
+    static constexpr uint16_t kNumRouterBuckets = OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTER_HASH_TABLE_SIZE;
+
+    static_assert(kNumRouterBuckets > 0 && (kNumRouterBuckets & (kNumRouterBuckets - 1)) == 0,
+                  "OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTER_HASH_TABLE_SIZE MUST be a power of two");
+
     typedef Ip6::Nd::Option    Option;
     typedef Ip6::Nd::TxMessage TxMessage;
 
@@ -366,6 +393,38 @@ private:
 
     //-  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
 
+    struct Router;
+
+    struct DecisionFactors : public Clearable<DecisionFactors>, public Equatable<DecisionFactors>
+    {
+        DecisionFactors(void) { Clear(); }
+
+        bool HasFavoredOnLink(void) const { return (mFavoredOnLinkPrefix.GetLength() != 0); }
+        void UpdateFlagsFrom(const Router &aRouter);
+        void UpdateFrom(const OnLinkPrefix &aOnLinkPrefix);
+        void UpdateFrom(const RoutePrefix &aRoutePrefix);
+#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
+        void UpdateFrom(const Nat64Prefix &aNat64Prefix);
+#endif
+        void MergeFrom(const DecisionFactors &aFactors);
+
+        Ip6::Prefix mFavoredOnLinkPrefix;
+#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
+        Ip6::Prefix mFavoredNat64Prefix;
+#endif
+        bool mHasNonUlaRoute : 1;
+        bool mHasNonUlaOnLink : 1;
+        bool mHasUlaOnLink : 1;
+        bool mHeaderManagedAddressConfigFlag : 1;
+        bool mHeaderOtherConfigFlag : 1;
+
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
+        uint16_t mReachablePeerBrCount;
+#endif
+    };
+
+    //-  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
+
     struct Router : public Clearable<Router>
     {
         // Reachability timeout intervals before starting Neighbor
@@ -411,6 +470,7 @@ private:
         bool ShouldCheckReachability(void) const;
         void ResetReachabilityState(void);
         void DetermineReachabilityTimeout(void);
+        void DetermineDecisionFactors(void);
         bool Matches(const Ip6::Address &aAddress) const { return aAddress == mAddress; }
         bool Matches(const EmptyChecker &aChecker);
         bool IsPeerBr(void) const;
@@ -432,8 +492,14 @@ private:
         // NA was received from this router. It is bounded due to
         // the frequency of reachability checks, so we can safely
         // use `TimeMilli` for it.
+        //
+        // `mDecisionFactors` tracks the decision factors determined
+        // from this router and its entries only. They are combined
+        // across all routers to get the `RxRaTracker` decision
+        // factors.
 
         Ip6::Address     mAddress;
+        Entry<Router>   *mNextInBucket;
         OnLinkPrefixList mOnLinkPrefixes;
         RoutePrefixList  mRoutePrefixes;
 #if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
@@ -449,6 +515,7 @@ private:
         bool             mSnacRouterFlag : 1;
         bool             mIsLocalDevice : 1;
         bool             mAllEntriesDisregarded : 1;
+        DecisionFactors  mDecisionFactors;
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
         HistoryInfo mHistoryInfo;
 #endif
@@ -531,35 +598,6 @@ private:
 
     //-  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
 
-    struct DecisionFactors : public Clearable<DecisionFactors>, public Equatable<DecisionFactors>
-    {
-        DecisionFactors(void) { Clear(); }
-
-        bool HasFavoredOnLink(void) const { return (mFavoredOnLinkPrefix.GetLength() != 0); }
-        void UpdateFlagsFrom(const Router &aRouter);
-        void UpdateFrom(const OnLinkPrefix &aOnLinkPrefix);
-        void UpdateFrom(const RoutePrefix &aRoutePrefix);
-#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
-        void UpdateFrom(const Nat64Prefix &aNat64Prefix);
-#endif
-
-        Ip6::Prefix mFavoredOnLinkPrefix;
-#if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
-        Ip6::Prefix mFavoredNat64Prefix;
-#endif
-        bool mHasNonUlaRoute : 1;
-        bool mHasNonUlaOnLink : 1;
-        bool mHasUlaOnLink : 1;
-        bool mHeaderManagedAddressConfigFlag : 1;
-        bool mHeaderOtherConfigFlag : 1;
-
-#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
-        uint16_t mReachablePeerBrCount;
-#endif
-    };
-
-    //-  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
-
     void HandleRsSenderTimer(void) { mRsSender.HandleTimer(); }
 
     class RsSender : public InstanceLocator
@@ -611,16 +649,25 @@ private:
     void ProcessRecursiveDnsServerOption(const RecursiveDnsServerOption &aRdnss, Router &aRouter);
     void UpdateIfAddresses(const Ip6::Address &aAddress);
     void RemoveOrDeprecateOldEntries(TimeMilli aTimeThreshold);
+    void RemoveExpiredEntries(Router &aRouter, TimeMilli aNow);
     void Evaluate(void);
+    void EvaluateRouter(Router &aRouter);
+    void UpdateDecisionFactors(void);
+    void DetermineStaleTime(NextFireTime &aStaleTime);
     void DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime);
     void DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime &aStaleTime);
+    void DetermineLocalRaHeaderStaleTime(NextFireTime &aStaleTime) const;
     void SendNeighborSolicitToRouter(const Router &aRouter);
-#if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
-    uint16_t CountReachablePeerBrs(void) const;
-#endif
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
     void ReportChangesToHistoryTracker(Router &aRouter, bool aRemoved);
 #endif
+
+    Router *FindRouter(const Ip6::Address &aAddress);
+    void    AddToBucket(Entry<Router> &aRouter);
+    void    RemoveFromBucket(const Entry<Router> &aRouter);
+
+    static uint16_t BucketFor(const Ip6::Address &aAddress);
+
     void HandleNotifierEvents(ot::Events aEvents);
     void HandleNetDataChange(void);
 
@@ -659,10 +706,13 @@ private:
     bool                 mMultiAilDetectorEnabled : 1;
     bool                 mIsRunning : 1;
     bool                 mInitialDiscoveryFinished : 1;
+    bool                 mPrefixTableChanged : 1;
     Events               mPendingEvents;
     RsSender             mRsSender;
     DecisionFactors      mDecisionFactors;
+    EvaluationCounters   mEvaluationCounters;
     RouterList           mRouters;
+    Entry<Router>       *mRouterBuckets[kNumRouterBuckets];
     IfAddressList        mIfAddresses;
     ExpirationTimer      mExpirationTimer;
     StaleTimer           mStaleTimer;
@@ -28,6 +28,7 @@
 
 #include "coap.hpp"
 
+#include "common/fnv_hash.hpp"
 #include "instance/instance.hpp"
 
 /**
@@ -125,6 +126,9 @@ CoapBase::CoapBase(Instance &aInstance, Transmitter aTransmitter)
     , mResourceHandler(nullptr)
     , mTransmitter(aTransmitter)
     , mMessageId(Random::NonCrypto::Generate<uint16_t>())
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    , mCongestionControl(nullptr)
+#endif
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     , mLastResponse(nullptr)
 #endif
@@ -137,11 +141,11 @@ void CoapBase::ClearAllRequestsAndResponses(void)
     mResponseCache.RemoveAll();
 }
 
-void CoapBase::AddResource(Resource &aResource) { IgnoreError(mResources.Add(aResource)); }
+void CoapBase::AddResource(Resource &aResource) { mResources.Add(aResource); }
 
 void CoapBase::RemoveResource(Resource &aResource)
 {
-    IgnoreError(mResources.Remove(aResource));
+    mResources.Remove(aResource);
     aResource.SetNext(nullptr);
 }
 
@@ -290,6 +294,16 @@ Error CoapBase::SendMessage(Message                &aMessage,
         break;
     }
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    if (request.HasMessage() && request.IsDeferred())
+    {
+        // The request is sent (from its pending copy) once an
+        // outstanding exchange with the peer completes.
+        txMsg.mMessage.Free();
+        ExitNow();
+    }
+#endif
+
     SuccessOrExit(error = Transmit(txMsg.mMessage, txMsg.mMessageInfo));
 
 exit:
@@ -578,6 +592,10 @@ void CoapBase::ProcessReceivedResponse(Msg &aRxMsg)
         break;
 
     case kTypeAck:
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        mPendingRequests.HandleAcknowledgment(request);
+#endif
+
         if (aRxMsg.IsEmpty())
         {
             // Empty acknowledgment.
@@ -683,6 +701,17 @@ exit:
     return;
 }
 
+bool CoapBase::HasResources(void) const
+{
+    bool hasResources = !mResources.IsEmpty();
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    hasResources = hasResources || !mBlockWiseResources.IsEmpty();
+#endif
+
+    return hasResources;
+}
+
 bool CoapBase::InvokeResponseFallback(Msg &aRxMsg) const
 {
     bool didHandle = false;
@@ -696,8 +725,7 @@ exit:
 
 void CoapBase::ProcessReceivedRequest(Msg &aRxMsg)
 {
-    Message::UriPathStringBuffer uriPath;
-    Error                        error = kErrorNone;
+    Error error = kErrorNone;
 
     if (mInterceptor.IsSet())
     {
@@ -719,28 +747,44 @@ void CoapBase::ProcessReceivedRequest(Msg &aRxMsg)
         ExitNow();
     }
 
-    SuccessOrExit(error = aRxMsg.mMessage.ReadUriPathOptions(uriPath));
+    // The resource handler (used by TMF agents) gets the URI decoded
+    // directly from the Uri-Path options. The URI path string is only
+    // constructed when there are added resources to match against.
 
-#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    if (mResourceHandler != nullptr)
     {
-        bool didHandle = false;
+        Uri uri;
 
-        SuccessOrExit(error = ProcessBlockwiseRequest(aRxMsg, uriPath, didHandle));
-        VerifyOrExit(!didHandle);
-    }
-#endif
+        SuccessOrExit(error = aRxMsg.mMessage.ReadUri(uri));
 
-    if ((mResourceHandler != nullptr) && mResourceHandler(*this, uriPath, aRxMsg))
-    {
-        error = kErrorNone;
-        ExitNow();
+        if (mResourceHandler(*this, uri, aRxMsg))
+        {
+            error = kErrorNone;
+            ExitNow();
+        }
     }
 
-    for (const Resource &resource : mResources)
+    if (HasResources())
     {
-        if (StringMatch(resource.mUriPath, uriPath))
+        Message::UriPathStringBuffer uriPath;
+        const Resource              *resource;
+
+        SuccessOrExit(error = aRxMsg.mMessage.ReadUriPathOptions(uriPath));
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
         {
-            resource.HandleRequest(aRxMsg);
+            bool didHandle = false;
+
+            SuccessOrExit(error = ProcessBlockwiseRequest(aRxMsg, uriPath, didHandle));
+            VerifyOrExit(!didHandle);
+        }
+#endif
+
+        resource = mResources.Find(uriPath);
+
+        if (resource != nullptr)
+        {
+            resource->HandleRequest(aRxMsg);
             error = kErrorNone;
             ExitNow();
         }
@@ -1479,6 +1523,13 @@ void CoapBase::Request::Metadata::Init(const Msg           &aTxMsg,
     mIsHostInterface = aTxMsg.mMessageInfo.IsHostInterface();
 #endif
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    mCongestionControlled = false;
+    mDeferred             = false;
+    mNumTx                = 1;
+    mBackoffFactor        = 0;
+#endif
+
     mTimerFireTime = TimerMilli::GetNow() + (mConfirmable ? mRetxTimeout : aTxParams.CalculateMaxTransmitWait());
 }
 
@@ -1514,7 +1565,22 @@ bool CoapBase::Request::ShouldRetransmit(void) const { return IsConfirmable() &&
 void CoapBase::Request::UpdateRetxCounterAndTimeout(TimeMilli aNow)
 {
     mMetadata.mRetxRemaining--;
-    mMetadata.mRetxTimeout *= 2;
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    if (mMetadata.mCongestionControlled)
+    {
+        mMetadata.mRetxTimeout = CongestionControl::CalculateBackoff(mMetadata.mRetxTimeout, mMetadata.mBackoffFactor);
+
+        if (!mMetadata.mAcknowledged && (mMetadata.mNumTx < NumericLimits<uint8_t>::kMax))
+        {
+            mMetadata.mNumTx++;
+        }
+    }
+    else
+#endif
+    {
+        mMetadata.mRetxTimeout *= 2;
+    }
 
     mMetadata.mTimerFireTime = aNow + mMetadata.mRetxTimeout;
     WriteMetadataInMessage();
@@ -1530,6 +1596,98 @@ bool CoapBase::Request::IsObserveSubscription(void) const
 }
 #endif
 
+//---------------------------------------------------------------------------------------------------------------------
+// CoapBase::MessageIndex
+
+template <uint16_t kSize> void CoapBase::MessageIndex<kSize>::Clear(void)
+{
+    for (Entry &entry : mEntries)
+    {
+        entry.mMessage = nullptr;
+    }
+
+    mNumEntries   = 0;
+    mNumUnindexed = 0;
+}
+
+template <uint16_t kSize> void CoapBase::MessageIndex<kSize>::Add(Message &aMessage, uint16_t aKey)
+{
+    uint16_t slot = SlotFor(aKey);
+
+    if (mNumEntries >= kMaxEntries)
+    {
+        mNumUnindexed++;
+        ExitNow();
+    }
+
+    while (mEntries[slot].mMessage != nullptr)
+    {
+        slot = NextSlot(slot);
+    }
+
+    mEntries[slot].mMessage = &aMessage;
+    mEntries[slot].mKey     = aKey;
+    mNumEntries++;
+
+exit:
+    return;
+}
+
+template <uint16_t kSize> void CoapBase::MessageIndex<kSize>::Remove(const Message &aMessage, uint16_t aKey)
+{
+    // Removes the entry and then shifts back any following entries
+    // in the same probe sequence which can no longer be reached
+    // from their home slot because of the new empty slot.
+
+    uint16_t hole = SlotFor(aKey);
+
+    while ((mEntries[hole].mMessage != nullptr) && (mEntries[hole].mMessage != &aMessage))
+    {
+        hole = NextSlot(hole);
+    }
+
+    if (mEntries[hole].mMessage == nullptr)
+    {
+        OT_ASSERT(mNumUnindexed > 0);
+        mNumUnindexed--;
+        ExitNow();
+    }
+
+    mEntries[hole].mMessage = nullptr;
+    mNumEntries--;
+
+    for (uint16_t slot = NextSlot(hole); mEntries[slot].mMessage != nullptr; slot = NextSlot(slot))
+    {
+        uint16_t home = SlotFor(mEntries[slot].mKey);
+
+        if ((Distance(hole, home) == 0) || (Distance(hole, home) > Distance(hole, slot)))
+        {
+            mEntries[hole]          = mEntries[slot];
+            mEntries[slot].mMessage = nullptr;
+            hole                    = slot;
+        }
+    }
+
+exit:
+    return;
+}
+
+template <uint16_t kSize> uint16_t CoapBase::MessageIndex<kSize>::FindFrom(uint16_t aSlot, uint16_t aKey) const
+{
+    uint16_t match = kNotFound;
+
+    for (uint16_t slot = aSlot; mEntries[slot].mMessage != nullptr; slot = NextSlot(slot))
+    {
+        if (mEntries[slot].mKey == aKey)
+        {
+            match = slot;
+            break;
+        }
+    }
+
+    return match;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // CoapBase::PendingRequests
 
@@ -1537,6 +1695,9 @@ CoapBase::PendingRequests::PendingRequests(Instance &aInstance, CoapBase &aCoapB
     : mCoapBase(aCoapBase)
     , mDispatchingRequest(nullptr)
     , mTimer(aInstance, HandleTimer, this)
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    , mHasDeferred(false)
+#endif
 {
 }
 
@@ -1550,6 +1711,10 @@ Error CoapBase::PendingRequests::Add(const Msg           &aTxMsg,
 
     aRequest.mMetadata.Init(aTxMsg, aTxParams, aCallbacks);
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    ApplyCongestionControl(aTxMsg, aTxParams, aRequest);
+#endif
+
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
     SuccessOrExit(error = ProcessObserveSend(aTxMsg, aRequest));
 #endif
@@ -1565,7 +1730,7 @@ Error CoapBase::PendingRequests::Add(const Msg           &aTxMsg,
 
     SuccessOrExit(error = aRequest.AppendMetadataToMessage());
 
-    mRequestMessages.Enqueue(*aRequest.mMessage);
+    Enqueue(*aRequest.mMessage);
 
     mTimer.FireAtIfEarlier(aRequest.GetTimerFireTime());
 
@@ -1577,7 +1742,8 @@ exit:
 void CoapBase::PendingRequests::Remove(Request &aRequest)
 {
     VerifyOrExit(aRequest.HasMessage());
-    mRequestMessages.DequeueAndFree(*aRequest.mMessage);
+    Dequeue(*aRequest.mMessage);
+    aRequest.mMessage->Free();
     aRequest.Clear();
 
 exit:
@@ -1586,34 +1752,43 @@ exit:
 
 Error CoapBase::PendingRequests::FindRelatedRequest(const Msg &aMsg, Request &aRequest)
 {
-    Error error = kErrorNotFound;
+    // An ack or reset is matched by message ID, a (non-)confirmable
+    // response by token. The candidates are looked up from the
+    // corresponding index. The peer is checked on each candidate
+    // rather than being part of the key since a request sent to a
+    // multicast or anycast address accepts a response from any
+    // peer.
 
-    for (Message &message : mRequestMessages)
+    Error               error = kErrorNotFound;
+    const RequestIndex *index;
+    uint16_t            key;
+
+    if ((aMsg.GetType() == kTypeAck) || (aMsg.GetType() == kTypeReset))
+    {
+        index = &mMessageIdIndex;
+        key   = aMsg.GetMessageId();
+    }
+    else
     {
-        aRequest.InitFrom(message);
+        index = &mTokenIndex;
+        key   = TokenKeyFor(aMsg.GetToken());
+    }
 
-        if (aRequest.HasSamePeerAddrAndPort(aMsg.mMessageInfo) || aRequest.GetDestinationAddress().IsMulticast() ||
-            aRequest.GetDestinationAddress().GetIid().IsAnycastLocator())
+    for (uint16_t slot = index->FindFirst(key); slot != RequestIndex::kNotFound; slot = index->FindNext(slot, key))
+    {
+        if (IsRelated(aMsg, index->GetMessage(slot), aRequest))
         {
-            switch (aMsg.GetType())
-            {
-            case kTypeReset:
-            case kTypeAck:
-                if (aMsg.GetMessageId() == message.ReadMessageId())
-                {
-                    ExitNow(error = kErrorNone);
-                }
-
-                break;
-
-            case kTypeConfirmable:
-            case kTypeNonConfirmable:
-                if (aMsg.mMessage.HasSameTokenAs(message))
-                {
-                    ExitNow(error = kErrorNone);
-                }
+            ExitNow(error = kErrorNone);
+        }
+    }
 
-                break;
+    if (index->HasUnindexed())
+    {
+        for (Message &message : mRequestMessages)
+        {
+            if (IsRelated(aMsg, message, aRequest))
+            {
+                ExitNow(error = kErrorNone);
             }
         }
     }
@@ -1624,6 +1799,79 @@ exit:
     return error;
 }
 
+bool CoapBase::PendingRequests::IsRelated(const Msg &aMsg, Message &aMessage, Request &aRequest)
+{
+    bool isRelated = false;
+
+    switch (aMsg.GetType())
+    {
+    case kTypeReset:
+    case kTypeAck:
+        VerifyOrExit(aMsg.GetMessageId() == aMessage.ReadMessageId());
+        break;
+
+    case kTypeConfirmable:
+    case kTypeNonConfirmable:
+        VerifyOrExit(aMsg.mMessage.HasSameTokenAs(aMessage));
+        break;
+    }
+
+    aRequest.InitFrom(aMessage);
+
+    isRelated = aRequest.HasSamePeerAddrAndPort(aMsg.mMessageInfo) || aRequest.GetDestinationAddress().IsMulticast() ||
+                aRequest.GetDestinationAddress().GetIid().IsAnycastLocator();
+
+exit:
+    return isRelated;
+}
+
+void CoapBase::PendingRequests::Enqueue(Message &aMessage)
+{
+    mRequestMessages.Enqueue(aMessage);
+    mMessageIdIndex.Add(aMessage, aMessage.ReadMessageId());
+    mTokenIndex.Add(aMessage, TokenKeyFor(aMessage));
+}
+
+void CoapBase::PendingRequests::Dequeue(Message &aMessage)
+{
+    mRequestMessages.Dequeue(aMessage);
+    mMessageIdIndex.Remove(aMessage, aMessage.ReadMessageId());
+    mTokenIndex.Remove(aMessage, TokenKeyFor(aMessage));
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    // An exchange may have completed, so let the timer check whether
+    // a deferred request can now be started.
+    if (mHasDeferred)
+    {
+        mTimer.FireAtIfEarlier(TimerMilli::GetNow());
+    }
+#endif
+}
+
+uint16_t CoapBase::PendingRequests::TokenKeyFor(const Token &aToken)
+{
+    uint16_t key = 0;
+
+    for (uint8_t index = 0; index < aToken.GetLength(); index++)
+    {
+        key = static_cast<uint16_t>(key * 31 + aToken.GetBytes()[index]);
+    }
+
+    return key;
+}
+
+uint16_t CoapBase::PendingRequests::TokenKeyFor(const Message &aMessage)
+{
+    Token token;
+
+    if (aMessage.ReadToken(token) != kErrorNone)
+    {
+        token.Clear();
+    }
+
+    return TokenKeyFor(token);
+}
+
 void CoapBase::PendingRequests::FinalizeRequest(Request &aRequest, Error aResult)
 {
     FinalizeRequest(aRequest, aResult, /* aResponse */ nullptr);
@@ -1633,7 +1881,7 @@ void CoapBase::PendingRequests::FinalizeRequest(Request &aRequest, Error aResult
 {
     VerifyOrExit(aRequest.HasMessage());
 
-    mRequestMessages.Dequeue(*aRequest.mMessage);
+    Dequeue(*aRequest.mMessage);
 
     DispatchResponse(aRequest, aResult, aResponse);
 
@@ -1704,7 +1952,7 @@ Error CoapBase::PendingRequests::AbortAllMatching(const Matcher &aMatcher)
 
         if (aMatcher.Matches(request))
         {
-            mRequestMessages.Dequeue(message);
+            Dequeue(message);
             abortedMessages.Enqueue(message);
             error = kErrorNone;
         }
@@ -1771,17 +2019,32 @@ void CoapBase::PendingRequests::HandleTimer(void)
         }
 #endif
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        if (request.IsDeferred())
+        {
+            // Deferred requests are started by `StartDeferredRequests()`.
+            continue;
+        }
+#endif
+
         if (nextTime.GetNow() >= request.GetTimerFireTime())
         {
             if (!request.ShouldRetransmit())
             {
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+                if (request.IsCongestionControlled() && !request.IsAcknowledged())
+                {
+                    mCoapBase.mCongestionControl->HandleTimeout(request.GetDestinationAddress());
+                }
+#endif
+
                 // We move the expired request to a separate queue to
                 // finalize it after the loop. This ensures that the
                 // iterator over `mRequestMessages` remains valid
                 // even if the user callback (invoked during
                 // finalization) modifies any pending requests
 
-                mRequestMessages.Dequeue(message);
+                Dequeue(message);
                 expiredMessages.Enqueue(message);
                 continue;
             }
@@ -1797,11 +2060,138 @@ void CoapBase::PendingRequests::HandleTimer(void)
         nextTime.UpdateIfEarlier(request.GetTimerFireTime());
     }
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    StartDeferredRequests(nextTime);
+#endif
+
     mTimer.FireAt(nextTime);
 
     FinalizeRemovedRequestsIn(expiredMessages, kErrorResponseTimeout);
 }
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
+void CoapBase::PendingRequests::ApplyCongestionControl(const Msg          &aTxMsg,
+                                                       const TxParameters &aTxParams,
+                                                       Request            &aRequest)
+{
+    // Only confirmable unicast requests using the default parameters
+    // are subject to congestion control. A request is deferred when
+    // `kNstart` exchanges with the peer are already outstanding.
+
+    CongestionControl  *congestionControl = mCoapBase.mCongestionControl;
+    const Ip6::Address &peer              = aRequest.GetDestinationAddress();
+
+    VerifyOrExit(congestionControl != nullptr);
+    VerifyOrExit(aTxMsg.IsConfirmable() && (&aTxParams == &TxParameters::GetDefault()));
+    VerifyOrExit(!peer.IsMulticast());
+
+    aRequest.mMetadata.mCongestionControlled = true;
+
+    if (CountOutstanding(peer) >= CongestionControl::kNstart)
+    {
+        aRequest.mMetadata.mDeferred = true;
+        mHasDeferred                 = true;
+        congestionControl->HandleDeferred(peer);
+        ExitNow();
+    }
+
+    StartExchange(aRequest, TimerMilli::GetNow());
+
+exit:
+    return;
+}
+
+void CoapBase::PendingRequests::StartExchange(Request &aRequest, TimeMilli aNow)
+{
+    Request::Metadata &metadata = aRequest.mMetadata;
+
+    metadata.mRetxTimeout =
+        mCoapBase.mCongestionControl->DetermineInitialRto(metadata.mDestinationAddress, metadata.mBackoffFactor);
+    metadata.mFirstTxTime   = aNow;
+    metadata.mTimerFireTime = aNow + metadata.mRetxTimeout;
+}
+
+uint8_t CoapBase::PendingRequests::CountOutstanding(const Ip6::Address &aPeer) const
+{
+    uint8_t count = 0;
+
+    for (const Message &message : mRequestMessages)
+    {
+        Request::Metadata metadata;
+
+        metadata.ReadFrom(message);
+
+        if (metadata.mCongestionControlled && !metadata.mDeferred && !metadata.mAcknowledged &&
+            (metadata.mDestinationAddress == aPeer))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void CoapBase::PendingRequests::StartDeferredRequests(NextFireTime &aNextTime)
+{
+    VerifyOrExit(mHasDeferred);
+
+    mHasDeferred = false;
+
+    for (Message &message : mRequestMessages)
+    {
+        Request request;
+
+        request.InitFrom(message);
+
+        if (!request.IsDeferred())
+        {
+            continue;
+        }
+
+        if (CountOutstanding(request.GetDestinationAddress()) >= CongestionControl::kNstart)
+        {
+            mHasDeferred = true;
+            continue;
+        }
+
+        request.mMetadata.mDeferred = false;
+        StartExchange(request, aNextTime.GetNow());
+        request.WriteMetadataInMessage();
+
+        RetransmitRequest(request);
+
+        aNextTime.UpdateIfEarlier(request.GetTimerFireTime());
+    }
+
+exit:
+    return;
+}
+
+void CoapBase::PendingRequests::HandleAcknowledgment(const Request &aRequest)
+{
+    // The first acknowledgment of a congestion controlled request
+    // provides an RTT sample (measured from its first transmission)
+    // and completes the exchange, so a deferred request may start.
+
+    TimeMilli now = TimerMilli::GetNow();
+
+    VerifyOrExit(aRequest.IsCongestionControlled() && !aRequest.IsDeferred() && !aRequest.IsAcknowledged());
+
+    mCoapBase.mCongestionControl->HandleRttSample(aRequest.GetDestinationAddress(),
+                                                  now - aRequest.mMetadata.mFirstTxTime, aRequest.mMetadata.mNumTx);
+
+    if (mHasDeferred)
+    {
+        mTimer.FireAtIfEarlier(now);
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // CoapBase::PendingRequests::Matcher
 
@@ -1862,26 +2252,49 @@ const Message *CoapBase::ResponseCache::FindMatching(const Msg &aRxMsg) const
 {
     const Message *match        = nullptr;
     uint16_t       requestMsgId = aRxMsg.GetMessageId();
+    uint16_t       key          = KeyFor(requestMsgId, aRxMsg.mMessageInfo);
 
-    for (const Message &response : mResponses)
+    // The index can hold all cached responses (`kIndexSize` is twice
+    // `kMaxCacheSize`) so there is no need to scan `mResponses`.
+
+    for (uint16_t slot = mIndex.FindFirst(key); slot != ResponseIndex::kNotFound; slot = mIndex.FindNext(slot, key))
     {
-        if (response.ReadMessageId() == requestMsgId)
+        const Message   &response = mIndex.GetMessage(slot);
+        ResponseMetadata metadata;
+
+        if (response.ReadMessageId() != requestMsgId)
         {
-            ResponseMetadata metadata;
+            continue;
+        }
 
-            metadata.ReadFrom(response);
+        metadata.ReadFrom(response);
 
-            if (metadata.mMessageInfo.HasSamePeerAddrAndPort(aRxMsg.mMessageInfo))
-            {
-                match = &response;
-                break;
-            }
+        if (metadata.mMessageInfo.HasSamePeerAddrAndPort(aRxMsg.mMessageInfo))
+        {
+            match = &response;
+            break;
         }
     }
 
     return match;
 }
 
+uint16_t CoapBase::ResponseCache::KeyFor(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+{
+    const Ip6::Address &peerAddr = aMessageInfo.GetPeerAddr();
+
+    return aMessageId ^ aMessageInfo.GetPeerPort() ^ peerAddr.mFields.m16[6] ^ peerAddr.mFields.m16[7];
+}
+
+void CoapBase::ResponseCache::Remove(Message &aResponse)
+{
+    ResponseMetadata metadata;
+
+    metadata.ReadFrom(aResponse);
+    mIndex.Remove(aResponse, KeyFor(aResponse.ReadMessageId(), metadata.mMessageInfo));
+    mResponses.DequeueAndFree(aResponse);
+}
+
 void CoapBase::ResponseCache::Add(const Msg &aTxMsg, uint32_t aExchangeLifetime)
 {
     // Adds a clone of the `aTxMsg` to the cache if a matching
@@ -1903,6 +2316,7 @@ void CoapBase::ResponseCache::Add(const Msg &aTxMsg, uint32_t aExchangeLifetime)
     SuccessOrExit(metadata.AppendTo(*responseClone));
 
     mResponses.Enqueue(*responseClone);
+    mIndex.Add(*responseClone, KeyFor(responseClone->ReadMessageId(), metadata.mMessageInfo));
     responseClone = nullptr;
 
     mTimer.FireAtIfEarlier(metadata.mExpireTime);
@@ -1937,13 +2351,14 @@ void CoapBase::ResponseCache::MaintainCacheSize(void)
 
     if (count >= kMaxCacheSize)
     {
-        mResponses.DequeueAndFree(*msgToRemove);
+        Remove(*msgToRemove);
     }
 }
 
 void CoapBase::ResponseCache::RemoveAll(void)
 {
     mResponses.DequeueAndFreeAll();
+    mIndex.Clear();
     mTimer.Stop();
 }
 
@@ -1964,7 +2379,7 @@ void CoapBase::ResponseCache::HandleTimer(void)
 
         if (expireTime.GetNow() >= metadata.mExpireTime)
         {
-            mResponses.DequeueAndFree(response);
+            Remove(response);
         }
         else
         {
@@ -1975,6 +2390,52 @@ void CoapBase::ResponseCache::HandleTimer(void)
     mTimer.FireAt(expireTime);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// CoapBase::ResourceTable
+
+void CoapBase::ResourceTable::Add(Resource &aResource)
+{
+    SuccessOrExit(mBuckets[BucketFor(aResource.GetUriPath())].Add(aResource));
+    mNumResources++;
+
+exit:
+    return;
+}
+
+void CoapBase::ResourceTable::Remove(Resource &aResource)
+{
+    SuccessOrExit(mBuckets[BucketFor(aResource.GetUriPath())].Remove(aResource));
+    mNumResources--;
+
+exit:
+    return;
+}
+
+const Resource *CoapBase::ResourceTable::Find(const char *aUriPath) const
+{
+    const Resource *match = nullptr;
+
+    for (const Resource &resource : mBuckets[BucketFor(aUriPath)])
+    {
+        if (StringMatch(resource.GetUriPath(), aUriPath))
+        {
+            match = &resource;
+            break;
+        }
+    }
+
+    return match;
+}
+
+uint16_t CoapBase::ResourceTable::BucketFor(const char *aUriPath)
+{
+    Fnv1aHash hash;
+
+    hash.AddString(aUriPath);
+
+    return static_cast<uint16_t>(hash.GetHash() % kNumBuckets);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // TxParameters
 
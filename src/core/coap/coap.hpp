@@ -34,6 +34,7 @@
 #include <openthread/coap.h>
 
 #include "coap/coap_message.hpp"
+#include "coap/congestion_control.hpp"
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
 #include "common/debug.hpp"
@@ -42,6 +43,7 @@
 #include "common/message.hpp"
 #include "common/message_allocator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/owned_ptr.hpp"
 #include "common/timer.hpp"
 #include "net/ip6.hpp"
@@ -753,17 +755,17 @@ protected:
     /**
      * Defines function pointer to handle a CoAP resource.
      *
-     * When processing a received request, this handler is called first with the URI path before checking the list of
-     * added `Resource` entries to match against the URI path.
+     * When processing a received request, this handler is called first with the URI (decoded directly from the Uri-Path
+     * options) before checking the added `Resource` entries to match against the URI path.
      *
      * @param[in] aCoapBase     A reference the CoAP agent.
-     * @param[in] aUriPath      The URI Path string.
+     * @param[in] aUri          The URI, or `kUriUnknown` if the URI path does not match any Thread URI.
      * @param[in] aRxMsg        The received message
      *
-     * @retval TRUE   Indicates that the URI path was known and the message was processed by the handler.
-     * @retval FALSE  Indicates that URI path was not known and the message was not processed by the handler.
+     * @retval TRUE   Indicates that the URI was known and the message was processed by the handler.
+     * @retval FALSE  Indicates that URI was not known and the message was not processed by the handler.
      */
-    typedef bool (*ResourceHandler)(CoapBase &aCoapBase, const char *aUriPath, Msg &aRxMsg);
+    typedef bool (*ResourceHandler)(CoapBase &aCoapBase, Uri aUri, Msg &aRxMsg);
 
     /**
      * Represents a function reference used to pass a prepared CoAP message to the transport layer for transmission.
@@ -801,6 +803,15 @@ protected:
      */
     void SetResourceHandler(ResourceHandler aHandler) { mResourceHandler = aHandler; }
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    /**
+     * Sets the congestion control used for confirmable requests with default transmission parameters.
+     *
+     * @param[in] aCongestionControl   The congestion control (per-peer RTO estimation and NSTART limit).
+     */
+    void SetCongestionControl(CongestionControl &aCongestionControl) { mCongestionControl = &aCongestionControl; }
+#endif
+
 private:
     static constexpr uint16_t kMaxBlockSize = OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH;
 
@@ -824,6 +835,50 @@ private:
 #endif
     };
 
+    template <uint16_t kSize> class MessageIndex
+    {
+        // A fixed-size hash index of the messages in a queue keyed by
+        // a 16-bit key (open addressing with linear probing). Only up
+        // to three quarters of the slots are used so that probing
+        // always ends at an empty slot. Messages added while the index
+        // is full are only counted, and a caller which finds no match
+        // in the index falls back to scanning the queue if there are
+        // any such unindexed messages.
+
+    public:
+        static constexpr uint16_t kNotFound = NumericLimits<uint16_t>::kMax;
+
+        MessageIndex(void) { Clear(); }
+
+        void     Clear(void);
+        void     Add(Message &aMessage, uint16_t aKey);
+        void     Remove(const Message &aMessage, uint16_t aKey);
+        uint16_t FindFirst(uint16_t aKey) const { return FindFrom(SlotFor(aKey), aKey); }
+        uint16_t FindNext(uint16_t aSlot, uint16_t aKey) const { return FindFrom(NextSlot(aSlot), aKey); }
+        Message &GetMessage(uint16_t aSlot) const { return *mEntries[aSlot].mMessage; }
+        bool     HasUnindexed(void) const { return mNumUnindexed > 0; }
+
+    private:
+        static constexpr uint16_t kMaxEntries = kSize * 3 / 4;
+
+        static_assert(kSize >= 2, "MessageIndex size must be at least 2");
+
+        struct Entry
+        {
+            Message *mMessage;
+            uint16_t mKey;
+        };
+
+        static uint16_t SlotFor(uint16_t aKey) { return aKey % kSize; }
+        static uint16_t NextSlot(uint16_t aSlot) { return (aSlot + 1) % kSize; }
+        static uint16_t Distance(uint16_t aFrom, uint16_t aTo) { return (aTo + kSize - aFrom) % kSize; }
+        uint16_t        FindFrom(uint16_t aSlot, uint16_t aKey) const;
+
+        Entry    mEntries[kSize];
+        uint16_t mNumEntries;
+        uint16_t mNumUnindexed;
+    };
+
     class PendingRequests;
 
     class Request
@@ -841,6 +896,10 @@ private:
         bool ShouldRetransmit(void) const;
         void UpdateRetxCounterAndTimeout(TimeMilli aNow);
         bool HasResponseHandler(void) const { return GetCallbacks().HasResponseHandler(); }
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        bool IsCongestionControlled(void) const { return mMetadata.mCongestionControlled; }
+        bool IsDeferred(void) const { return mMetadata.mDeferred; }
+#endif
 
         const Message       &GetMessage(void) const { return *mMessage; }
         const Ip6::Address  &GetSourceAddress(void) const { return mMetadata.mSourceAddress; }
@@ -887,6 +946,13 @@ private:
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
             bool mObserve : 1;
             bool mIsRequest : 1;
+#endif
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+            bool      mCongestionControlled : 1;
+            bool      mDeferred : 1;
+            uint8_t   mNumTx;
+            uint8_t   mBackoffFactor;
+            TimeMilli mFirstTxTime;
 #endif
         };
 
@@ -913,8 +979,15 @@ private:
         void  DispatchResponse(Request &aRequest, Error aResult);
         Error GetDispatchingRequest(OwnedPtr<Message> &aMessage) const;
         void  GetInfo(MessageQueue::Info &aInfo) const { mRequestMessages.GetInfo(aInfo); }
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        void HandleAcknowledgment(const Request &aRequest);
+#endif
 
     private:
+        static constexpr uint16_t kIndexSize = OPENTHREAD_CONFIG_COAP_PENDING_REQUESTS_INDEX_SIZE;
+
+        using RequestIndex = MessageIndex<kIndexSize>;
+
         class Matcher
         {
         public:
@@ -940,6 +1013,8 @@ private:
             void               *mContext;
         };
 
+        void        Enqueue(Message &aMessage);
+        void        Dequeue(Message &aMessage);
         Error       AbortAllMatching(const Matcher &aMatcher);
         void        FinalizeRemovedRequestsIn(MessageQueue &aQueue, Error aResult);
         void        RetransmitRequest(const Request &aRequest);
@@ -948,11 +1023,26 @@ private:
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
         Error ProcessObserveSend(const Msg &aTxMsg, Request &aRequest);
 #endif
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        void    ApplyCongestionControl(const Msg &aTxMsg, const TxParameters &aTxParams, Request &aRequest);
+        void    StartExchange(Request &aRequest, TimeMilli aNow);
+        uint8_t CountOutstanding(const Ip6::Address &aPeer) const;
+        void    StartDeferredRequests(NextFireTime &aNextTime);
+#endif
+
+        static bool     IsRelated(const Msg &aMsg, Message &aMessage, Request &aRequest);
+        static uint16_t TokenKeyFor(const Token &aToken);
+        static uint16_t TokenKeyFor(const Message &aMessage);
 
         CoapBase         &mCoapBase;
         MessageQueue      mRequestMessages;
+        RequestIndex      mMessageIdIndex;
+        RequestIndex      mTokenIndex;
         const Request    *mDispatchingRequest;
         TimerMilliContext mTimer;
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        bool mHasDeferred;
+#endif
     };
 
     class ResponseCache
@@ -967,26 +1057,57 @@ private:
 
     private:
         static constexpr uint16_t kMaxCacheSize = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+        static constexpr uint16_t kIndexSize    = 2 * kMaxCacheSize;
 
         static_assert(kMaxCacheSize != 0, "kMaxCacheSize MUST be non-zero");
 
+        using ResponseIndex = MessageIndex<kIndexSize>;
+
         struct ResponseMetadata : public Message::FooterData<ResponseMetadata>
         {
             TimeMilli        mExpireTime;
             Ip6::MessageInfo mMessageInfo;
         };
 
-        const Message *FindMatching(const Msg &aRxMsg) const;
-        void           MaintainCacheSize(void);
-        static void    HandleTimer(Timer &aTimer);
-        void           HandleTimer(void);
+        const Message  *FindMatching(const Msg &aRxMsg) const;
+        void            MaintainCacheSize(void);
+        void            Remove(Message &aResponse);
+        static uint16_t KeyFor(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
+        static void     HandleTimer(Timer &aTimer);
+        void            HandleTimer(void);
 
         MessageQueue      mResponses;
+        ResponseIndex     mIndex;
         TimerMilliContext mTimer;
     };
 
+    class ResourceTable
+    {
+    public:
+        ResourceTable(void)
+            : mNumResources(0)
+        {
+        }
+
+        bool            IsEmpty(void) const { return (mNumResources == 0); }
+        void            Add(Resource &aResource);
+        void            Remove(Resource &aResource);
+        const Resource *Find(const char *aUriPath) const;
+
+    private:
+        static constexpr uint16_t kNumBuckets = OPENTHREAD_CONFIG_COAP_RESOURCE_TABLE_SIZE;
+
+        static_assert(kNumBuckets != 0, "kNumBuckets MUST be non-zero");
+
+        static uint16_t BucketFor(const char *aUriPath);
+
+        LinkedList<Resource> mBuckets[kNumBuckets];
+        uint16_t             mNumResources;
+    };
+
     Message *InitMessage(Message *aMessage, Type aType, Uri aUri);
     Message *InitResponse(Message *aMessage, const Message &aRequest);
+    bool     HasResources(void) const;
     bool     InvokeResponseFallback(Msg &aRxMsg) const;
     void     ProcessReceivedRequest(Msg &aRxMsg);
     void     ProcessReceivedResponse(Msg &aRxMsg);
@@ -1018,13 +1139,16 @@ private:
 
     PendingRequests            mPendingRequests;
     ResponseCache              mResponseCache;
-    LinkedList<Resource>       mResources;
+    ResourceTable              mResources;
     Callback<Interceptor>      mInterceptor;
     Callback<RequestHandler>   mDefaultHandler;
     Callback<ResponseFallback> mResponseFallback;
     ResourceHandler            mResourceHandler;
     Transmitter                mTransmitter;
     uint16_t                   mMessageId;
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    CongestionControl *mCongestionControl;
+#endif
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     LinkedList<ResourceBlockWise> mBlockWiseResources;
     Message                      *mLastResponse;
@@ -423,6 +423,55 @@ exit:
     return error;
 }
 
+Error Message::ReadUri(Uri &aUri) const
+{
+    char             uriPath[kMaxUriPathLength + 1];
+    uint16_t         length = 0;
+    Error            error  = kErrorNone;
+    Option::Iterator iterator;
+
+    aUri = kUriUnknown;
+
+    SuccessOrExit(error = iterator.Init(*this, kOptionUriPath));
+
+    while (!iterator.IsDone())
+    {
+        uint16_t optionLength = iterator.GetOption()->GetLength();
+
+        if (length != 0)
+        {
+            if (length < kMaxUriPathLength)
+            {
+                uriPath[length] = '/';
+            }
+
+            length++;
+        }
+
+        VerifyOrExit(length + optionLength <= kMaxReceivedUriPath, error = kErrorParse);
+
+        // Option values that do not fit are skipped; the URI
+        // is then known not to match any Thread URI path.
+
+        if (length + optionLength <= kMaxUriPathLength)
+        {
+            IgnoreError(iterator.ReadOptionValue(&uriPath[length]));
+        }
+
+        length += optionLength;
+
+        SuccessOrExit(error = iterator.Advance(kOptionUriPath));
+    }
+
+    VerifyOrExit(length <= kMaxUriPathLength);
+    uriPath[length] = kNullChar;
+
+    aUri = UriFromPath(uriPath);
+
+exit:
+    return error;
+}
+
 Error Message::AppendUriQueryOptions(const char *aUriQuery)
 {
     Error       error = kErrorNone;
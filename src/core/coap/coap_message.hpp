@@ -698,6 +698,19 @@ public:
      */
     Error ReadUriPathOptions(UriPathStringBuffer &aUriPath) const;
 
+    /**
+     * Reads the Uri-Path options and decodes them as a Thread URI.
+     *
+     * Unlike `ReadUriPathOptions()`, the full URI path string is not constructed. Only up to `kMaxUriPathLength`
+     * characters are read from the Uri-Path options and matched against the known Thread URI paths.
+     *
+     * @param[out] aUri   A reference to output the URI, or `kUriUnknown` if the path does not match any Thread URI.
+     *
+     * @retval  kErrorNone   Successfully read the Uri-Path options.
+     * @retval  kErrorParse  CoAP Option header not well-formed, or the URI path is longer than `kMaxReceivedUriPath`.
+     */
+    Error ReadUri(Uri &aUri) const;
+
     /**
      * Appends a Uri-Query option.
      *
@@ -0,0 +1,296 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements CoAP congestion control (CoCoA).
+ */
+
+#include "congestion_control.hpp"
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
+#include "instance/instance.hpp"
+
+namespace ot {
+namespace Coap {
+
+CongestionControl::CongestionControl(void) { Clear(); }
+
+void CongestionControl::Clear(void)
+{
+    for (Peer &peer : mPeers)
+    {
+        peer.Clear();
+    }
+}
+
+uint32_t CongestionControl::DetermineInitialRto(const Ip6::Address &aPeer, uint8_t &aBackoffFactor)
+{
+    Peer     &peer = FindOrAllocatePeer(aPeer);
+    TimeMilli now  = TimerMilli::GetNow();
+    uint32_t  rto;
+
+    peer.AgeRto(now);
+    peer.mLastUseTime = now;
+
+    // Randomize in `[RTO, 1.5 * RTO]` (ACK_RANDOM_FACTOR).
+    rto = Random::NonCrypto::GenerateInClosedRange<uint32_t>(peer.mRto, peer.mRto + peer.mRto / 2);
+
+    // Variable backoff factor: larger when the initial RTO is small, so
+    // that a spuriously small estimate quickly backs off, and smaller
+    // when it is large to avoid excessive delays.
+
+    if (rto < kLowRto)
+    {
+        aBackoffFactor = kLowRtoBackoff;
+    }
+    else if (rto > kHighRto)
+    {
+        aBackoffFactor = kHighRtoBackoff;
+    }
+    else
+    {
+        aBackoffFactor = kBackoff;
+    }
+
+    return rto;
+}
+
+void CongestionControl::HandleRttSample(const Ip6::Address &aPeer, uint32_t aRtt, uint8_t aNumTx)
+{
+    Peer *peer;
+
+    VerifyOrExit(aNumTx > 0 && aNumTx <= kMaxWeakNumTx);
+
+    peer = &FindOrAllocatePeer(aPeer);
+
+    if (aNumTx == 1)
+    {
+        // Strong sample: RTO = 1/2 * RTO_strong + 1/2 * RTO
+        peer->UpdateRto(peer->mStrong.Update(aRtt, kStrongK), 2);
+    }
+    else
+    {
+        // Weak sample: RTO = 1/4 * RTO_weak + 3/4 * RTO
+        peer->UpdateRto(peer->mWeak.Update(aRtt, kWeakK), 4);
+    }
+
+exit:
+    return;
+}
+
+void CongestionControl::HandleTimeout(const Ip6::Address &aPeer)
+{
+    // Only count against a peer already in the table, so that
+    // recording an event never evicts another peer's estimate.
+
+    Peer *peer = FindPeer(aPeer);
+
+    VerifyOrExit(peer != nullptr);
+    peer->mNumTimeouts++;
+
+exit:
+    return;
+}
+
+void CongestionControl::HandleDeferred(const Ip6::Address &aPeer)
+{
+    Peer *peer = FindPeer(aPeer);
+
+    VerifyOrExit(peer != nullptr);
+    peer->mNumDeferred++;
+
+exit:
+    return;
+}
+
+uint32_t CongestionControl::CalculateBackoff(uint32_t aTimeout, uint8_t aBackoffFactor)
+{
+    return Min<uint32_t>(aTimeout * aBackoffFactor / 2, kMaxRto);
+}
+
+Error CongestionControl::GetNextPeerInfo(Iterator &aIterator, PeerInfo &aInfo) const
+{
+    Error error = kErrorNotFound;
+
+    for (; aIterator < kMaxPeers; aIterator++)
+    {
+        const Peer &peer = mPeers[aIterator];
+
+        if (!peer.mInUse)
+        {
+            continue;
+        }
+
+        aInfo.Clear();
+        AsCoreType(&aInfo.mPeerAddress) = peer.mAddress;
+        aInfo.mRto                      = peer.mRto;
+        aInfo.mStrongRtt                = peer.mStrong.mRtt;
+        aInfo.mStrongRttVar             = peer.mStrong.mRttVar;
+        aInfo.mWeakRtt                  = peer.mWeak.mRtt;
+        aInfo.mWeakRttVar               = peer.mWeak.mRttVar;
+        aInfo.mNumStrongSamples         = peer.mStrong.mNumSamples;
+        aInfo.mNumWeakSamples           = peer.mWeak.mNumSamples;
+        aInfo.mNumTimeouts              = peer.mNumTimeouts;
+        aInfo.mNumDeferred              = peer.mNumDeferred;
+
+        aIterator++;
+        error = kErrorNone;
+        break;
+    }
+
+    return error;
+}
+
+CongestionControl::Peer *CongestionControl::FindPeer(const Ip6::Address &aAddress)
+{
+    Peer *match = nullptr;
+
+    for (Peer &peer : mPeers)
+    {
+        if (peer.mInUse && (peer.mAddress == aAddress))
+        {
+            match = &peer;
+            break;
+        }
+    }
+
+    return match;
+}
+
+CongestionControl::Peer &CongestionControl::FindOrAllocatePeer(const Ip6::Address &aAddress)
+{
+    Peer *peer = FindPeer(aAddress);
+
+    VerifyOrExit(peer == nullptr);
+
+    // Use an unused entry, or replace the least recently used one.
+
+    peer = &mPeers[0];
+
+    for (Peer &entry : mPeers)
+    {
+        if (!entry.mInUse)
+        {
+            peer = &entry;
+            break;
+        }
+
+        if (entry.mLastUseTime < peer->mLastUseTime)
+        {
+            peer = &entry;
+        }
+    }
+
+    peer->Init(aAddress, TimerMilli::GetNow());
+
+exit:
+    return *peer;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// CongestionControl::Estimator
+
+uint32_t CongestionControl::Estimator::Update(uint32_t aRtt, uint8_t aK)
+{
+    // RFC 6298 smoothing (alpha = 1/8, beta = 1/4).
+
+    if (mNumSamples == 0)
+    {
+        mRtt    = aRtt;
+        mRttVar = aRtt / 2;
+    }
+    else
+    {
+        uint32_t delta = (aRtt > mRtt) ? (aRtt - mRtt) : (mRtt - aRtt);
+
+        mRttVar = (3 * mRttVar + delta) / 4;
+        mRtt    = (7 * mRtt + aRtt) / 8;
+    }
+
+    if (mNumSamples < NumericLimits<uint16_t>::kMax)
+    {
+        mNumSamples++;
+    }
+
+    return mRtt + aK * mRttVar;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// CongestionControl::Peer
+
+void CongestionControl::Peer::Init(const Ip6::Address &aAddress, TimeMilli aNow)
+{
+    Clear();
+    mInUse          = true;
+    mAddress        = aAddress;
+    mLastUpdateTime = aNow;
+    mLastUseTime    = aNow;
+    mRto            = kDefaultRto;
+}
+
+void CongestionControl::Peer::AgeRto(TimeMilli aNow)
+{
+    // An estimate not updated for a while moves back towards the
+    // default: a small RTO is doubled after 16 * RTO, a large one is
+    // halved towards the default after 4 * RTO.
+
+    uint32_t elapsed = aNow - mLastUpdateTime;
+
+    if ((mRto < kLowRto) && (elapsed > 16 * mRto))
+    {
+        mRto = 2 * mRto;
+    }
+    else if ((mRto > kHighRto) && (elapsed > 4 * mRto))
+    {
+        mRto = (mRto + kDefaultRto) / 2;
+    }
+    else
+    {
+        ExitNow();
+    }
+
+    mLastUpdateTime = aNow;
+
+exit:
+    return;
+}
+
+void CongestionControl::Peer::UpdateRto(uint32_t aRto, uint8_t aWeight)
+{
+    // RTO = 1/aWeight * aRto + (aWeight - 1)/aWeight * RTO
+
+    mRto            = Clamp<uint32_t>((aRto + (aWeight - 1) * mRto) / aWeight, kMinRto, kMaxRto);
+    mLastUpdateTime = TimerMilli::GetNow();
+}
+
+} // namespace Coap
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
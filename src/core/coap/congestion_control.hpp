@@ -0,0 +1,206 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for CoAP congestion control (CoCoA).
+ */
+
+#ifndef OT_CORE_COAP_CONGESTION_CONTROL_HPP_
+#define OT_CORE_COAP_CONGESTION_CONTROL_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
+#include <openthread/thread.h>
+
+#include "common/as_core_type.hpp"
+#include "common/clearable.hpp"
+#include "common/error.hpp"
+#include "common/non_copyable.hpp"
+#include "common/time.hpp"
+#include "net/ip6_address.hpp"
+
+namespace ot {
+namespace Coap {
+
+/**
+ * Implements CoCoA-style congestion control (draft-ietf-core-cocoa) for a CoAP agent.
+ *
+ * Keeps an overall retransmission timeout (RTO) estimate per peer. The estimate is updated from strong RTT samples
+ * (exchanges acknowledged with no retransmission) and weak RTT samples (acknowledged after one or two
+ * retransmissions), and is aged back towards the default when not updated. The retransmission backoff factor is
+ * chosen based on the initial RTO.
+ *
+ * The limit on outstanding exchanges per peer (NSTART) is enforced by the CoAP agent, using `kNstart`.
+ */
+class CongestionControl : private NonCopyable
+{
+public:
+    static constexpr uint8_t kNstart = OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_NSTART; ///< Max outstanding per peer.
+
+    static_assert(kNstart > 0, "OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_NSTART MUST be non-zero");
+
+    typedef otTmfPeerRttIterator Iterator; ///< Iterator to go over the peer table.
+
+    /**
+     * Represents the RTO state and counters of a peer.
+     */
+    class PeerInfo : public otTmfPeerRttInfo, public Clearable<PeerInfo>
+    {
+    };
+
+    /**
+     * Initializes the `CongestionControl` (with an empty peer table).
+     */
+    CongestionControl(void);
+
+    /**
+     * Clears the peer table.
+     */
+    void Clear(void);
+
+    /**
+     * Determines the initial retransmission timeout and backoff factor for a new confirmable request to a peer.
+     *
+     * The peer RTO estimate is first aged (if not updated recently) and then randomized in `[RTO, 1.5 * RTO]`.
+     *
+     * @param[in]  aPeer           The peer address.
+     * @param[out] aBackoffFactor  A reference to output the backoff factor (in units of 1/2).
+     *
+     * @returns The initial retransmission timeout (in msec).
+     */
+    uint32_t DetermineInitialRto(const Ip6::Address &aPeer, uint8_t &aBackoffFactor);
+
+    /**
+     * Updates the RTO estimate of a peer from an RTT sample.
+     *
+     * @param[in] aPeer   The peer address.
+     * @param[in] aRtt    The RTT (in msec), measured from the first transmission of the request.
+     * @param[in] aNumTx  The number of times the request was transmitted before it was acknowledged.
+     */
+    void HandleRttSample(const Ip6::Address &aPeer, uint32_t aRtt, uint8_t aNumTx);
+
+    /**
+     * Records that a confirmable request to a peer was never acknowledged.
+     *
+     * Ignored if the peer is not in the table.
+     *
+     * @param[in] aPeer   The peer address.
+     */
+    void HandleTimeout(const Ip6::Address &aPeer);
+
+    /**
+     * Records that a request to a peer was held back because `kNstart` exchanges were outstanding.
+     *
+     * Ignored if the peer is not in the table.
+     *
+     * @param[in] aPeer   The peer address.
+     */
+    void HandleDeferred(const Ip6::Address &aPeer);
+
+    /**
+     * Calculates the next retransmission timeout from the current one and a backoff factor.
+     *
+     * @param[in] aTimeout        The current retransmission timeout (in msec).
+     * @param[in] aBackoffFactor  The backoff factor (in units of 1/2).
+     *
+     * @returns The next retransmission timeout (in msec).
+     */
+    static uint32_t CalculateBackoff(uint32_t aTimeout, uint8_t aBackoffFactor);
+
+    /**
+     * Gets the next peer info from the peer table.
+     *
+     * @param[in,out] aIterator  The iterator. Set to `OT_TMF_PEER_RTT_ITERATOR_INIT` to start from the first entry.
+     * @param[out]    aInfo      A reference to output the peer info.
+     *
+     * @retval kErrorNone      Successfully got the next peer info.
+     * @retval kErrorNotFound  No more entries in the table.
+     */
+    Error GetNextPeerInfo(Iterator &aIterator, PeerInfo &aInfo) const;
+
+private:
+    static constexpr uint16_t kMaxPeers = OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_MAX_PEERS;
+
+    static constexpr uint32_t kDefaultRto     = 2000;  // ACK_TIMEOUT (RFC 7252)
+    static constexpr uint32_t kMinRto         = 500;   // Lower bound on the overall RTO
+    static constexpr uint32_t kMaxRto         = 32000; // Upper bound on the overall RTO and retx timeouts
+    static constexpr uint32_t kLowRto         = 1000;  // Below: backoff factor 3, aged after 16 * RTO
+    static constexpr uint32_t kHighRto        = 3000;  // Above: backoff factor 1.5, aged after 4 * RTO
+    static constexpr uint8_t  kStrongK        = 4;     // RTTVAR multiplier for strong samples
+    static constexpr uint8_t  kWeakK          = 1;     // RTTVAR multiplier for weak samples
+    static constexpr uint8_t  kMaxWeakNumTx   = 3;     // Weak samples accepted up to two retransmissions
+    static constexpr uint8_t  kLowRtoBackoff  = 6;     // Backoff factors are in units of 1/2
+    static constexpr uint8_t  kBackoff        = 4;
+    static constexpr uint8_t  kHighRtoBackoff = 3;
+
+    static_assert(kMaxPeers > 0, "OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_MAX_PEERS MUST be non-zero");
+
+    struct Estimator
+    {
+        uint32_t Update(uint32_t aRtt, uint8_t aK);
+
+        uint32_t mRtt;
+        uint32_t mRttVar;
+        uint16_t mNumSamples;
+    };
+
+    struct Peer : public Clearable<Peer>
+    {
+        void Init(const Ip6::Address &aAddress, TimeMilli aNow);
+        void AgeRto(TimeMilli aNow);
+        void UpdateRto(uint32_t aRto, uint8_t aWeight);
+
+        bool         mInUse;
+        Ip6::Address mAddress;
+        TimeMilli    mLastUpdateTime;
+        TimeMilli    mLastUseTime;
+        uint32_t     mRto;
+        Estimator    mStrong;
+        Estimator    mWeak;
+        uint16_t     mNumTimeouts;
+        uint16_t     mNumDeferred;
+    };
+
+    Peer *FindPeer(const Ip6::Address &aAddress);
+    Peer &FindOrAllocatePeer(const Ip6::Address &aAddress);
+
+    Peer mPeers[kMaxPeers];
+};
+
+} // namespace Coap
+
+DefineCoreType(otTmfPeerRttInfo, Coap::CongestionControl::PeerInfo);
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
+#endif // OT_CORE_COAP_CONGESTION_CONTROL_HPP_
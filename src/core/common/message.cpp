@@ -159,7 +159,22 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
 
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority)
 {
-    return Get<MeshForwarder>().EvictMessage(aPriority, MeshForwarder::kEvictReasonNoMessageBuffer);
+    Error error;
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE && OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    // Cached DNS-SD answers are only an optimization, so they are
+    // released before evicting any queued message.
+
+    error = Get<Dns::ServiceDiscovery::Server>().ReleaseAnswerCacheEntry();
+    VerifyOrExit(error != kErrorNone);
+#endif
+
+    error = Get<MeshForwarder>().EvictMessage(aPriority, MeshForwarder::kEvictReasonNoMessageBuffer);
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE && OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+exit:
+#endif
+    return error;
 }
 
 uint16_t MessagePool::GetFreeBufferCount(void) const
@@ -592,6 +607,63 @@ exit:
     aLength -= aChunk.GetLength();
 }
 
+void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk, ReadCursor &aCursor) const
+{
+    // Same as `GetFirstChunk()` but the search for the `Buffer`
+    // matching the offset starts from the buffer remembered by
+    // `aCursor` (when possible). On exit `aCursor` is updated to
+    // the buffer containing `aOffset`.
+
+    uint16_t bufferSize;
+
+    VerifyOrExit(aOffset < GetLength(), aChunk.SetLength(0));
+
+    if (!CanAddSafely<uint16_t>(aOffset, aLength) || (aOffset + aLength >= GetLength()))
+    {
+        aLength = GetLength() - aOffset;
+    }
+
+    aOffset += GetReserved();
+
+    if ((aCursor.mMessage != this) || (aCursor.mBuffer == nullptr) || (aCursor.mBufferStart > aOffset))
+    {
+        aCursor.mMessage     = this;
+        aCursor.mBuffer      = this;
+        aCursor.mBufferStart = 0;
+    }
+
+    while (true)
+    {
+        bufferSize = (aCursor.mBuffer == this) ? kHeadBufferDataSize : kBufferDataSize;
+
+        if (aOffset - aCursor.mBufferStart < bufferSize)
+        {
+            break;
+        }
+
+        aCursor.mBufferStart += bufferSize;
+        aCursor.mBuffer = aCursor.mBuffer->GetNextBuffer();
+
+        OT_ASSERT(aCursor.mBuffer != nullptr);
+    }
+
+    aOffset -= aCursor.mBufferStart;
+
+    aChunk.SetBuffer(aCursor.mBuffer);
+    aChunk.Init(((aCursor.mBuffer == this) ? GetFirstData() : aCursor.mBuffer->GetData()) + aOffset,
+                bufferSize - aOffset);
+
+    if (aChunk.GetLength() > aLength)
+    {
+        aChunk.SetLength(aLength);
+    }
+
+    aLength -= aChunk.GetLength();
+
+exit:
+    return;
+}
+
 void Message::GetNextChunk(uint16_t &aLength, Chunk &aChunk) const
 {
     // This method gets the next message chunk. On input, the
@@ -641,6 +713,28 @@ uint16_t Message::ReadBytes(const OffsetRange &aOffsetRange, void *aBuf) const
     return ReadBytes(aOffsetRange.GetOffset(), aBuf, aOffsetRange.GetLength());
 }
 
+uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength, ReadCursor &aCursor) const
+{
+    uint8_t *bufPtr = reinterpret_cast<uint8_t *>(aBuf);
+    Chunk    chunk;
+
+    // Each `GetFirstChunk()` call advances `aCursor` to the buffer
+    // containing the given offset, so reading chunk by chunk
+    // leaves `aCursor` on the buffer where the read ended.
+
+    GetFirstChunk(aOffset, aLength, chunk, aCursor);
+
+    while (chunk.GetLength() > 0)
+    {
+        chunk.CopyBytesTo(bufPtr);
+        bufPtr += chunk.GetLength();
+        aOffset += chunk.GetLength();
+        GetFirstChunk(aOffset, aLength, chunk, aCursor);
+    }
+
+    return static_cast<uint16_t>(bufPtr - reinterpret_cast<uint8_t *>(aBuf));
+}
+
 Error Message::Read(uint16_t aOffset, void *aBuf, uint16_t aLength) const
 {
     Error error = kErrorNone;
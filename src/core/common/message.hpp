@@ -888,6 +888,49 @@ public:
      */
     uint16_t ReadBytes(const OffsetRange &aOffsetRange, void *aBuf) const;
 
+    /**
+     * Represents a read cursor into a message.
+     *
+     * A `ReadCursor` remembers the buffer (in the message's buffer chain) reached by the last read. It allows a
+     * sequence of reads at non-decreasing offsets (e.g., copying consecutive fragments of a large message) to continue
+     * from the last buffer instead of walking the buffer chain from the start of the message on every read.
+     *
+     * A `ReadCursor` MUST be cleared (or a new one used) if the message is modified in a way that changes its buffer
+     * chain (e.g., its length is changed or bytes are prepended or removed from its head).
+     */
+    class ReadCursor : public Clearable<ReadCursor>
+    {
+        friend class Message;
+
+    public:
+        /**
+         * Initializes the `ReadCursor` as cleared.
+         */
+        ReadCursor(void) { Clear(); }
+
+    private:
+        const Message *mMessage;     // The message associated with the cursor.
+        const Buffer  *mBuffer;      // The buffer reached by the last read.
+        uint16_t       mBufferStart; // The offset (including reserved bytes) of the start of `mBuffer` data.
+    };
+
+    /**
+     * Reads bytes from the message using a given `ReadCursor`.
+     *
+     * Behaves the same as `ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength)`. If @p aCursor was last used
+     * with the same message at an offset before or equal to @p aOffset, the read continues from the buffer remembered
+     * by @p aCursor. Otherwise, the buffer chain is walked from the start of the message. On exit, @p aCursor is
+     * updated to the buffer containing the end of the read bytes.
+     *
+     * @param[in]     aOffset  Byte offset within the message to begin reading.
+     * @param[out]    aBuf     A pointer to a data buffer to copy the read bytes into.
+     * @param[in]     aLength  Number of bytes to read.
+     * @param[in,out] aCursor  The read cursor.
+     *
+     * @returns The number of bytes read.
+     */
+    uint16_t ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength, ReadCursor &aCursor) const;
+
     /**
      * Reads a given number of bytes from the message.
      *
@@ -1657,6 +1700,7 @@ private:
     };
 
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const;
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk, ReadCursor &aCursor) const;
     void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
 
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, MutableChunk &aChunk)
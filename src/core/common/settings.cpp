@@ -154,11 +154,12 @@ const char *SettingsBase::KeyToString(Key aKey)
     _(kKeyBrUlaPrefix, "BrUlaPrefix")             \
     _(kKeyBrOnLinkPrefixes, "BrOnLinkPrefixes")   \
     _(kKeyBorderAgentId, "BorderAgentId")         \
-    _(kKeyTcatCommrCert, "TcatCommrCert")
+    _(kKeyTcatCommrCert, "TcatCommrCert")         \
+    _(kKeySrpServerHosts, "SrpServerHosts")
 
     DefineEnumStringArray(KeyMapList);
 
-    static_assert(kLastKey == kKeyTcatCommrCert, "kLastKey is not valid");
+    static_assert(kLastKey == kKeySrpServerHosts, "kLastKey is not valid");
 
     OT_ASSERT(aKey <= kLastKey);
 
@@ -367,6 +368,34 @@ void Settings::BrOnLinkPrefix::Log(const char *aActionText) const
 
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+Error Settings::AddSrpServerHost(const void *aData, uint16_t aLength)
+{
+    Error error = Get<SettingsDriver>().Add(kKeySrpServerHosts, aData, aLength);
+
+    if (error != kErrorNone)
+    {
+        LogWarn("Error %s adding %s", ErrorToString(error), KeyToString(kKeySrpServerHosts));
+    }
+
+    return error;
+}
+
+Error Settings::ReadSrpServerHost(int aIndex, void *aData, uint16_t &aLength) const
+{
+    return Get<SettingsDriver>().Get(kKeySrpServerHosts, aIndex, aData, &aLength);
+}
+
+Error Settings::DeleteSrpServerHost(int aIndex) { return Get<SettingsDriver>().Delete(kKeySrpServerHosts, aIndex); }
+
+void Settings::DeleteAllSrpServerHosts(void)
+{
+    Error error = Get<SettingsDriver>().Delete(kKeySrpServerHosts);
+
+    Log(kActionDelete, error, kKeySrpServerHosts);
+}
+#endif
+
 Error Settings::ReadEntry(Key aKey, void *aValue, uint16_t aMaxLength) const
 {
     Error    error;
@@ -119,9 +119,10 @@ public:
         kKeyBrOnLinkPrefixes  = OT_SETTINGS_KEY_BR_ON_LINK_PREFIXES,
         kKeyBorderAgentId     = OT_SETTINGS_KEY_BORDER_AGENT_ID,
         kKeyTcatCommrCert     = OT_SETTINGS_KEY_TCAT_COMMR_CERT,
+        kKeySrpServerHosts    = OT_SETTINGS_KEY_SRP_SERVER_HOSTS,
     };
 
-    static constexpr Key kLastKey = kKeyTcatCommrCert; ///< The last (numerically) enumerator value in `Key`.
+    static constexpr Key kLastKey = kKeySrpServerHosts; ///< The last (numerically) enumerator value in `Key`.
 
     static_assert(static_cast<uint16_t>(kLastKey) < static_cast<uint16_t>(OT_SETTINGS_KEY_VENDOR_RESERVED_MIN),
                   "Core settings keys overlap with vendor reserved keys");
@@ -1064,6 +1065,51 @@ public:
 
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    /**
+     * Adds an SRP server host entry to settings.
+     *
+     * @note SRP server hosts is a list-based settings property and can contain multiple entries. Each entry is an
+     *       opaque byte sequence encoded and decoded by the SRP server.
+     *
+     * @param[in] aData       A pointer to the host entry data.
+     * @param[in] aLength     The length of @p aData (number of bytes).
+     *
+     * @retval kErrorNone     Successfully added the entry in settings.
+     * @retval kErrorNoBufs   Ran out of space in the settings.
+     */
+    Error AddSrpServerHost(const void *aData, uint16_t aLength);
+
+    /**
+     * Retrieves an SRP server host entry at a given index.
+     *
+     * @param[in]     aIndex    The index to read.
+     * @param[out]    aData     A pointer to a buffer to output the read entry data.
+     * @param[in,out] aLength   On input, the size of @p aData. On output, the length of the entry.
+     *
+     * @retval kErrorNone       Successfully read the entry.
+     * @retval kErrorNotFound   No corresponding value in the setting store.
+     */
+    Error ReadSrpServerHost(int aIndex, void *aData, uint16_t &aLength) const;
+
+    /**
+     * Deletes an SRP server host entry at a given index.
+     *
+     * The order of the remaining entries is not guaranteed to be kept, so the index of any other entry may change.
+     *
+     * @param[in] aIndex    The index of the entry to delete.
+     *
+     * @retval kErrorNone       Successfully deleted the entry.
+     * @retval kErrorNotFound   No corresponding value in the setting store.
+     */
+    Error DeleteSrpServerHost(int aIndex);
+
+    /**
+     * Deletes all SRP server host entries from the settings.
+     */
+    void DeleteAllSrpServerHosts(void);
+#endif
+
 private:
 #if OPENTHREAD_FTD
     class ChildInfoIteratorBuilder : public InstanceLocator
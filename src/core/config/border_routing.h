@@ -162,6 +162,31 @@
 #define OPENTHREAD_CONFIG_BORDER_ROUTING_MAX_DISCOVERED_PREFIXES 64
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTER_HASH_TABLE_SIZE
+ *
+ * The number of buckets in the hash table (indexed by router address) used to find a discovered router when an RA or
+ * NA message is received.
+ *
+ * MUST be a power of two.
+ */
+#ifndef OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTER_HASH_TABLE_SIZE
+#define OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTER_HASH_TABLE_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTE_PUBLISH_MIN_INTERVAL
+ *
+ * Specifies the minimum interval (in msec) between changes to the route (e.g., "::/0" or "fc00::/7") published by
+ * routing manager in Network Data.
+ *
+ * A change after a longer interval is published immediately. Changes within the interval are coalesced and only the
+ * final route is published when the interval ends.
+ */
+#ifndef OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTE_PUBLISH_MIN_INTERVAL
+#define OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTE_PUBLISH_MIN_INTERVAL 2000
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_BORDER_ROUTING_MAX_ON_MESH_PREFIXES
  *
@@ -54,6 +54,61 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_PENDING_REQUESTS_INDEX_SIZE
+ *
+ * Number of slots in each of the hash indexes (by message ID and by token) used to match received messages with
+ * pending CoAP requests.
+ *
+ * Up to three quarters of the slots are used. Requests beyond that are still tracked and matched by scanning the
+ * pending requests queue.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_PENDING_REQUESTS_INDEX_SIZE
+#define OPENTHREAD_CONFIG_COAP_PENDING_REQUESTS_INDEX_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_RESOURCE_TABLE_SIZE
+ *
+ * Number of hash buckets used to look up the CoAP resources added to a CoAP agent by their URI path.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_RESOURCE_TABLE_SIZE
+#define OPENTHREAD_CONFIG_COAP_RESOURCE_TABLE_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+ *
+ * Define to 1 to enable CoCoA-style congestion control for the TMF agent.
+ *
+ * When enabled, the retransmission timeout (RTO) of confirmable TMF requests using the default transmission
+ * parameters is estimated per peer from strong (no retransmission) and weak (one or two retransmissions) RTT samples,
+ * and the number of outstanding exchanges with a peer is limited to `OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_NSTART`.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+#define OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_MAX_PEERS
+ *
+ * Maximum number of peers for which RTO estimation state is kept. The least recently used peer is replaced when the
+ * table is full.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_MAX_PEERS
+#define OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_MAX_PEERS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_NSTART
+ *
+ * Maximum number of outstanding confirmable exchanges with a single peer (NSTART, RFC 7252 section 4.7). Further
+ * requests to the peer are held back until an outstanding exchange is acknowledged or times out.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_NSTART
+#define OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_NSTART 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
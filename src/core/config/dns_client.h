@@ -199,6 +199,112 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_QUERY_MAX_SIZE 1024
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS client response cache.
+ *
+ * When enabled, responses received from DNS servers (including negative responses) are kept for their TTL and used to
+ * answer later queries for the same question(s) to the same server without sending a new query. A response is kept
+ * for the server which sent it. A query to the default server can also be answered by a response from one of the
+ * parallel servers (see `OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE`).
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+ *
+ * Specifies the maximum number of responses kept in the DNS client cache.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_SIZE
+ *
+ * Specifies the memory budget (in bytes) of the DNS client cache, i.e., the maximum total length of all cached
+ * response messages. Least recently used responses are evicted to stay within the budget.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_SIZE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_SIZE 2048
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+ *
+ * Specifies the maximum time (in seconds) a response is kept in the DNS client cache, independent of the TTLs of its
+ * records.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL 3600
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+ *
+ * Specifies the maximum time (in seconds) a negative response (name error or no answer) is kept in the DNS client
+ * cache. A negative response is kept for the negative caching TTL given by the SOA record in its authority section
+ * (RFC 2308), limited to this value. A negative response without an SOA record is kept for this duration.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL 30
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+ *
+ * Define to 1 to enable coalescing of identical in-flight queries in the DNS client.
+ *
+ * When enabled, a new query for the same name, type and server as a pending query joins the pending query instead of
+ * sending a new one. All joined queries are finalized (their callbacks invoked) with the same response or error.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+ *
+ * Define to 1 to enable sending DNS client queries in parallel to additional servers.
+ *
+ * When enabled, a UDP query to the default server is also sent to the configured additional servers (see
+ * `otDnsClientSetParallelServers()`) using the same message ID. The first response received from any server is used.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_MAX_SERVERS
+ *
+ * Specifies the maximum number of additional servers to which DNS client queries are sent in parallel.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_MAX_SERVERS
+#define OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_MAX_SERVERS 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+ *
+ * Define to 1 to enable tracking of per-server response latency histograms in the DNS client.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_MAX_SERVERS
+ *
+ * Specifies the maximum number of servers for which the DNS client tracks response latency. When the table is full,
+ * the entry with the fewest responses is replaced.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_MAX_SERVERS
+#define OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_MAX_SERVERS 4
+#endif
+
 /**
  * @}
  */
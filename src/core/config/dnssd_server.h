@@ -98,6 +98,87 @@
 #define OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS-SD server answer cache.
+ *
+ * The answer cache keeps the responses obtained by the Discovery Proxy (or the query subscribe callbacks) and by the
+ * upstream resolver and uses them to answer repeated queries from different clients while their TTLs are valid.
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_SIZE
+ *
+ * Specifies the maximum number of responses kept in the DNS-SD server answer cache.
+ *
+ * Each entry holds a copy of a response message. The total number of message buffers used by the cache is bounded by
+ * `OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MAX_BUFFERS`.
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_SIZE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MAX_BUFFERS
+ *
+ * Specifies the maximum number of message buffers held by all the responses in the DNS-SD server answer cache.
+ *
+ * Least recently used entries are evicted to stay within this limit. Entries are also released when the message pool
+ * runs out of buffers.
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MAX_BUFFERS
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MAX_BUFFERS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MAX_TTL
+ *
+ * Specifies the maximum time (in seconds) a response is kept in the DNS-SD server answer cache, independent of the
+ * TTLs of its records. The TTLs of the records in a response sent from the cache are also capped to the remaining
+ * lifetime of its entry.
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MAX_TTL
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MAX_TTL 3600
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_NEGATIVE_TTL
+ *
+ * Specifies the maximum time (in seconds) a negative response (name error or no answer) is kept in the DNS-SD server
+ * answer cache.
+ *
+ * A negative response is kept for the minimum of the TTL and the MINIMUM field of the SOA record in its authority
+ * section (RFC 2308), limited to this value. An upstream negative response without an SOA record is not cached.
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_NEGATIVE_TTL
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_NEGATIVE_TTL 10
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_PREFETCH_THRESHOLD
+ *
+ * Specifies the remaining lifetime (as a percentage of its TTL) below which a cached upstream response that is used
+ * to answer a query is refreshed by sending a new upstream query.
+ *
+ * Set to zero to disable prefetching.
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_PREFETCH_THRESHOLD
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_PREFETCH_THRESHOLD 10
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_PREFETCH_MIN_HITS
+ *
+ * Specifies the minimum number of cache hits before a cached upstream response is considered for prefetching.
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_PREFETCH_MIN_HITS
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_PREFETCH_MIN_HITS 2
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_MOCK_PLAT_APIS_ENABLE
  *
@@ -207,6 +207,61 @@
 #define OPENTHREAD_CONFIG_PLATFORM_TCP_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_HASH_TABLE_SIZE
+ *
+ * The number of buckets in the hash table used to find the receiving UDP socket by its local port.
+ *
+ * MUST be a power of two.
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_HASH_TABLE_SIZE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_HASH_TABLE_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TCP_ENDPOINT_HASH_TABLE_SIZE
+ *
+ * The number of buckets in the hash table (keyed by the connection 4-tuple) used to find the receiving TCP endpoint.
+ *
+ * MUST be a power of two.
+ */
+#ifndef OPENTHREAD_CONFIG_TCP_ENDPOINT_HASH_TABLE_SIZE
+#define OPENTHREAD_CONFIG_TCP_ENDPOINT_HASH_TABLE_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TCP_SACK_ENABLE
+ *
+ * Define as 1 to negotiate TCP selective acknowledgments (SACK, RFC 2018) on new connections by default.
+ */
+#ifndef OPENTHREAD_CONFIG_TCP_SACK_ENABLE
+#define OPENTHREAD_CONFIG_TCP_SACK_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TCP_DELAYED_ACK_TIMEOUT
+ *
+ * The default maximum time (in milliseconds) TCP delays an ACK for received in-order data.
+ *
+ * Setting this to zero disables delayed ACKs so every received segment is acknowledged immediately.
+ */
+#ifndef OPENTHREAD_CONFIG_TCP_DELAYED_ACK_TIMEOUT
+#define OPENTHREAD_CONFIG_TCP_DELAYED_ACK_TIMEOUT 100
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TCP_ACK_THINNING_SEGMENTS
+ *
+ * The default number of in-order TCP segments received before an ACK is sent immediately (instead of being delayed).
+ *
+ * The value of 2 follows RFC 5681 (ACK at least every second full-sized segment). Larger values reduce the number of
+ * ACKs contending with data segments on half-duplex radio links, at the cost of slower window growth at the sender.
+ * MUST be at least 1.
+ */
+#ifndef OPENTHREAD_CONFIG_TCP_ACK_THINNING_SEGMENTS
+#define OPENTHREAD_CONFIG_TCP_ACK_THINNING_SEGMENTS 2
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TCP_ENABLE
  *
@@ -69,6 +69,57 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TABLE_SIZE
+ *
+ * Specifies the maximum number of 6LoWPAN datagrams that can be reassembled at the same time.
+ *
+ * When the table is full and a new first fragment is received, the datagram closest to its reassembly timeout is
+ * evicted.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TABLE_SIZE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TABLE_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES_PER_SOURCE
+ *
+ * Specifies the maximum number of 6LoWPAN datagrams from the same source (MAC or mesh source address) that can be
+ * reassembled at the same time.
+ *
+ * When the limit is reached and a new first fragment is received from the same source, the datagram from that source
+ * closest to its reassembly timeout is evicted. This bounds the reassembly memory that a single source can use.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES_PER_SOURCE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES_PER_SOURCE 3
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+ *
+ * Define as 1 to enable the 6LoWPAN flow cache.
+ *
+ * The flow cache remembers the compressed IPv6 and UDP headers of recently compressed flows (keyed by IPv6 header
+ * fields, UDP ports, and MAC addresses) so that subsequent datagrams of the same flow are compressed by copying the
+ * cached bytes and appending the UDP checksum. It also remembers recently decompressed IPHC headers (keyed by the
+ * compressed bytes and MAC addresses) to skip parsing them again. The cache is invalidated whenever the Network Data
+ * (6LoWPAN contexts) or the mesh-local prefix changes.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_SIZE
+ *
+ * Specifies the number of compression (and decompression) entries in the 6LoWPAN flow cache.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_SIZE
+#define OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES
  *
@@ -197,6 +248,47 @@
 #define OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_HISTOGRAM_BIN_INTERVAL 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+ *
+ * Define as 1 to enable the route cache in Mesh Forwarder (FTD only).
+ *
+ * The route cache remembers the mesh destination RLOC16 determined from the Network Data route lookup for recently
+ * forwarded (source, destination) address pairs, so that subsequent messages of the same flow do not need to walk the
+ * Network Data TLVs. The cache is invalidated whenever the Network Data, the router table, or the unicast addresses
+ * of the Thread interface change.
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_SIZE
+ *
+ * Specifies the number of entries in the Mesh Forwarder route cache.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_SIZE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENTRY_TIMEOUT
+ *
+ * Specifies the maximum time in milliseconds a Mesh Forwarder route cache entry is used before a new route lookup is
+ * performed.
+ *
+ * The route selection among Border Routers with the same preference depends on the mesh path cost, which can change
+ * due to link quality variations without an explicit router table change. This timeout bounds how long a cached
+ * entry can reflect an older path cost.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENTRY_TIMEOUT
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENTRY_TIMEOUT 5000
+#endif
+
 /**
  * @}
  */
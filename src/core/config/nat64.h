@@ -61,6 +61,18 @@
 #define OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS 254
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE
+ *
+ * Specifies the number of buckets in each of the hash tables used to look up NAT64 mappings (by IPv6 source and by
+ * IPv4 address and translated port).
+ *
+ * MUST be a power of two. It is recommended to use a value no smaller than `OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS`.
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE
+#define OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE 256
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS
  *
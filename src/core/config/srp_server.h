@@ -138,6 +138,47 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+ *
+ * Define to 1 to enable SRP server feature to save its registered hosts and services in non-volatile settings.
+ *
+ * When enabled, the SRP server saves the committed hosts and their services (names, addresses, keys, and the lease,
+ * key-lease and TTL values along with the time elapsed since their last update) in the settings, one entry per host.
+ * Only the entries of the changed or removed hosts are updated. When the server is started for the first time after
+ * a restart of the device or process, the saved entries are restored with their remaining lease times and, if the
+ * Advertising Proxy is used, advertised together when it starts. Disabling the server clears the saved entries.
+ *
+ * The time the server was not running is not accounted for, since there is no time source guaranteed to keep
+ * counting across a restart. A restored host or service gets the remaining lease and key-lease it had when it was
+ * saved, counting from the restore, and the client is expected to refresh its registration within this time.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_SAVE_DELAY
+ *
+ * Specifies the delay (in milliseconds) used by the SRP server before saving its hosts in the settings after a change.
+ *
+ * Changes within this delay are combined into a single save. Applicable when the persistence feature is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_SAVE_DELAY
+#define OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_SAVE_DELAY 5000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_MAX_HOST_SIZE
+ *
+ * Specifies the maximum size (in bytes) of a saved host entry (including all its services) in the settings.
+ *
+ * A host whose entry does not fit is not saved. Applicable when the persistence feature is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_MAX_HOST_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_MAX_HOST_SIZE 1280
+#endif
+
 /**
  * @}
  */
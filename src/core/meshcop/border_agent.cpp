@@ -629,24 +629,22 @@ void Manager::CoapDtlsSession::Cleanup(void)
     Coap::SecureSession::Cleanup();
 }
 
-bool Manager::CoapDtlsSession::HandleResource(CoapBase &aCoapBase, const char *aUriPath, Coap::Msg &aMsg)
+bool Manager::CoapDtlsSession::HandleResource(CoapBase &aCoapBase, Uri aUri, Coap::Msg &aMsg)
 {
-    return static_cast<CoapDtlsSession &>(aCoapBase).HandleResource(aUriPath, aMsg);
+    return static_cast<CoapDtlsSession &>(aCoapBase).HandleResource(aUri, aMsg);
 }
 
-bool Manager::CoapDtlsSession::HandleResource(const char *aUriPath, Coap::Msg &aMsg)
-
+bool Manager::CoapDtlsSession::HandleResource(Uri aUri, Coap::Msg &aMsg)
 {
     bool didHandle = true;
-    Uri  uri       = UriFromPath(aUriPath);
 
-    if ((uri != kUriUnknown) && !aMsg.IsPostRequest())
+    if ((aUri != kUriUnknown) && !aMsg.IsPostRequest())
     {
         IgnoreError(SendAckResponse(aMsg, ot::Coap::kCodeMethodNotAllowed));
         ExitNow();
     }
 
-    switch (uri)
+    switch (aUri)
     {
     case kUriCommissionerPetition:
         Log<kUriCommissionerPetition>(kReceive);
@@ -661,7 +659,7 @@ bool Manager::CoapDtlsSession::HandleResource(const char *aUriPath, Coap::Msg &a
     case kUriCommissionerGet:
     case kUriActiveGet:
     case kUriPendingGet:
-        HandleTmfDatasetGet(aMsg.mMessage, uri);
+        HandleTmfDatasetGet(aMsg.mMessage, aUri);
         break;
     case kUriProxyTx:
         HandleTmfProxyTx(aMsg);
@@ -671,7 +669,7 @@ bool Manager::CoapDtlsSession::HandleResource(const char *aUriPath, Coap::Msg &a
     case kUriEnrollerKeepAlive:
     case kUriEnrollerJoinerAccept:
     case kUriEnrollerJoinerRelease:
-        HandleEnrollerTmf(uri, aMsg);
+        HandleEnrollerTmf(aUri, aMsg);
         break;
 #endif
 
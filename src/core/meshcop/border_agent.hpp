@@ -327,8 +327,8 @@ private:
         void        HandleLeaderResponseToFwdTmf(const ForwardContext &aForwardContext,
                                                  const Coap::Msg      *aResponse,
                                                  Error                 aResult);
-        static bool HandleResource(CoapBase &aCoapBase, const char *aUriPath, Coap::Msg &aMsg);
-        bool        HandleResource(const char *aUriPath, Coap::Msg &aMsg);
+        static bool HandleResource(CoapBase &aCoapBase, Uri aUri, Coap::Msg &aMsg);
+        bool        HandleResource(Uri aUri, Coap::Msg &aMsg);
         static void HandleTimer(Timer &aTimer);
         void        HandleTimer(void);
 
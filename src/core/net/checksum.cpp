@@ -235,6 +235,63 @@ exit:
     return;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// Checksum::Delta
+
+void Checksum::Delta::AddUint16(uint16_t aValue)
+{
+    uint32_t sum = static_cast<uint32_t>(mSum) + aValue;
+
+    // One's complement sum (end-around carry).
+    mSum = static_cast<uint16_t>((sum & 0xffff) + (sum >> 16));
+}
+
+void Checksum::Delta::ReplaceUint16(uint16_t aOldValue, uint16_t aNewValue)
+{
+    RemoveUint16(aOldValue);
+    AddUint16(aNewValue);
+}
+
+void Checksum::Delta::AddBytes(const uint8_t *aBytes, uint16_t aLength, Action aAction)
+{
+    OT_ASSERT((aLength % sizeof(uint16_t)) == 0);
+
+    for (uint16_t i = 0; i < aLength; i += sizeof(uint16_t))
+    {
+        uint16_t value = BigEndian::ReadUint16(&aBytes[i]);
+
+        if (aAction == kAdd)
+        {
+            AddUint16(value);
+        }
+        else
+        {
+            RemoveUint16(value);
+        }
+    }
+}
+
+uint16_t Checksum::Delta::ApplyTo(uint16_t aChecksum) const
+{
+    // RFC 1624 (eqn. 3): HC' = ~(~HC + ~m + m'), where the delta sum
+    // `mSum` already holds `~m + m'` for all changed words.
+
+    Delta    delta = *this;
+    uint16_t checksum;
+
+    delta.AddUint16(static_cast<uint16_t>(~aChecksum));
+    checksum = delta.mSum;
+
+    // Same as `WriteToMessage()`, a zero result is written as 0xffff.
+
+    if (checksum != 0xffff)
+    {
+        checksum = static_cast<uint16_t>(~checksum);
+    }
+
+    return checksum;
+}
+
 void Checksum::UpdateIp4HeaderChecksum(Ip4::Header &aHeader)
 {
     Checksum checksum;
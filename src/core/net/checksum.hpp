@@ -54,6 +54,95 @@ class Checksum
     friend class ChecksumTester;
 
 public:
+    /**
+     * Accumulates changes to the data covered by a checksum, allowing the checksum to be updated incrementally
+     * (RFC 1624) instead of being recalculated over the whole message.
+     *
+     * Data is processed as 16-bit words in network byte order, so any added or removed field MUST start at an even
+     * offset within the checksummed data.
+     */
+    class Delta
+    {
+    public:
+        /**
+         * Initializes the `Delta` as empty (no change).
+         */
+        Delta(void)
+            : mSum(0)
+        {
+        }
+
+        /**
+         * Adds a 16-bit word which is now covered by the checksum.
+         *
+         * @param[in] aValue  The 16-bit value (in host byte order).
+         */
+        void AddUint16(uint16_t aValue);
+
+        /**
+         * Removes a 16-bit word which is no longer covered by the checksum.
+         *
+         * @param[in] aValue  The 16-bit value (in host byte order).
+         */
+        void RemoveUint16(uint16_t aValue) { AddUint16(static_cast<uint16_t>(~aValue)); }
+
+        /**
+         * Replaces a 16-bit word covered by the checksum.
+         *
+         * @param[in] aOldValue  The old 16-bit value (in host byte order).
+         * @param[in] aNewValue  The new 16-bit value (in host byte order).
+         */
+        void ReplaceUint16(uint16_t aOldValue, uint16_t aNewValue);
+
+        /**
+         * Adds an IPv6 address which is now covered by the checksum (e.g., in the pseudo-header).
+         *
+         * @param[in] aAddress  The IPv6 address.
+         */
+        void Add(const Ip6::Address &aAddress) { AddBytes(aAddress.GetBytes(), sizeof(aAddress), kAdd); }
+
+        /**
+         * Removes an IPv6 address which is no longer covered by the checksum.
+         *
+         * @param[in] aAddress  The IPv6 address.
+         */
+        void Remove(const Ip6::Address &aAddress) { AddBytes(aAddress.GetBytes(), sizeof(aAddress), kRemove); }
+
+        /**
+         * Adds an IPv4 address which is now covered by the checksum (e.g., in the pseudo-header).
+         *
+         * @param[in] aAddress  The IPv4 address.
+         */
+        void Add(const Ip4::Address &aAddress) { AddBytes(aAddress.GetBytes(), sizeof(aAddress), kAdd); }
+
+        /**
+         * Removes an IPv4 address which is no longer covered by the checksum.
+         *
+         * @param[in] aAddress  The IPv4 address.
+         */
+        void Remove(const Ip4::Address &aAddress) { AddBytes(aAddress.GetBytes(), sizeof(aAddress), kRemove); }
+
+        /**
+         * Applies the accumulated changes to a checksum field value.
+         *
+         * @param[in] aChecksum  The checksum field value before the change (in host byte order).
+         *
+         * @returns The updated checksum field value (in host byte order).
+         */
+        uint16_t ApplyTo(uint16_t aChecksum) const;
+
+    private:
+        enum Action : uint8_t
+        {
+            kAdd,
+            kRemove,
+        };
+
+        void AddBytes(const uint8_t *aBytes, uint16_t aLength, Action aAction);
+
+        uint16_t mSum;
+    };
+
     /**
      * Verifies the checksum in a given message (if UDP/ICMP6).
      *
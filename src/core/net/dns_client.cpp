@@ -766,6 +766,10 @@ Client::Client(Instance &aInstance)
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     , mUserDidSetDefaultAddress(false)
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    , mCache(aInstance)
+    , mCacheTask(aInstance)
+#endif
 {
     struct QueryTypeChecker
     {
@@ -786,6 +790,9 @@ Client::Client(Instance &aInstance)
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
     ClearAllBytes(mSendLink);
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    ResetServerLatencyStats();
+#endif
 }
 
 Error Client::Start(void)
@@ -813,6 +820,15 @@ void Client::Stop(void)
         FinalizeQuery(*query, kErrorAbort);
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    mCoalescedQueries.DequeueAndFreeAll();
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    mCachedResponses.DequeueAndFreeAll();
+    mCache.Clear();
+#endif
+
     IgnoreError(mSocket.Close());
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
     if (mTcpState != kTcpUninitialized)
@@ -1051,6 +1067,15 @@ Error Client::StartQuery(QueryInfo &aInfo, const char *aLabel, const char *aName
 
     SuccessOrExit(error = AllocateQuery(aInfo, aLabel, aName, query));
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    if (JoinPendingQuery(*query) == kErrorNone)
+    {
+        // The query joined an identical pending query and will be
+        // finalized along with it.
+        ExitNow();
+    }
+#endif
+
     mMainQueries.Enqueue(*query);
 
     error = SendQuery(*query, aInfo, /* aUpdateTimer */ true);
@@ -1199,6 +1224,18 @@ Error Client::SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer)
     }
 #endif
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    // The cache is only checked on the first transmission so that
+    // retransmissions are not counted as cache misses.
+
+    if ((aInfo.mTransmissionCount == 1) && (AnswerFromCache(*message, aInfo) == kErrorNone))
+    {
+        message->Free();
+        message = nullptr;
+        ExitNow();
+    }
+#endif
+
     length = message->DetermineLengthAfterOffset();
 
     if (aInfo.mConfig.GetTransportProto() == QueryConfig::kDnsTransportTcp)
@@ -1255,6 +1292,9 @@ Error Client::SendQuery(Query &aQuery, QueryInfo &aInfo, bool aUpdateTimer)
         VerifyOrExit(length <= kUdpQueryMaxSize, error = kErrorInvalidArgs);
         messageInfo.SetPeerAddr(aInfo.mConfig.GetServerSockAddr().GetAddress());
         messageInfo.SetPeerPort(aInfo.mConfig.GetServerSockAddr().GetPort());
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+        SendToParallelServers(*message, aInfo);
+#endif
         SuccessOrExit(error = mSocket.SendTo(*message, messageInfo));
     }
 
@@ -1338,6 +1378,28 @@ void Client::FinalizeQuery(Query &aQuery, Error aError)
 }
 
 void Client::FinalizeQuery(Response &aResponse, Error aError)
+{
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    QueryInfo info;
+
+    // Mark the query as being finalized so that a new query started
+    // from a callback does not join it.
+
+    info.ReadFrom(*aResponse.mQuery);
+    info.mIsFinalizing = true;
+    UpdateQuery(*aResponse.mQuery, info);
+#endif
+
+    InvokeCallback(aResponse, aError);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    FinalizeCoalescedQueries(aResponse, aError);
+#endif
+
+    FreeQuery(*aResponse.mQuery);
+}
+
+void Client::InvokeCallback(Response &aResponse, Error aError)
 {
     QueryType type;
     Callback  callback;
@@ -1385,8 +1447,6 @@ void Client::FinalizeQuery(Response &aResponse, Error aError)
     case kNoQuery:
         break;
     }
-
-    FreeQuery(*aResponse.mQuery);
 }
 
 void Client::GetQueryTypeAndCallback(const Query &aQuery, QueryType &aType, Callback &aCallback, void *&aContext)
@@ -1425,17 +1485,43 @@ exit:
 
 void Client::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMsgInfo)
 {
-    OT_UNUSED_VARIABLE(aMsgInfo);
-    ProcessResponse(aMessage);
+    Ip6::SockAddr serverSockAddr(aMsgInfo.GetPeerAddr(), aMsgInfo.GetPeerPort());
+
+    ProcessResponse(aMessage, &serverSockAddr);
 }
 
-void Client::ProcessResponse(const Message &aResponseMessage)
+void Client::ProcessResponse(const Message &aResponseMessage, const Ip6::SockAddr *aServerSockAddr)
 {
+    // `aServerSockAddr` gives the server from which the response
+    // was received, or `nullptr` if it is served from the cache.
+
     Error  responseError;
     Query *query;
 
     SuccessOrExit(ParseResponse(aResponseMessage, query, responseError));
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE || OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    if (aServerSockAddr != nullptr)
+    {
+        // The response is cached under the server which sent it,
+        // which may be one of the parallel servers.
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+        mCache.Add(aResponseMessage, *aServerSockAddr);
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+        {
+            QueryInfo info;
+
+            info.ReadFrom(*query);
+            RecordLatency(info, *aServerSockAddr);
+        }
+#endif
+    }
+#else
+    OT_UNUSED_VARIABLE(aServerSockAddr);
+#endif
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
     if (ReplaceWithIp4Query(*query, aResponseMessage) == kErrorNone)
     {
@@ -2017,7 +2103,7 @@ void Client::HandleTcpReceiveAvailable(otTcpEndpoint *aEndpoint,
         totalRead += length + sizeof(uint16_t);
 
         // Now process the read message as query response.
-        ProcessResponse(*message);
+        ProcessResponse(*message, &mEndpoint.GetPeerAddress());
 
         IgnoreError(message->SetLength(0));
 
@@ -2067,6 +2153,582 @@ void Client::HandleTcpDisconnectedCallback(otTcpEndpoint *aEndpoint, otTcpDiscon
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+
+Error Client::JoinPendingQuery(Query &aQuery)
+{
+    // Checks whether there is a pending main query identical to
+    // `aQuery` and if so makes `aQuery` join it. The joined query
+    // is not sent and is finalized along with the pending one.
+
+    Error     error = kErrorNotFound;
+    QueryInfo info;
+    QueryInfo pendingInfo;
+
+    info.ReadFrom(aQuery);
+
+    for (Query &pendingQuery : mMainQueries)
+    {
+        pendingInfo.ReadFrom(pendingQuery);
+
+        if (pendingInfo.mIsFinalizing || !CanCoalesce(aQuery, info, pendingQuery, pendingInfo))
+        {
+            continue;
+        }
+
+        info.mLeaderQuery = &pendingQuery;
+        UpdateQuery(aQuery, info);
+        mCoalescedQueries.Enqueue(aQuery);
+        error = kErrorNone;
+        break;
+    }
+
+    return error;
+}
+
+bool Client::CanCoalesce(const Query &aQuery, const QueryInfo &aInfo, const Query &aOther, const QueryInfo &aOtherInfo)
+{
+    // The response timeout and max tx attempts are intentionally
+    // not compared, the joined query follows the pending one.
+
+    bool     canCoalesce = false;
+    uint16_t nameLength  = aQuery.GetLength() - kNameOffsetInQuery;
+
+    VerifyOrExit(aInfo.mQueryType == aOtherInfo.mQueryType);
+    VerifyOrExit(aInfo.mShouldResolveHostAddr == aOtherInfo.mShouldResolveHostAddr);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ARBITRARY_RECORD_QUERY_ENABLE
+    VerifyOrExit(aInfo.mRecordType == aOtherInfo.mRecordType);
+#endif
+
+    VerifyOrExit(aInfo.mConfig.GetServerSockAddr() == aOtherInfo.mConfig.GetServerSockAddr());
+    VerifyOrExit(aInfo.mConfig.GetTransportProto() == aOtherInfo.mConfig.GetTransportProto());
+    VerifyOrExit(aInfo.mConfig.GetRecursionFlag() == aOtherInfo.mConfig.GetRecursionFlag());
+    VerifyOrExit(aInfo.mConfig.GetServiceMode() == aOtherInfo.mConfig.GetServiceMode());
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    VerifyOrExit(aInfo.mConfig.GetNat64Mode() == aOtherInfo.mConfig.GetNat64Mode());
+#endif
+
+    VerifyOrExit(aOther.GetLength() - kNameOffsetInQuery == nameLength);
+    canCoalesce = aQuery.CompareBytes(kNameOffsetInQuery, aOther, kNameOffsetInQuery, nameLength);
+
+exit:
+    return canCoalesce;
+}
+
+void Client::FinalizeCoalescedQueries(const Response &aResponse, Error aError)
+{
+    // Finalizes all queries which joined the main query of
+    // `aResponse`. The queries are searched for again after each
+    // callback since the callback may start or finalize queries.
+
+    Response  response = aResponse;
+    QueryInfo mainInfo;
+    QueryInfo info;
+    Query    *query;
+
+    mainInfo.ReadFrom(*aResponse.mQuery);
+
+    while ((query = FindCoalescedQuery(*aResponse.mQuery)) != nullptr)
+    {
+        mCoalescedQueries.Dequeue(*query);
+
+        // The type of the main query may have changed while it was
+        // pending (e.g., replaced by an IPv4 address query), so we
+        // update the joined query to match the response.
+
+        info.ReadFrom(*query);
+        info.mQueryType = mainInfo.mQueryType;
+        UpdateQuery(*query, info);
+
+        response.mQuery = query;
+        InvokeCallback(response, aError);
+
+        query->Free();
+    }
+}
+
+Client::Query *Client::FindCoalescedQuery(const Query &aMainQuery)
+{
+    Query    *matchedQuery = nullptr;
+    QueryInfo info;
+
+    for (Query &query : mCoalescedQueries)
+    {
+        info.ReadFrom(query);
+
+        if (info.mLeaderQuery == &aMainQuery)
+        {
+            matchedQuery = &query;
+            break;
+        }
+    }
+
+    return matchedQuery;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+
+Error Client::SetParallelServers(const Ip6::SockAddr *aServers, uint8_t aNumServers)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aNumServers <= kMaxParallelServers, error = kErrorInvalidArgs);
+
+    for (uint8_t index = 0; index < aNumServers; index++)
+    {
+        VerifyOrExit(!aServers[index].GetAddress().IsUnspecified(), error = kErrorInvalidArgs);
+    }
+
+    mParallelServers.Clear();
+
+    for (uint8_t index = 0; index < aNumServers; index++)
+    {
+        SuccessOrAssert(mParallelServers.PushBack(aServers[index]));
+    }
+
+exit:
+    return error;
+}
+
+bool Client::ShouldSendToParallelServers(const QueryInfo &aInfo) const
+{
+    // Queries are sent to the parallel servers only when they use
+    // UDP and are directed to the default server, i.e., a query
+    // explicitly directed to a server by its config is only sent to
+    // that server.
+
+    return (aInfo.mConfig.GetTransportProto() == QueryConfig::kDnsTransportUdp) &&
+           (aInfo.mConfig.GetServerSockAddr() == mDefaultConfig.GetServerSockAddr());
+}
+
+Ip6::SockAddr Client::GetParallelServerSockAddr(const Ip6::SockAddr &aServer) const
+{
+    // A parallel server with no port uses the port of the default
+    // server.
+
+    return Ip6::SockAddr(aServer.GetAddress(), (aServer.GetPort() != 0) ? aServer.GetPort()
+                                                                        : mDefaultConfig.GetServerSockAddr().GetPort());
+}
+
+void Client::SendToParallelServers(const Message &aMessage, const QueryInfo &aInfo)
+{
+    // Sends a copy of the query `aMessage` to each additional
+    // server. The same message ID is used, so the first response
+    // received from any server finalizes the query and later ones
+    // are dropped.
+
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrExit(ShouldSendToParallelServers(aInfo));
+
+    for (const Ip6::SockAddr &parallelServer : mParallelServers)
+    {
+        Ip6::SockAddr server = GetParallelServerSockAddr(parallelServer);
+        Message      *message;
+
+        if (server == aInfo.mConfig.GetServerSockAddr())
+        {
+            continue;
+        }
+
+        message = aMessage.Clone<kSameReservedHeader>();
+        VerifyOrExit(message != nullptr);
+
+        messageInfo.SetPeerAddr(server.GetAddress());
+        messageInfo.SetPeerPort(server.GetPort());
+
+        if (mSocket.SendTo(*message, messageInfo) != kErrorNone)
+        {
+            message->Free();
+        }
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+
+Error Client::GetServerLatencyStats(uint8_t aIndex, ServerLatencyStats &aStats) const
+{
+    Error error = kErrorNotFound;
+
+    for (const ServerLatencyStats &stats : mLatencyStats)
+    {
+        if (!stats.IsInUse())
+        {
+            continue;
+        }
+
+        if (aIndex == 0)
+        {
+            aStats = stats;
+            error  = kErrorNone;
+            break;
+        }
+
+        aIndex--;
+    }
+
+    return error;
+}
+
+void Client::ResetServerLatencyStats(void)
+{
+    for (ServerLatencyStats &stats : mLatencyStats)
+    {
+        stats.Clear();
+    }
+}
+
+void Client::RecordLatency(const QueryInfo &aInfo, const Ip6::SockAddr &aServerSockAddr)
+{
+    // Records the latency of a response to a query. Only queries
+    // transmitted once are measured since otherwise the response
+    // cannot be associated with a specific transmission. If there
+    // is no entry for the server, an unused entry or the one with
+    // the fewest responses is used.
+
+    ServerLatencyStats *stats = nullptr;
+    TimeMilli           txTime;
+
+    VerifyOrExit(aInfo.mTransmissionCount == 1);
+
+    for (ServerLatencyStats &entry : mLatencyStats)
+    {
+        if (entry.IsInUse() && (entry.GetServerSockAddr() == aServerSockAddr))
+        {
+            stats = &entry;
+            break;
+        }
+
+        if ((stats == nullptr) || (entry.mNumResponses < stats->mNumResponses))
+        {
+            stats = &entry;
+        }
+    }
+
+    if (!stats->IsInUse() || !(stats->GetServerSockAddr() == aServerSockAddr))
+    {
+        stats->Clear();
+        AsCoreType(&stats->mServerSockAddr) = aServerSockAddr;
+    }
+
+    txTime = aInfo.mRetransmissionTime - aInfo.mConfig.GetResponseTimeout();
+    stats->Record(TimerMilli::GetNow() - txTime);
+
+exit:
+    return;
+}
+
+void Client::ServerLatencyStats::Record(uint32_t aLatency)
+{
+    uint8_t  bucket = 0;
+    uint32_t limit  = kFirstLatencyBucketLimit;
+
+    while ((bucket < kNumLatencyBuckets - 1) && (aLatency >= limit))
+    {
+        bucket++;
+        limit <<= 1;
+    }
+
+    mMinLatency = IsInUse() ? Min(mMinLatency, aLatency) : aLatency;
+    mMaxLatency = Max(mMaxLatency, aLatency);
+    mHistogram[bucket]++;
+    mNumResponses++;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+Error Client::AnswerFromCache(const Message &aQueryMessage, const QueryInfo &aInfo)
+{
+    // Checks whether the query can be answered from a cached
+    // response. The cached response is processed from a tasklet
+    // (as if received from the server) so that the callback is
+    // never invoked from within a `Resolve/Browse()` call.
+
+    Error    error = kErrorNotFound;
+    Message *response;
+
+    response = mCache.Lookup(aQueryMessage, aInfo);
+    VerifyOrExit(response != nullptr);
+
+    mCachedResponses.Enqueue(*response);
+    mCacheTask.Post();
+    error = kErrorNone;
+
+exit:
+    return error;
+}
+
+void Client::HandleCacheTask(void)
+{
+    Message *response;
+
+    while ((response = mCachedResponses.GetHead()) != nullptr)
+    {
+        mCachedResponses.Dequeue(*response);
+        ProcessResponse(*response, /* aServerSockAddr */ nullptr);
+        response->Free();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Client::Cache
+
+Client::Cache::Cache(Instance &aInstance)
+    : InstanceLocator(aInstance)
+{
+    mCounters.Clear();
+}
+
+void Client::Cache::Clear(void)
+{
+    for (Entry &entry : mEntries)
+    {
+        entry.Free();
+    }
+}
+
+Message *Client::Cache::Lookup(const Message &aQuery, const QueryInfo &aInfo)
+{
+    // Returns a copy of a matching cached response (with TTLs
+    // updated and message ID set from `aQuery`) or `nullptr`.
+    // A response is matched if it was received from the server
+    // of the query config, or from any of the parallel servers
+    // to which the query would also be sent.
+
+    Error     error    = kErrorNone;
+    TimeMilli now      = TimerMilli::GetNow();
+    uint32_t  minTtl   = kInfiniteTtl;
+    uint32_t  maxTtl;
+    Message  *response = nullptr;
+    Entry    *entry;
+    Header    queryHeader;
+    Header    header;
+
+    entry = FindMatching(aQuery, aInfo.mConfig.GetServerSockAddr(), now);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+    if ((entry == nullptr) && Get<Client>().ShouldSendToParallelServers(aInfo))
+    {
+        for (const Ip6::SockAddr &server : Get<Client>().mParallelServers)
+        {
+            entry = FindMatching(aQuery, Get<Client>().GetParallelServerSockAddr(server), now);
+
+            if (entry != nullptr)
+            {
+                break;
+            }
+        }
+    }
+#endif
+
+    if (entry == nullptr)
+    {
+        mCounters.mMisses++;
+        ExitNow();
+    }
+
+    response = entry->mResponse->Clone<kNoReservedHeader>();
+    VerifyOrExit(response != nullptr, error = kErrorNoBufs);
+
+    // The TTLs are capped to the remaining lifetime of the entry.
+
+    maxTtl = DivideAndRoundUp<uint32_t>(entry->mExpireTime - now, Time::kOneSecondInMsec);
+    SuccessOrExit(error = ResourceRecord::UpdateTtlsInMessage(*response, Time::MsecToSec(now - entry->mInsertTime),
+                                                              maxTtl, minTtl));
+
+    SuccessOrExit(error = aQuery.Read(aQuery.GetOffset(), queryHeader));
+    SuccessOrExit(error = response->Read(response->GetOffset(), header));
+    header.SetMessageId(queryHeader.GetMessageId());
+    response->Write(response->GetOffset(), header);
+
+    entry->mLastUseTime = now;
+    mCounters.mHits++;
+
+exit:
+    FreeAndNullMessageOnError(response, error);
+    return response;
+}
+
+void Client::Cache::Add(const Message &aResponse, const Ip6::SockAddr &aServer)
+{
+    Error     error  = kErrorNone;
+    TimeMilli now    = TimerMilli::GetNow();
+    uint16_t  offset = aResponse.GetOffset();
+    uint16_t  length = aResponse.GetLength() - offset;
+    uint32_t  ttl    = kInfiniteTtl;
+    Message  *copy   = nullptr;
+    Entry    *entry;
+    Header    header;
+
+    SuccessOrExit(error = aResponse.Read(offset, header));
+
+    VerifyOrExit(header.GetQuestionCount() > 0);
+    VerifyOrExit((header.GetResponseCode() == Header::kResponseSuccess) ||
+                 (header.GetResponseCode() == Header::kResponseNameError));
+    VerifyOrExit(length <= kMaxSize);
+
+    copy = Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrExit(copy != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = copy->AppendBytesFromMessage(aResponse, offset, length));
+    SuccessOrExit(error = ResourceRecord::UpdateTtlsInMessage(*copy, /* aElapsed */ 0, kMaxTtl, ttl));
+
+    if ((header.GetResponseCode() == Header::kResponseNameError) || (header.GetAnswerCount() == 0))
+    {
+        // A negative response is kept for the negative caching TTL
+        // from the SOA record in its authority section (RFC 2308),
+        // and never longer than `kNegativeTtl`. Responses without
+        // an SOA record use `kNegativeTtl`.
+
+        uint32_t negativeTtl = kNegativeTtl;
+
+        IgnoreError(ResourceRecord::ReadNegativeCacheTtl(*copy, negativeTtl));
+        ttl = Min(negativeTtl, kNegativeTtl);
+    }
+
+    ttl = Min(ttl, kMaxTtl);
+    VerifyOrExit(ttl > 0);
+
+    entry = FindMatching(*copy, aServer, now);
+
+    if (entry != nullptr)
+    {
+        entry->Free();
+    }
+
+    while (GetTotalSize() + length > kMaxSize)
+    {
+        Evict(now);
+    }
+
+    entry = FindUnused();
+
+    if (entry == nullptr)
+    {
+        entry = &Evict(now);
+    }
+
+    entry->mResponse.Reset(copy);
+    copy = nullptr;
+
+    entry->mServer      = aServer;
+    entry->mInsertTime  = now;
+    entry->mExpireTime  = now + Time::SecToMsec(ttl);
+    entry->mLastUseTime = now;
+
+    mCounters.mInsertions++;
+
+exit:
+    FreeMessage(copy);
+    LogWarnOnError(error, "add response to cache");
+}
+
+Client::Cache::Entry *Client::Cache::FindMatching(const Message       &aMessage,
+                                                  const Ip6::SockAddr &aServer,
+                                                  TimeMilli            aNow)
+{
+    Entry *match = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsInUse())
+        {
+            continue;
+        }
+
+        if (entry.IsExpired(aNow))
+        {
+            entry.Free();
+            continue;
+        }
+
+        if ((entry.mServer == aServer) && Question::QuestionsMatch(*entry.mResponse, aMessage))
+        {
+            match = &entry;
+            break;
+        }
+    }
+
+    return match;
+}
+
+Client::Cache::Entry *Client::Cache::FindUnused(void)
+{
+    Entry *unused = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsInUse())
+        {
+            unused = &entry;
+            break;
+        }
+    }
+
+    return unused;
+}
+
+Client::Cache::Entry &Client::Cache::Evict(TimeMilli aNow)
+{
+    // Frees an expired entry if there is one, otherwise the least
+    // recently used entry. MUST be called when at least one entry
+    // is in use.
+
+    Entry *lruEntry = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsInUse())
+        {
+            continue;
+        }
+
+        if (entry.IsExpired(aNow))
+        {
+            lruEntry = &entry;
+            ExitNow();
+        }
+
+        if ((lruEntry == nullptr) || (entry.mLastUseTime < lruEntry->mLastUseTime))
+        {
+            lruEntry = &entry;
+        }
+    }
+
+    OT_ASSERT(lruEntry != nullptr);
+    mCounters.mEvictions++;
+
+exit:
+    lruEntry->Free();
+    return *lruEntry;
+}
+
+uint32_t Client::Cache::GetTotalSize(void) const
+{
+    uint32_t size = 0;
+
+    for (const Entry &entry : mEntries)
+    {
+        if (entry.IsInUse())
+        {
+            size += entry.mResponse->GetLength();
+        }
+    }
+
+    return size;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 } // namespace Dns
 } // namespace ot
 
@@ -39,6 +39,9 @@
 #include "common/clearable.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
+#include "common/owned_ptr.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "net/dns_types.hpp"
 #include "net/ip6.hpp"
@@ -863,10 +866,99 @@ public:
                       const QueryConfig *aConfig = nullptr);
 #endif
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    /**
+     * Represents the counters of the DNS client response cache.
+     */
+    class CacheCounters : public otDnsCacheCounters, public Clearable<CacheCounters>
+    {
+    };
+
+    /**
+     * Returns the counters of the DNS client response cache.
+     *
+     * @returns The cache counters.
+     */
+    const CacheCounters &GetCacheCounters(void) const { return mCache.GetCounters(); }
+
+    /**
+     * Resets the counters of the DNS client response cache.
+     */
+    void ResetCacheCounters(void) { mCache.ResetCounters(); }
+
+    /**
+     * Removes all responses from the DNS client response cache.
+     */
+    void ClearCache(void) { mCache.Clear(); }
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+    /**
+     * Sets the additional servers to which queries are sent in parallel.
+     *
+     * A UDP query sent to the server from the default config is also sent to each additional server using the same
+     * message ID. The first response received from any of the servers is used to finalize the query.
+     *
+     * @param[in] aServers     An array of server socket addresses. Can be `nullptr` if @p aNumServers is zero.
+     * @param[in] aNumServers  The number of entries in @p aServers. Zero clears the list.
+     *
+     * @retval kErrorNone         Successfully set the additional servers.
+     * @retval kErrorInvalidArgs  @p aNumServers is too large or a server address is unspecified.
+     */
+    Error SetParallelServers(const Ip6::SockAddr *aServers, uint8_t aNumServers);
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    /**
+     * Represents the response latency statistics of a DNS server.
+     */
+    class ServerLatencyStats : public otDnsServerLatencyStats, public Clearable<ServerLatencyStats>
+    {
+        friend class Client;
+
+    public:
+        /**
+         * Returns the server socket address.
+         *
+         * @returns The server socket address.
+         */
+        const Ip6::SockAddr &GetServerSockAddr(void) const { return AsCoreType(&mServerSockAddr); }
+
+    private:
+        bool IsInUse(void) const { return mNumResponses != 0; }
+        void Record(uint32_t aLatency);
+    };
+
+    /**
+     * Gets the response latency statistics of a DNS server.
+     *
+     * @param[in]  aIndex   The index of the server entry to get (zero for the first).
+     * @param[out] aStats   A reference to return the latency statistics.
+     *
+     * @retval kErrorNone      Successfully retrieved the statistics.
+     * @retval kErrorNotFound  No server entry at @p aIndex.
+     */
+    Error GetServerLatencyStats(uint8_t aIndex, ServerLatencyStats &aStats) const;
+
+    /**
+     * Resets the response latency statistics of all DNS servers.
+     */
+    void ResetServerLatencyStats(void);
+#endif
+
 private:
     static constexpr uint16_t kMaxCnameAliasNameChanges     = 40;
     static constexpr uint8_t  kLimitedQueryServersArraySize = 3;
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+    static constexpr uint8_t kMaxParallelServers = OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_MAX_SERVERS;
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    static constexpr uint8_t  kMaxLatencyStatsServers  = OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_MAX_SERVERS;
+    static constexpr uint8_t  kNumLatencyBuckets       = OT_DNS_LATENCY_HISTOGRAM_NUM_BUCKETS;
+    static constexpr uint32_t kFirstLatencyBucketLimit = OT_DNS_LATENCY_HISTOGRAM_FIRST_LIMIT;
+#endif
+
     enum QueryType : uint8_t
     {
         kIp6AddressQuery, // IPv6 Address resolution.
@@ -927,11 +1019,59 @@ private:
         Query   *mMainQuery;
         Query   *mNextQuery;
         Message *mSavedResponse;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+        Query *mLeaderQuery;  // The pending main query this (coalesced) query joined.
+        bool   mIsFinalizing; // Main query is being finalized (no longer accepts joining queries).
+#endif
         // Followed by the name (service, host, instance) encoded as a `Dns::Name`.
     };
 
     static constexpr uint16_t kNameOffsetInQuery = sizeof(QueryInfo);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    class Cache : public InstanceLocator, private NonCopyable
+    {
+    public:
+        explicit Cache(Instance &aInstance);
+
+        void                 Clear(void);
+        Message             *Lookup(const Message &aQuery, const QueryInfo &aInfo);
+        void                 Add(const Message &aResponse, const Ip6::SockAddr &aServer);
+        const CacheCounters &GetCounters(void) const { return mCounters; }
+        void                 ResetCounters(void) { mCounters.Clear(); }
+
+    private:
+        static constexpr uint16_t kMaxEntries  = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES;
+        static constexpr uint32_t kMaxSize     = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_SIZE;
+        static constexpr uint32_t kMaxTtl      = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL;
+        static constexpr uint32_t kNegativeTtl = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL;
+        static constexpr uint32_t kInfiniteTtl = NumericLimits<uint32_t>::kMax;
+
+        static_assert(kMaxEntries > 0, "DNS_CLIENT_CACHE_MAX_ENTRIES must be non-zero");
+
+        struct Entry
+        {
+            bool IsInUse(void) const { return !mResponse.IsNull(); }
+            bool IsExpired(TimeMilli aNow) const { return aNow >= mExpireTime; }
+            void Free(void) { mResponse.Free(); }
+
+            OwnedPtr<Message> mResponse;
+            Ip6::SockAddr     mServer;
+            TimeMilli         mInsertTime;
+            TimeMilli         mExpireTime;
+            TimeMilli         mLastUseTime;
+        };
+
+        Entry   *FindMatching(const Message &aMessage, const Ip6::SockAddr &aServer, TimeMilli aNow);
+        Entry   *FindUnused(void);
+        Entry   &Evict(TimeMilli aNow);
+        uint32_t GetTotalSize(void) const;
+
+        Entry         mEntries[kMaxEntries];
+        CacheCounters mCounters;
+    };
+#endif
+
     Error       StartQuery(QueryInfo &aInfo, const char *aLabel, const char *aName, QueryType aSecondType = kNoQuery);
     Error       AllocateQuery(const QueryInfo &aInfo, const char *aLabel, const char *aName, Query *&aQuery);
     void        FreeQuery(Query &aQuery);
@@ -941,11 +1081,12 @@ private:
     uint16_t    DetermineQuestionRecordType(const QueryInfo &aInfo) const;
     void        FinalizeQuery(Query &aQuery, Error aError);
     void        FinalizeQuery(Response &Response, Error aError);
+    void        InvokeCallback(Response &aResponse, Error aError);
     static void GetQueryTypeAndCallback(const Query &aQuery, QueryType &aType, Callback &aCallback, void *&aContext);
     Error       AppendNameFromQuery(const Query &aQuery, Message &aMessage);
     Query      *FindQueryById(uint16_t aMessageId);
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMsgInfo);
-    void        ProcessResponse(const Message &aResponseMessage);
+    void        ProcessResponse(const Message &aResponseMessage, const Ip6::SockAddr *aServerSockAddr);
     Error       ParseResponse(const Message &aResponseMessage, Query *&aQuery, Error &aResponseError);
     bool        CanFinalizeQuery(Query &aQuery);
     void        SaveQueryResponse(Query &aQuery, const Message &aResponseMessage);
@@ -974,6 +1115,31 @@ private:
     void UpdateDefaultConfigAddress(void);
 #endif
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    Error AnswerFromCache(const Message &aQueryMessage, const QueryInfo &aInfo);
+    void  HandleCacheTask(void);
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    Error       JoinPendingQuery(Query &aQuery);
+    void        FinalizeCoalescedQueries(const Response &aResponse, Error aError);
+    Query      *FindCoalescedQuery(const Query &aMainQuery);
+    static bool CanCoalesce(const Query     &aQuery,
+                            const QueryInfo &aInfo,
+                            const Query     &aOther,
+                            const QueryInfo &aOtherInfo);
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+    bool          ShouldSendToParallelServers(const QueryInfo &aInfo) const;
+    void          SendToParallelServers(const Message &aMessage, const QueryInfo &aInfo);
+    Ip6::SockAddr GetParallelServerSockAddr(const Ip6::SockAddr &aServer) const;
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    void RecordLatency(const QueryInfo &aInfo, const Ip6::SockAddr &aServerSockAddr);
+#endif
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
     static void HandleTcpEstablishedCallback(otTcpEndpoint *aEndpoint);
     static void HandleTcpSendDoneCallback(otTcpEndpoint *aEndpoint, otLinkedBuffer *aData);
@@ -1002,6 +1168,9 @@ private:
 
     using RetryTimer   = TimerMilliIn<Client, &Client::HandleTimer>;
     using ClientSocket = Ip6::Udp::SocketIn<Client, &Client::HandleUdpReceive>;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    using CacheTask = TaskletIn<Client, &Client::HandleCacheTask>;
+#endif
 
     ClientSocket mSocket;
 
@@ -1022,12 +1191,32 @@ private:
     bool mUserDidSetDefaultAddress;
 #endif
     Array<Ip6::Address, kLimitedQueryServersArraySize> mLimitedQueryServers;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    Cache        mCache;
+    MessageQueue mCachedResponses;
+    CacheTask    mCacheTask;
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    QueryList mCoalescedQueries;
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+    Array<Ip6::SockAddr, kMaxParallelServers> mParallelServers;
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    ServerLatencyStats mLatencyStats[kMaxLatencyStatsServers];
+#endif
 };
 
 } // namespace Dns
 
 DefineCoreType(otDnsQueryConfig, Dns::Client::QueryConfig);
 DefineCoreType(otDnsAddressResponse, Dns::Client::AddressResponse);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+DefineCoreType(otDnsCacheCounters, Dns::Client::CacheCounters);
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+DefineCoreType(otDnsServerLatencyStats, Dns::Client::ServerLatencyStats);
+#endif
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 DefineCoreType(otDnsBrowseResponse, Dns::Client::BrowseResponse);
 DefineCoreType(otDnsServiceResponse, Dns::Client::ServiceResponse);
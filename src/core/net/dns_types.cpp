@@ -33,6 +33,7 @@
 
 #include "dns_types.hpp"
 
+#include "common/fnv_hash.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -880,6 +881,28 @@ bool Name::IsSameDomain(const char *aDomain1, const char *aDomain2)
     return IsSubDomainOf(aDomain1, aDomain2) && IsSubDomainOf(aDomain2, aDomain1);
 }
 
+uint32_t Name::CalculateHash(const char *aName)
+{
+    // FNV-1a hash over lowercase chars.
+
+    Fnv1aHash hash;
+
+    VerifyOrExit(aName != nullptr);
+
+    for (; *aName != kNullChar; aName++)
+    {
+        if ((aName[0] == kLabelSeparatorChar) && (aName[1] == kNullChar))
+        {
+            break;
+        }
+
+        hash.AddByte(static_cast<uint8_t>(ToLowercase(*aName)));
+    }
+
+exit:
+    return hash.GetHash();
+}
+
 void ResourceRecord::UpdateRecordLengthInMessage(Message &aMessage, uint16_t aOffset)
 {
     ResourceRecord record;
@@ -907,6 +930,95 @@ exit:
     return error;
 }
 
+Error ResourceRecord::UpdateTtlsInMessage(Message &aMessage, uint32_t aElapsed, uint32_t aMaxTtl, uint32_t &aMinTtl)
+{
+    Error    error;
+    uint16_t offset = aMessage.GetOffset();
+    uint32_t recordCount;
+    Header   header;
+
+    SuccessOrExit(error = aMessage.Read(offset, header));
+    offset += sizeof(Header);
+
+    for (uint16_t count = header.GetQuestionCount(); count > 0; count--)
+    {
+        SuccessOrExit(error = Name::ParseName(aMessage, offset));
+        offset += sizeof(Question);
+    }
+
+    recordCount = static_cast<uint32_t>(header.GetAnswerCount()) + header.GetAuthorityRecordCount() +
+                  header.GetAdditionalRecordCount();
+
+    for (; recordCount > 0; recordCount--)
+    {
+        ResourceRecord record;
+
+        SuccessOrExit(error = Name::ParseName(aMessage, offset));
+        SuccessOrExit(error = record.ReadFrom(aMessage, offset));
+
+        if (record.GetType() != kTypeOpt)
+        {
+            uint32_t ttl = Min(record.GetTtl() - Min(record.GetTtl(), aElapsed), aMaxTtl);
+
+            if (ttl != record.GetTtl())
+            {
+                record.SetTtl(ttl);
+                aMessage.Write(offset, record);
+            }
+
+            aMinTtl = Min(aMinTtl, ttl);
+        }
+
+        offset += static_cast<uint16_t>(record.GetSize());
+    }
+
+exit:
+    return error;
+}
+
+Error ResourceRecord::ReadNegativeCacheTtl(const Message &aMessage, uint32_t &aTtl)
+{
+    // The MINIMUM is the last field in the SOA record data.
+
+    Error    error;
+    uint16_t offset = aMessage.GetOffset();
+    Header   header;
+
+    SuccessOrExit(error = aMessage.Read(offset, header));
+    offset += sizeof(Header);
+
+    for (uint16_t count = header.GetQuestionCount(); count > 0; count--)
+    {
+        SuccessOrExit(error = Name::ParseName(aMessage, offset));
+        offset += sizeof(Question);
+    }
+
+    SuccessOrExit(error = ParseRecords(aMessage, offset, header.GetAnswerCount()));
+
+    for (uint16_t count = header.GetAuthorityRecordCount(); count > 0; count--)
+    {
+        ResourceRecord record;
+        uint32_t       minimum;
+
+        SuccessOrExit(error = Name::ParseName(aMessage, offset));
+        SuccessOrExit(error = record.ReadFrom(aMessage, offset));
+
+        if ((record.GetType() == kTypeSoa) && (record.GetLength() >= sizeof(uint32_t)))
+        {
+            SuccessOrExit(error = aMessage.Read(offset + record.GetSize() - sizeof(uint32_t), minimum));
+            aTtl = Min(record.GetTtl(), BigEndian::HostSwap32(minimum));
+            ExitNow();
+        }
+
+        offset += static_cast<uint16_t>(record.GetSize());
+    }
+
+    error = kErrorNotFound;
+
+exit:
+    return error;
+}
+
 Error ResourceRecord::FindRecord(const Message &aMessage, uint16_t &aOffset, uint16_t &aNumRecords, const Name &aName)
 {
     Error error;
@@ -1305,6 +1417,44 @@ ResourceRecord::TypeInfoString ResourceRecord::TypeToString(uint16_t aRecordType
     return string;
 }
 
+bool Question::QuestionsMatch(const Message &aMessage1, const Message &aMessage2)
+{
+    bool     matches = false;
+    uint16_t offset1 = aMessage1.GetOffset();
+    uint16_t offset2 = aMessage2.GetOffset();
+    Header   header1;
+    Header   header2;
+
+    SuccessOrExit(aMessage1.Read(offset1, header1));
+    SuccessOrExit(aMessage2.Read(offset2, header2));
+    VerifyOrExit(header1.GetQuestionCount() == header2.GetQuestionCount());
+
+    offset1 += sizeof(Header);
+    offset2 += sizeof(Header);
+
+    for (uint16_t count = header1.GetQuestionCount(); count > 0; count--)
+    {
+        Question question1;
+        Question question2;
+
+        SuccessOrExit(Name::CompareName(aMessage1, offset1, aMessage2, offset2));
+        SuccessOrExit(Name::ParseName(aMessage2, offset2));
+
+        SuccessOrExit(aMessage1.Read(offset1, question1));
+        SuccessOrExit(aMessage2.Read(offset2, question2));
+        VerifyOrExit(question1.GetType() == question2.GetType());
+        VerifyOrExit(question1.GetClass() == question2.GetClass());
+
+        offset1 += sizeof(Question);
+        offset2 += sizeof(Question);
+    }
+
+    matches = true;
+
+exit:
+    return matches;
+}
+
 void TxtEntry::Iterator::Init(const uint8_t *aTxtData, uint16_t aTxtDataLength)
 {
     SetTxtData(aTxtData);
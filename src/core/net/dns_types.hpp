@@ -1056,6 +1056,19 @@ public:
      */
     static bool IsSameDomain(const char *aDomain1, const char *aDomain2);
 
+    /**
+     * Calculates a case-insensitive hash of a DNS name.
+     *
+     * A trailing dot ('.') in @p aName is ignored, so "host.local" and "host.local." have the same hash. Two names
+     * that match (case-insensitively) always have the same hash, so the hash can be used to quickly rule out a match
+     * before performing a full name comparison.
+     *
+     * @param[in] aName   The dot-separated name.
+     *
+     * @returns The hash of @p aName.
+     */
+    static uint32_t CalculateHash(const char *aName);
+
 private:
     // The first 2 bits of the encoded label specifies label type.
     //
@@ -1577,6 +1590,39 @@ public:
      */
     static Error ParseRecords(const Message &aMessage, uint16_t &aOffset, uint16_t aNumRecords);
 
+    /**
+     * Updates the TTLs of all resource records in a DNS message.
+     *
+     * Decrements the TTL of every record in the answer, authority and additional sections by a given number of
+     * seconds (saturating at zero) and caps it to a given maximum. The OPT pseudo-record is skipped since its TTL field
+     * carries the extended response code and flags.
+     *
+     * @param[in]     aMessage   The message to update. `aMessage.GetOffset()` MUST point to the start of DNS header.
+     * @param[in]     aElapsed   The number of seconds to subtract from each TTL.
+     * @param[in]     aMaxTtl    The maximum TTL (in seconds).
+     * @param[in,out] aMinTtl    On input, an initial minimum TTL. On exit, the minimum of its input value and all the
+     *                           updated TTLs.
+     *
+     * @retval kErrorNone      Updated the TTLs successfully.
+     * @retval kErrorParse     Could not parse the records from @p aMessage.
+     */
+    static Error UpdateTtlsInMessage(Message &aMessage, uint32_t aElapsed, uint32_t aMaxTtl, uint32_t &aMinTtl);
+
+    /**
+     * Reads the negative caching TTL of a DNS response.
+     *
+     * The negative caching TTL is the minimum of the TTL of the first SOA record in the authority section and the
+     * MINIMUM field of that SOA record (RFC 2308 - section 5).
+     *
+     * @param[in]  aMessage   The response message. `aMessage.GetOffset()` MUST point to the start of DNS header.
+     * @param[out] aTtl       A reference to return the negative caching TTL (in seconds).
+     *
+     * @retval kErrorNone       Read the negative caching TTL successfully. @p aTtl is updated.
+     * @retval kErrorNotFound   The authority section of @p aMessage contains no SOA record.
+     * @retval kErrorParse      Could not parse the records from @p aMessage.
+     */
+    static Error ReadNegativeCacheTtl(const Message &aMessage, uint32_t &aTtl);
+
     /**
      * Searches in a given message to find the first resource record matching a given record name.
      *
@@ -2985,6 +3031,20 @@ public:
      */
     void SetClass(uint16_t aClass) { mClass = BigEndian::HostSwap16(aClass); }
 
+    /**
+     * Indicates whether the question sections of two DNS messages match.
+     *
+     * The question sections match if they contain the same number of questions and the questions at the same position
+     * have the same name, type and class.
+     *
+     * @param[in] aMessage1  The first message. `aMessage1.GetOffset()` MUST point to the start of DNS header.
+     * @param[in] aMessage2  The second message. `aMessage2.GetOffset()` MUST point to the start of DNS header.
+     *
+     * @retval TRUE   The question sections match.
+     * @retval FALSE  The question sections do not match or could not be parsed.
+     */
+    static bool QuestionsMatch(const Message &aMessage1, const Message &aMessage2);
+
 private:
     uint16_t mType;  // The type of the data in question section.
     uint16_t mClass; // The class of the data in question section.
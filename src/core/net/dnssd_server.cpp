@@ -61,6 +61,9 @@ Server::Server(Instance &aInstance)
 #if OPENTHREAD_CONFIG_DNSSD_DISCOVERY_PROXY_ENABLE
     , mDiscoveryProxy(aInstance)
 #endif
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    , mAnswerCache(aInstance)
+#endif
 #if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
     , mEnableUpstreamQuery(false)
 #endif
@@ -129,6 +132,10 @@ void Server::Stop(void)
 
     mTimer.Stop();
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    mAnswerCache.Clear();
+#endif
+
     IgnoreError(mSocket.Close());
     LogInfo("Stopped");
 
@@ -172,7 +179,14 @@ void Server::ProcessQuery(Request &aRequest)
 #if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
     if (ShouldForwardToUpstream(aRequest))
     {
-        if (ResolveByUpstream(aRequest) == kErrorNone)
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+        if (mAnswerCache.Answer(aRequest) == kErrorNone)
+        {
+            ExitNow();
+        }
+#endif
+
+        if (ResolveByUpstream(aRequest, /* aIsPrefetch */ false) == kErrorNone)
         {
             ExitNow();
         }
@@ -223,6 +237,17 @@ void Server::ProcessQuery(Request &aRequest)
     }
 #endif
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    // Before starting a new proxy query, check whether an earlier
+    // proxy response (possibly to a different client) can be used.
+
+    if (mAnswerCache.Answer(aRequest) == kErrorNone)
+    {
+        shouldRespond = false;
+        ExitNow();
+    }
+#endif
+
     // `ResolveByProxy` may take ownership of `response.mMessage` and
     // setting it to `nullptr`. In such a case, the `response.Send()`
     // call will effectively do nothing.
@@ -247,6 +272,10 @@ Server::Response::Response(Instance &aInstance)
     // `mHeader` constructors already clears it
 
     mOffsets.Clear();
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    mIsProxyResponse = false;
+#endif
 }
 
 Error Server::Response::AllocateAndInitFrom(const Request &aRequest)
@@ -294,6 +323,13 @@ void Server::Response::Send(const Ip6::MessageInfo &aMessageInfo)
 
     mMessage->Write(0, mHeader);
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    if (mIsProxyResponse)
+    {
+        Get<Server>().mAnswerCache.Add(*mMessage, AnswerCache::kFromProxy);
+    }
+#endif
+
     SuccessOrExit(Get<Server>().mSocket.SendTo(*mMessage, aMessageInfo));
 
     // When `SendTo()` returns success it takes over ownership of
@@ -841,42 +877,62 @@ void Server::Response::Log(void) const
 
 Error Server::Response::ResolveBySrp(void)
 {
+    static const char kSubTypeLabel[] = "._sub.";
+
     Error                       error          = kErrorNone;
+    const Srp::Server          &srpServer      = Get<Srp::Server>();
+    const Srp::Server::Host    *host           = nullptr;
+    const Srp::Server::Service *service        = nullptr;
     const Srp::Server::Service *matchedService = nullptr;
+    uint16_t                    offset         = sizeof(Header);
+    Name::Buffer                name;
+    const char                 *subPos;
+    uint32_t                    nameHash;
+    uint32_t                    serviceNameHash;
 
     mSection = kAnswerSection;
 
-    for (const Srp::Server::Host &host : Get<Srp::Server>().GetHosts())
+    // The SRP server keeps its hosts and services in hash tables
+    // keyed by the host name, the service instance name, and the
+    // base service name. We look up the hash of the query name in
+    // these tables and compare the full names only for the entries
+    // with a matching hash.
+
+    VerifyOrExit(Name::ReadName(*mMessage, offset, name) == kErrorNone, error = kErrorNotFound);
+    nameHash = Name::CalculateHash(name);
+
+    while ((host = srpServer.mHostNameTable.FindNext(nameHash, host)) != nullptr)
     {
-        if (host.IsDeleted())
+        if (!host->IsDeleted() && QueryNameMatches(host->GetFullName()))
         {
-            continue;
+            error = ResolveUsingSrpHost(*host);
+            ExitNow();
         }
+    }
 
-        if (QueryNameMatches(host.GetFullName()))
+    while ((service = srpServer.mInstanceNameTable.FindNext(nameHash, service)) != nullptr)
+    {
+        if (!IsDeleted(*service) && QueryNameMatches(service->GetInstanceName()))
         {
-            error = ResolveUsingSrpHost(host);
+            error = ResolveUsingSrpService(*service);
             ExitNow();
         }
+    }
 
-        for (const Srp::Server::Service &service : host.GetServices())
-        {
-            if (service.IsDeleted())
-            {
-                continue;
-            }
+    VerifyOrExit(mQuestions.IsFor(kRrTypePtr) || mQuestions.IsFor(kRrTypeAny), error = kErrorNotFound);
 
-            if (QueryNameMatches(service.GetInstanceName()))
-            {
-                error = ResolveUsingSrpService(service);
-                ExitNow();
-            }
+    // For a sub-type service name, we look up the services by the
+    // base service name that follows the "._sub." label.
 
-            if ((mQuestions.IsFor(kRrTypePtr) || mQuestions.IsFor(kRrTypeAny)) && QueryNameMatchesService(service))
-            {
-                SuccessOrExit(error = AppendPtrRecord(service));
-                matchedService = &service;
-            }
+    subPos          = StringFind(name, kSubTypeLabel, kStringCaseInsensitiveMatch);
+    serviceNameHash = (subPos == nullptr) ? nameHash : Name::CalculateHash(subPos + sizeof(kSubTypeLabel) - 1);
+
+    while ((service = srpServer.mServiceNameTable.FindNext(serviceNameHash, service)) != nullptr)
+    {
+        if (!IsDeleted(*service) && QueryNameMatchesService(*service, nameHash))
+        {
+            SuccessOrExit(error = AppendPtrRecord(*service));
+            matchedService = service;
         }
     }
 
@@ -895,6 +951,11 @@ exit:
     return error;
 }
 
+bool Server::Response::IsDeleted(const Srp::Server::Service &aService) const
+{
+    return aService.IsDeleted() || aService.GetHost().IsDeleted();
+}
+
 Error Server::Response::ResolveUsingSrpHost(const Srp::Server::Host &aHost)
 {
     // The query name is already checked to match the `aHost` name.
@@ -939,12 +1000,12 @@ exit:
     return error;
 }
 
-bool Server::Response::QueryNameMatchesService(const Srp::Server::Service &aService) const
+bool Server::Response::QueryNameMatchesService(const Srp::Server::Service &aService, uint32_t aQueryNameHash) const
 {
     // Check if the query name matches the base service name or any
     // sub-type service names associated with `aService`.
 
-    bool matches = QueryNameMatches(aService.GetServiceName());
+    bool matches = (aService.GetServiceNameHash() == aQueryNameHash) && QueryNameMatches(aService.GetServiceName());
 
     VerifyOrExit(!matches);
 
@@ -1140,13 +1201,26 @@ void Server::OnUpstreamQueryDone(UpstreamQueryTransaction &aQueryTransaction, Me
 
     VerifyOrExit(aQueryTransaction.IsValid(), error = kErrorInvalidArgs);
 
-    if (aResponseMessage != nullptr)
+    if (aResponseMessage == nullptr)
     {
-        error = mSocket.SendTo(*aResponseMessage, aQueryTransaction.GetMessageInfo());
+        error = kErrorResponseTimeout;
+    }
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    else if (aQueryTransaction.IsPrefetch())
+    {
+        // A prefetch only refreshes the cached entry, there is no
+        // client waiting for the response.
+
+        mAnswerCache.Add(*aResponseMessage, AnswerCache::kFromUpstream);
+        aResponseMessage->Free();
     }
+#endif
     else
     {
-        error = kErrorResponseTimeout;
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+        mAnswerCache.Add(*aResponseMessage, AnswerCache::kFromUpstream);
+#endif
+        error = mSocket.SendTo(*aResponseMessage, aQueryTransaction.GetMessageInfo());
     }
 
     ResetUpstreamQueryTransaction(aQueryTransaction, error);
@@ -1178,7 +1252,7 @@ exit:
     return newTxn;
 }
 
-Error Server::ResolveByUpstream(const Request &aRequest)
+Error Server::ResolveByUpstream(const Request &aRequest, bool aIsPrefetch)
 {
     Error                     error = kErrorNone;
     UpstreamQueryTransaction *txn;
@@ -1186,6 +1260,15 @@ Error Server::ResolveByUpstream(const Request &aRequest)
     txn = AllocateUpstreamQueryTransaction(*aRequest.mMessageInfo);
     VerifyOrExit(txn != nullptr, error = kErrorNoBufs);
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    if (aIsPrefetch)
+    {
+        txn->SetPrefetch();
+    }
+#else
+    OT_UNUSED_VARIABLE(aIsPrefetch);
+#endif
+
     VerifyOrExit(otPlatDnsIsUpstreamQueryAvailable(&GetInstance()), error = kErrorInvalidState);
 
     otPlatDnsStartUpstreamQuery(&GetInstance(), txn, aRequest.mMessage);
@@ -1412,6 +1495,10 @@ void Server::Response::InitFrom(ProxyQuery &aQuery, const ProxyQueryInfo &aInfo)
     IgnoreError(mMessage->Read(0, mHeader));
     mQuestions = aInfo.mQuestions;
     mOffsets   = aInfo.mOffsets;
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    mIsProxyResponse = true;
+#endif
 }
 
 void Server::Response::Answer(const ServiceInstanceInfo &aInstanceInfo, const Ip6::MessageInfo &aMessageInfo)
@@ -1637,6 +1724,9 @@ void Server::UpstreamQueryTransaction::Init(const Ip6::MessageInfo &aMessageInfo
     mMessageInfo = aMessageInfo;
     mValid       = true;
     mExpireTime  = TimerMilli::GetNow() + kQueryTimeout;
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    mIsPrefetch = false;
+#endif
 }
 
 void Server::ResetUpstreamQueryTransaction(UpstreamQueryTransaction &aTxn, Error aError)
@@ -1659,6 +1749,346 @@ void Server::ResetUpstreamQueryTransaction(UpstreamQueryTransaction &aTxn, Error
 }
 #endif
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+
+Server::AnswerCache::AnswerCache(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mSendingEntry(nullptr)
+{
+    mCounters.Clear();
+}
+
+void Server::AnswerCache::Clear(void)
+{
+    for (Entry &entry : mEntries)
+    {
+        entry.Free();
+    }
+}
+
+void Server::AnswerCache::Invalidate(Source aSource)
+{
+    for (Entry &entry : mEntries)
+    {
+        if (entry.IsInUse() && (entry.mSource == aSource))
+        {
+            entry.Free();
+        }
+    }
+}
+
+void Server::AnswerCache::Invalidate(Source aSource, const char *aName)
+{
+    for (Entry &entry : mEntries)
+    {
+        if (entry.IsInUse() && (entry.mSource == aSource) && QueryNameMatches(*entry.mResponse, aName))
+        {
+            entry.Free();
+        }
+    }
+}
+
+Error Server::AnswerCache::ReleaseEntry(void)
+{
+    Error  error = kErrorNone;
+    Entry *entry = FindLruEntry();
+
+    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
+
+    entry->Free();
+    mCounters.mEvictions++;
+
+exit:
+    return error;
+}
+
+Error Server::AnswerCache::Answer(const Request &aRequest)
+{
+    Error     error = kErrorNotFound;
+    TimeMilli now   = TimerMilli::GetNow();
+    Entry    *entry;
+
+    entry = FindMatching(*aRequest.mMessage, now);
+
+    if (entry == nullptr)
+    {
+        mCounters.mMisses++;
+        ExitNow();
+    }
+
+    SuccessOrExit(error = SendFrom(*entry, aRequest, now));
+
+    mCounters.mHits++;
+    entry->mLastUseTime = now;
+
+    if (entry->mHits < NumericLimits<uint16_t>::kMax)
+    {
+        entry->mHits++;
+    }
+
+#if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
+    if (entry->ShouldPrefetch(now) && (Get<Server>().ResolveByUpstream(aRequest, /* aIsPrefetch */ true) == kErrorNone))
+    {
+        entry->mPrefetchPending = true;
+        mCounters.mPrefetches++;
+    }
+#endif
+
+exit:
+    return error;
+}
+
+void Server::AnswerCache::Add(const Message &aResponse, Source aSource)
+{
+    Error     error = kErrorNone;
+    TimeMilli now   = TimerMilli::GetNow();
+    uint32_t  ttl   = kInfiniteTtl;
+    Message  *copy  = nullptr;
+    Entry    *entry = nullptr;
+    Header    header;
+
+    SuccessOrExit(error = aResponse.Read(0, header));
+
+    VerifyOrExit(header.GetType() == Header::kTypeResponse);
+    VerifyOrExit(!header.IsTruncationFlagSet());
+    VerifyOrExit(header.GetQuestionCount() > 0);
+    VerifyOrExit((header.GetResponseCode() == Header::kResponseSuccess) ||
+                 (header.GetResponseCode() == Header::kResponseNameError));
+
+    copy = aResponse.Clone<kNoReservedHeader>();
+    VerifyOrExit(copy != nullptr, error = kErrorNoBufs);
+    VerifyOrExit(copy->GetBufferCount() <= kMaxBuffers);
+
+    SuccessOrExit(error = ResourceRecord::UpdateTtlsInMessage(*copy, /* aElapsed */ 0, kMaxTtl, ttl));
+
+    if ((header.GetResponseCode() == Header::kResponseNameError) || (header.GetAnswerCount() == 0))
+    {
+        // A negative response is kept for the TTL determined from
+        // the SOA record in its authority section (RFC 2308 Section
+        // 5) and never longer than `kNegativeTtl`. An upstream
+        // negative response without an SOA record is not cached.
+        // Discovery Proxy responses do not include one.
+
+        uint32_t negativeTtl;
+
+        if (ResourceRecord::ReadNegativeCacheTtl(*copy, negativeTtl) == kErrorNone)
+        {
+            ttl = Min(negativeTtl, kNegativeTtl);
+        }
+        else
+        {
+            VerifyOrExit(aSource == kFromProxy);
+            ttl = kNegativeTtl;
+        }
+    }
+
+    ttl = Min(ttl, kMaxTtl);
+    VerifyOrExit(ttl > 0);
+
+    entry = FindMatching(aResponse, now);
+
+    if (entry == nullptr)
+    {
+        entry = AllocateEntry(now);
+        VerifyOrExit(entry != nullptr);
+        entry->mHits = 0;
+    }
+
+    // Free the earlier response of a matching entry first, so that
+    // it is not counted, then evict the least recently used entries
+    // until the new response fits within `kMaxBuffers`.
+
+    entry->Free();
+
+    while (GetBufferCount() + copy->GetBufferCount() > kMaxBuffers)
+    {
+        Entry *lruEntry = FindLruEntry();
+
+        VerifyOrExit(lruEntry != nullptr);
+        lruEntry->Free();
+        mCounters.mEvictions++;
+    }
+
+    entry->mResponse.Reset(copy);
+    copy = nullptr;
+
+    entry->mInsertTime      = now;
+    entry->mExpireTime      = now + Time::SecToMsec(ttl);
+    entry->mLastUseTime     = now;
+    entry->mTtl             = ttl;
+    entry->mSource          = aSource;
+    entry->mPrefetchPending = false;
+
+    mCounters.mInsertions++;
+
+exit:
+    if (copy != nullptr)
+    {
+        copy->Free();
+    }
+
+    LogWarnOnError(error, "add response to answer cache");
+}
+
+Server::AnswerCache::Entry *Server::AnswerCache::FindMatching(const Message &aMessage, TimeMilli aNow)
+{
+    Entry *match = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsInUse())
+        {
+            continue;
+        }
+
+        if (entry.IsExpired(aNow))
+        {
+            entry.Free();
+            continue;
+        }
+
+        if (Question::QuestionsMatch(*entry.mResponse, aMessage))
+        {
+            match = &entry;
+            break;
+        }
+    }
+
+    return match;
+}
+
+Server::AnswerCache::Entry *Server::AnswerCache::FindLruEntry(void)
+{
+    // Finds the least recently used entry that can be freed. The
+    // entry whose response is being copied by `SendFrom()` is
+    // skipped since the copy may need new buffers and in turn call
+    // `ReleaseEntry()`.
+
+    Entry *lruEntry = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsInUse() || (&entry == mSendingEntry))
+        {
+            continue;
+        }
+
+        if ((lruEntry == nullptr) || (entry.mLastUseTime < lruEntry->mLastUseTime))
+        {
+            lruEntry = &entry;
+        }
+    }
+
+    return lruEntry;
+}
+
+Server::AnswerCache::Entry *Server::AnswerCache::AllocateEntry(TimeMilli aNow)
+{
+    // Use a free or an expired entry if there is one, otherwise
+    // evict the least recently used entry.
+
+    Entry *entry;
+
+    for (Entry &freeEntry : mEntries)
+    {
+        if (!freeEntry.IsInUse() || freeEntry.IsExpired(aNow))
+        {
+            entry = &freeEntry;
+            ExitNow();
+        }
+    }
+
+    entry = FindLruEntry();
+    VerifyOrExit(entry != nullptr);
+
+    mCounters.mEvictions++;
+
+exit:
+    if (entry != nullptr)
+    {
+        entry->Free();
+    }
+
+    return entry;
+}
+
+uint16_t Server::AnswerCache::GetBufferCount(void) const
+{
+    uint16_t count = 0;
+
+    for (const Entry &entry : mEntries)
+    {
+        if (entry.IsInUse())
+        {
+            count += entry.mResponse->GetBufferCount();
+        }
+    }
+
+    return count;
+}
+
+Error Server::AnswerCache::SendFrom(Entry &aEntry, const Request &aRequest, TimeMilli aNow)
+{
+    Error    error  = kErrorNone;
+    uint32_t minTtl = kInfiniteTtl;
+    uint32_t maxTtl = DivideAndRoundUp<uint32_t>(aEntry.mExpireTime - aNow, Time::kOneSecondInMsec);
+    Message *response;
+    Header   header;
+
+    mSendingEntry = &aEntry;
+
+    response = Get<Server>().mSocket.NewMessage();
+    VerifyOrExit(response != nullptr, error = kErrorNoBufs);
+
+    // The TTLs are capped to the remaining lifetime of the entry so
+    // that the client does not keep the records longer than the
+    // cache would.
+
+    SuccessOrExit(error = response->AppendBytesFromMessage(*aEntry.mResponse, 0, aEntry.mResponse->GetLength()));
+    SuccessOrExit(error = ResourceRecord::UpdateTtlsInMessage(*response, aEntry.GetElapsedSeconds(aNow), maxTtl,
+                                                              minTtl));
+
+    // The cached response may have been sent to a different client,
+    // so update the header to match the new query.
+
+    IgnoreError(response->Read(0, header));
+    header.SetMessageId(aRequest.mHeader.GetMessageId());
+
+    if (aRequest.mHeader.IsRecursionDesiredFlagSet())
+    {
+        header.SetRecursionDesiredFlag();
+    }
+    else
+    {
+        header.ClearRecursionDesiredFlag();
+    }
+
+    response->Write(0, header);
+
+    SuccessOrExit(error = Get<Server>().mSocket.SendTo(*response, *aRequest.mMessageInfo));
+
+    LogInfo("Send response from answer cache, rcode:%u", header.GetResponseCode());
+
+    Get<Server>().UpdateResponseCounters(header.GetResponseCode());
+
+exit:
+    mSendingEntry = nullptr;
+    FreeMessageOnError(response, error);
+    return error;
+}
+
+bool Server::AnswerCache::Entry::ShouldPrefetch(TimeMilli aNow) const
+{
+    // Only upstream responses are prefetched. Discovery Proxy
+    // responses are backed by the mDNS cache and their TTLs are
+    // capped to a few seconds (RFC 8766).
+
+    return (mSource == kFromUpstream) && !mPrefetchPending && (mHits >= kPrefetchHits) &&
+           (mExpireTime - aNow <= Time::SecToMsec(mTtl) / 100 * kPrefetchPct);
+}
+
+#endif // OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+
 #if OPENTHREAD_CONFIG_DNSSD_DISCOVERY_PROXY_ENABLE
 
 Server::DiscoveryProxy::DiscoveryProxy(Instance &aInstance)
@@ -2151,8 +2581,8 @@ void Server::DiscoveryProxy::HandleBrowseResult(const Dnssd::BrowseResult &aResu
     Name::Buffer serviceName;
 
     VerifyOrExit(mIsRunning);
-    VerifyOrExit(aResult.mTtl != 0);
     VerifyOrExit(aResult.mInfraIfIndex == Get<BorderRouter::InfraIf>().GetIfIndex());
+    VerifyOrExit(aResult.mTtl != 0, HandleRemovedResult());
 
     if (aResult.mSubTypeLabel != nullptr)
     {
@@ -2179,8 +2609,8 @@ void Server::DiscoveryProxy::HandleSrvResult(const Dnssd::SrvResult &aResult)
     Name::Buffer instanceName;
 
     VerifyOrExit(mIsRunning);
-    VerifyOrExit(aResult.mTtl != 0);
     VerifyOrExit(aResult.mInfraIfIndex == Get<BorderRouter::InfraIf>().GetIfIndex());
+    VerifyOrExit(aResult.mTtl != 0, HandleRemovedResult());
 
     ConstructFullInstanceName(aResult.mServiceInstance, aResult.mServiceType, instanceName);
     HandleResult(kResolvingSrv, instanceName, &Response::AppendSrvRecord, ProxyResult(aResult));
@@ -2199,8 +2629,8 @@ void Server::DiscoveryProxy::HandleTxtResult(const Dnssd::TxtResult &aResult)
     Name::Buffer instanceName;
 
     VerifyOrExit(mIsRunning);
-    VerifyOrExit(aResult.mTtl != 0);
     VerifyOrExit(aResult.mInfraIfIndex == Get<BorderRouter::InfraIf>().GetIfIndex());
+    VerifyOrExit(aResult.mTtl != 0, HandleRemovedResult());
 
     ConstructFullInstanceName(aResult.mServiceInstance, aResult.mServiceType, instanceName);
     HandleResult(kResolvingTxt, instanceName, &Response::AppendTxtRecord, ProxyResult(aResult));
@@ -2216,7 +2646,8 @@ void Server::DiscoveryProxy::HandleIp6AddressResult(otInstance *aInstance, const
 
 void Server::DiscoveryProxy::HandleIp6AddressResult(const Dnssd::AddressResult &aResult)
 {
-    bool         hasValidAddress = false;
+    bool         hasValidAddress   = false;
+    bool         hasRemovedAddress = false;
     Name::Buffer fullHostName;
 
     VerifyOrExit(mIsRunning);
@@ -2229,16 +2660,21 @@ void Server::DiscoveryProxy::HandleIp6AddressResult(const Dnssd::AddressResult &
 
         if (entry.mTtl == 0)
         {
+            hasRemovedAddress = true;
             continue;
         }
 
         if (IsProxyAddressValid(address))
         {
             hasValidAddress = true;
-            break;
         }
     }
 
+    if (hasRemovedAddress)
+    {
+        HandleRemovedResult();
+    }
+
     VerifyOrExit(hasValidAddress);
 
     ConstructFullName(aResult.mHostName, fullHostName);
@@ -2255,7 +2691,8 @@ void Server::DiscoveryProxy::HandleIp4AddressResult(otInstance *aInstance, const
 
 void Server::DiscoveryProxy::HandleIp4AddressResult(const Dnssd::AddressResult &aResult)
 {
-    bool         hasValidAddress = false;
+    bool         hasValidAddress   = false;
+    bool         hasRemovedAddress = false;
     Name::Buffer fullHostName;
 
     VerifyOrExit(mIsRunning);
@@ -2268,16 +2705,21 @@ void Server::DiscoveryProxy::HandleIp4AddressResult(const Dnssd::AddressResult &
 
         if (entry.mTtl == 0)
         {
+            hasRemovedAddress = true;
             continue;
         }
 
         if (address.IsIp4Mapped())
         {
             hasValidAddress = true;
-            break;
         }
     }
 
+    if (hasRemovedAddress)
+    {
+        HandleRemovedResult();
+    }
+
     VerifyOrExit(hasValidAddress);
 
     ConstructFullName(aResult.mHostName, fullHostName);
@@ -2297,8 +2739,8 @@ void Server::DiscoveryProxy::HandleRecordResult(const Dnssd::RecordResult &aResu
     Name::Buffer name;
 
     VerifyOrExit(mIsRunning);
-    VerifyOrExit(aResult.mTtl != 0);
     VerifyOrExit(aResult.mInfraIfIndex == Get<BorderRouter::InfraIf>().GetIfIndex());
+    VerifyOrExit(aResult.mTtl != 0, HandleRemovedResult());
 
     ConstructFullName(aResult.mFirstLabel, aResult.mNextLabels, name);
     HandleResult(kQueryingRecord, name, &Response::AppendGenericRecord, ProxyResult(aResult));
@@ -2325,6 +2767,11 @@ void Server::DiscoveryProxy::HandleResult(ProxyAction         aAction,
     ProxyAction    nextAction;
     uint16_t       querierRrType;
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    // Cached responses to a query for `aName` may now be stale.
+    Get<Server>().mAnswerCache.Invalidate(AnswerCache::kFromProxy, aName);
+#endif
+
     querierRrType = (aAction == kQueryingRecord) ? aResult.mRecordResult->mRecordType : 0;
 
     for (ProxyQuery &query : Get<Server>().mProxyQueries)
@@ -2439,6 +2886,17 @@ void Server::DiscoveryProxy::HandleResult(ProxyAction         aAction,
     }
 }
 
+void Server::DiscoveryProxy::HandleRemovedResult(void)
+{
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    // A removed record may be included in any cached Discovery Proxy
+    // response (e.g., a host address in the additional section), so
+    // all of them are invalidated.
+
+    Get<Server>().mAnswerCache.Invalidate(AnswerCache::kFromProxy);
+#endif
+}
+
 bool Server::DiscoveryProxy::IsActionForAdditionalSection(ProxyAction aAction, const Questions &aQuestions)
 {
     bool     isForAddnlSection = false;
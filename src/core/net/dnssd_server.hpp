@@ -160,10 +160,28 @@ public:
          */
         const Ip6::MessageInfo &GetMessageInfo(void) const { return mMessageInfo; }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+        /**
+         * Indicates whether the transaction refreshes an answer cache entry (its response is not sent to a client).
+         *
+         * @retval TRUE   The transaction is a prefetch.
+         * @retval FALSE  The transaction forwards a client query.
+         */
+        bool IsPrefetch(void) const { return mIsPrefetch; }
+
+        /**
+         * Marks the transaction as a prefetch of an answer cache entry.
+         */
+        void SetPrefetch(void) { mIsPrefetch = true; }
+#endif
+
     private:
         Ip6::MessageInfo mMessageInfo;
         TimeMilli        mExpireTime;
         bool             mValid;
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+        bool mIsPrefetch;
+#endif
     };
 #endif
 
@@ -285,6 +303,57 @@ public:
      */
     const Counters &GetCounters(void) const { return mCounters; };
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    /**
+     * Represents the answer cache counters of the DNS-SD server.
+     */
+    struct AnswerCacheCounters : public Clearable<AnswerCacheCounters>
+    {
+        uint32_t mHits;       ///< Number of queries answered from the cache.
+        uint32_t mMisses;     ///< Number of cacheable queries not found in the cache.
+        uint32_t mInsertions; ///< Number of responses added to the cache.
+        uint32_t mEvictions;  ///< Number of unexpired entries evicted for a new response or to free buffers.
+        uint32_t mPrefetches; ///< Number of upstream queries sent to refresh a soon-to-expire entry.
+    };
+
+    /**
+     * Returns the answer cache counters of the DNS-SD server.
+     *
+     * @returns The answer cache counters.
+     */
+    const AnswerCacheCounters &GetAnswerCacheCounters(void) const { return mAnswerCache.GetCounters(); }
+
+    /**
+     * Resets the answer cache counters of the DNS-SD server.
+     */
+    void ResetAnswerCacheCounters(void) { mAnswerCache.ResetCounters(); }
+
+    /**
+     * Clears all the entries in the answer cache of the DNS-SD server.
+     */
+    void ClearAnswerCache(void) { mAnswerCache.Clear(); }
+
+    /**
+     * Releases the least recently used answer cache entry to free up message buffers.
+     *
+     * Is used by `MessagePool` when it runs out of message buffers.
+     *
+     * @retval kErrorNone      An entry was released.
+     * @retval kErrorNotFound  The answer cache has no entry that can be released.
+     */
+    Error ReleaseAnswerCacheEntry(void) { return mAnswerCache.ReleaseEntry(); }
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+    /**
+     * Notifies the DNS-SD server that a host or service is registered, updated, or removed on the SRP server.
+     *
+     * The SRP server is used before the Discovery Proxy to resolve a query, so the cached Discovery Proxy responses are
+     * invalidated.
+     */
+    void HandleSrpServerHostsChange(void) { mAnswerCache.Invalidate(AnswerCache::kFromProxy); }
+#endif
+#endif
+
     /**
      * Represents different test mode flags for use in `SetTestMode()`.
      */
@@ -455,7 +524,8 @@ private:
         Error ResolveBySrp(void);
         Error ResolveUsingSrpHost(const Srp::Server::Host &aHost);
         Error ResolveUsingSrpService(const Srp::Server::Service &aService);
-        bool  QueryNameMatchesService(const Srp::Server::Service &aService) const;
+        bool  QueryNameMatchesService(const Srp::Server::Service &aService, uint32_t aQueryNameHash) const;
+        bool  IsDeleted(const Srp::Server::Service &aService) const;
         Error AppendPtrRecord(const Srp::Server::Service &aService);
         Error AppendSrvRecord(const Srp::Server::Service &aService);
         Error AppendTxtRecord(const Srp::Server::Service &aService);
@@ -487,6 +557,9 @@ private:
         Questions         mQuestions;
         Section           mSection;
         NameOffsets       mOffsets;
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+        bool mIsProxyResponse;
+#endif
     };
 
     struct ProxyQueryInfo : Message::FooterData<ProxyQueryInfo>
@@ -570,6 +643,7 @@ private:
                           const Name::Buffer &aName,
                           ResponseAppender    aAppender,
                           const ProxyResult  &aResult);
+        void HandleRemovedResult(void);
 
         static bool IsActionForAdditionalSection(ProxyAction aAction, const Questions &aQuestions);
 
@@ -579,6 +653,69 @@ private:
     };
 #endif
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    class AnswerCache : public InstanceLocator, private NonCopyable
+    {
+    public:
+        enum Source : uint8_t
+        {
+            kFromProxy,
+            kFromUpstream,
+        };
+
+        explicit AnswerCache(Instance &aInstance);
+
+        void                       Clear(void);
+        void                       Invalidate(Source aSource);
+        void                       Invalidate(Source aSource, const char *aName);
+        Error                      ReleaseEntry(void);
+        Error                      Answer(const Request &aRequest);
+        void                       Add(const Message &aResponse, Source aSource);
+        const AnswerCacheCounters &GetCounters(void) const { return mCounters; }
+        void                       ResetCounters(void) { mCounters.Clear(); }
+
+    private:
+        static constexpr uint16_t kSize         = OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_SIZE;
+        static constexpr uint16_t kMaxBuffers   = OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MAX_BUFFERS;
+        static constexpr uint32_t kMaxTtl       = OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_MAX_TTL;
+        static constexpr uint32_t kNegativeTtl  = OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_NEGATIVE_TTL;
+        static constexpr uint8_t  kPrefetchPct  = OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_PREFETCH_THRESHOLD;
+        static constexpr uint16_t kPrefetchHits = OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_PREFETCH_MIN_HITS;
+        static constexpr uint32_t kInfiniteTtl  = NumericLimits<uint32_t>::kMax;
+
+        static_assert(kPrefetchPct < 100, "ANSWER_CACHE_PREFETCH_THRESHOLD must be less than 100");
+        static_assert(kMaxBuffers > 0, "ANSWER_CACHE_MAX_BUFFERS must be non-zero");
+
+        struct Entry
+        {
+            bool     IsInUse(void) const { return !mResponse.IsNull(); }
+            bool     IsExpired(TimeMilli aNow) const { return aNow >= mExpireTime; }
+            uint32_t GetElapsedSeconds(TimeMilli aNow) const { return Time::MsecToSec(aNow - mInsertTime); }
+            bool     ShouldPrefetch(TimeMilli aNow) const;
+            void     Free(void) { mResponse.Free(); }
+
+            OwnedPtr<Message> mResponse;
+            TimeMilli         mInsertTime;
+            TimeMilli         mExpireTime;
+            TimeMilli         mLastUseTime;
+            uint32_t          mTtl;
+            uint16_t          mHits;
+            Source            mSource;
+            bool              mPrefetchPending;
+        };
+
+        Entry   *FindMatching(const Message &aMessage, TimeMilli aNow);
+        Entry   *FindLruEntry(void);
+        Entry   *AllocateEntry(TimeMilli aNow);
+        uint16_t GetBufferCount(void) const;
+        Error    SendFrom(Entry &aEntry, const Request &aRequest, TimeMilli aNow);
+
+        Entry               mEntries[kSize];
+        Entry              *mSendingEntry;
+        AnswerCacheCounters mCounters;
+    };
+#endif
+
     bool IsRunning(void) const { return mSocket.IsBound(); }
     void HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void ProcessQuery(Request &aRequest);
@@ -618,7 +755,7 @@ private:
     bool                      ShouldForwardToUpstream(const Request &aRequest) const;
     UpstreamQueryTransaction *AllocateUpstreamQueryTransaction(const Ip6::MessageInfo &aMessageInfo);
     void                      ResetUpstreamQueryTransaction(UpstreamQueryTransaction &aTxn, Error aError);
-    Error                     ResolveByUpstream(const Request &aRequest);
+    Error                     ResolveByUpstream(const Request &aRequest, bool aIsPrefetch);
 #endif
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE || OPENTHREAD_CONFIG_DNSSD_DISCOVERY_PROXY_ENABLE
@@ -653,6 +790,10 @@ private:
     DiscoveryProxy mDiscoveryProxy;
 #endif
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    AnswerCache mAnswerCache;
+#endif
+
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE || OPENTHREAD_CONFIG_DNSSD_DISCOVERY_PROXY_ENABLE
     Name::LabelBuffer mSoaServerName;
 #endif
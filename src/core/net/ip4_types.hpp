@@ -829,6 +829,13 @@ public:
      */
     uint16_t GetChecksum(void) const;
 
+    /**
+     * Sets the checksum value in the corresponding UDP, TCP, or ICMPv4 header, does nothing otherwise.
+     *
+     * @param[in] aChecksum  The checksum value.
+     */
+    void SetChecksum(uint16_t aChecksum);
+
 private:
     Header mIp4Header;
     union
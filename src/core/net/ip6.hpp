@@ -577,6 +577,13 @@ public:
      */
     uint16_t GetChecksum(void) const;
 
+    /**
+     * Sets the checksum value in the corresponding UDP, TCP, or ICMPv6 header, does nothing otherwise.
+     *
+     * @param[in] aChecksum  The checksum value.
+     */
+    void SetChecksum(uint16_t aChecksum);
+
 private:
     Header mIp6Header;
     union
@@ -106,6 +106,7 @@ Core::Core(Instance &aInstance)
     , mVerboseLogging(kDefaultVerboseLog)
 #endif
 {
+    mTxCounters.Clear();
 }
 
 void Core::AfterInstanceInit(void)
@@ -494,6 +495,7 @@ void Core::HandleEntryTimer(void)
 {
     EntryContext context(GetInstance(), TxMessage::kMulticastResponse);
     NextFireTime nextAggrTxTime(context.GetNow());
+    TimeMilli    aggrWindowEnd = context.GetNow() + kResponseAggregationMaxDelay;
 
     // Determine the next multicast transmission time that is explicitly
     // after `GetNow()` to set `mNextAggrTxTime`. This is used for
@@ -501,50 +503,86 @@ void Core::HandleEntryTimer(void)
     // entries, they can decide to extend their answer delay to the
     // determined `mNextAggrTxTime` so that all answers are included in
     // the same response message.
+    //
+    // An entry's fire time is never after its next announce or
+    // answer transmission time, and a transmission time that is
+    // `kResponseAggregationMaxDelay` or more after `GetNow()` is
+    // never used for aggregation. So we only need to check the
+    // entries at the start of the queues with a fire time before
+    // `aggrWindowEnd`.
 
-    for (HostEntry &entry : mHostEntries)
-    {
-        entry.DetermineNextAggrTxTime(nextAggrTxTime);
-    }
-
-    for (ServiceEntry &entry : mServiceEntries)
-    {
-        entry.DetermineNextAggrTxTime(nextAggrTxTime);
-    }
-
-    for (ServiceType &serviceType : mServiceTypes)
-    {
-        serviceType.DetermineNextAggrTxTime(nextAggrTxTime);
-    }
+    DetermineNextAggrTxTime<HostEntry>(mHostEntryQueue, aggrWindowEnd, nextAggrTxTime);
+    DetermineNextAggrTxTime<ServiceEntry>(mServiceEntryQueue, aggrWindowEnd, nextAggrTxTime);
+    DetermineNextAggrTxTime<ServiceType>(mServiceTypeQueue, aggrWindowEnd, nextAggrTxTime);
 
     context.mNextAggrTxTime = nextAggrTxTime.GetNextTime();
 
+    // Only the entries whose fire time is reached are visited.
+    //
     // We process host entries before service entries. This order
     // ensures we can determine whether host addresses have already
     // been appended to the Answer section (when processing service entries),
     // preventing duplicates.
 
-    for (HostEntry &entry : mHostEntries)
+    mHostEntryQueue.PrepareDueList(context.GetNow());
+    mServiceEntryQueue.PrepareDueList(context.GetNow());
+    mServiceTypeQueue.PrepareDueList(context.GetNow());
+
+    HandleDueEntries<HostEntry>(mHostEntryQueue, context);
+    HandleDueEntries<ServiceEntry>(mServiceEntryQueue, context);
+    HandleDueEntries<ServiceType>(mServiceTypeQueue, context);
+
+    context.mProbeMessage.Send();
+    context.mResponseMessage.Send();
+
+    // Clear the append state on all visited entries (and on host
+    // entries whose records were appended by a service entry) so
+    // that all entries start from a clean state when preparing the
+    // next message.
+
+    ClearAppendStateOnDueEntries<HostEntry>(mHostEntryQueue);
+    ClearAppendStateOnDueEntries<ServiceEntry>(mServiceEntryQueue);
+    ClearAppendStateOnDueEntries<ServiceType>(mServiceTypeQueue);
+
+    mHostEntryQueue.UpdateNextFireTimeOn(context.mNextFireTime);
+    mServiceEntryQueue.UpdateNextFireTimeOn(context.mNextFireTime);
+    mServiceTypeQueue.UpdateNextFireTimeOn(context.mNextFireTime);
+
+    mEntryTimer.FireAtIfEarlier(context.mNextFireTime);
+}
+
+template <typename EntryType>
+void Core::DetermineNextAggrTxTime(const FireTimeQueue &aQueue,
+                                   TimeMilli            aWindowEnd,
+                                   NextFireTime        &aNextAggrTxTime) const
+{
+    for (const FireTime *fireTime = aQueue.GetHead(); fireTime != nullptr; fireTime = fireTime->GetNextInQueue())
     {
-        entry.HandleTimer(context);
+        if (fireTime->GetFireTime() >= aWindowEnd)
+        {
+            break;
+        }
+
+        static_cast<const EntryType *>(fireTime)->DetermineNextAggrTxTime(aNextAggrTxTime);
     }
+}
 
-    for (ServiceEntry &entry : mServiceEntries)
+template <typename EntryType> void Core::HandleDueEntries(FireTimeQueue &aQueue, EntryContext &aContext)
+{
+    for (FireTime *fireTime = aQueue.GetDueList(); fireTime != nullptr; fireTime = fireTime->GetNextDue())
     {
-        entry.HandleTimer(context);
+        static_cast<EntryType *>(fireTime)->HandleTimer(aContext);
     }
+}
 
-    for (ServiceType &serviceType : mServiceTypes)
+template <typename EntryType> void Core::ClearAppendStateOnDueEntries(FireTimeQueue &aQueue)
+{
+    for (FireTime *fireTime = aQueue.GetDueList(); fireTime != nullptr; fireTime = fireTime->GetNextDue())
     {
-        serviceType.HandleTimer(context);
+        static_cast<EntryType *>(fireTime)->ClearAppendState();
     }
 
-    context.mProbeMessage.Send();
-    context.mResponseMessage.Send();
-
-    RemoveEmptyEntries();
-
-    mEntryTimer.FireAtIfEarlier(context.mNextFireTime);
+    aQueue.ClearDueList();
 }
 
 void Core::RemoveEmptyEntries(void)
@@ -737,6 +775,18 @@ bool Core::RecordCounts::IsEmpty(void) const
     return isEmpty;
 }
 
+uint16_t Core::RecordCounts::GetTotal(void) const
+{
+    uint16_t total = 0;
+
+    for (uint16_t count : mCounts)
+    {
+        total += count;
+    }
+
+    return total;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Core::AddressArray
 
@@ -1159,16 +1209,64 @@ exit:
 //----------------------------------------------------------------------------------------------------------------------
 // Core::FireTime
 
+Core::FireTime::FireTime(void)
+    : mQueue(nullptr)
+    , mPrev(nullptr)
+    , mNext(nullptr)
+    , mNextDue(nullptr)
+    , mHasFireTime(false)
+    , mIsDue(false)
+{
+}
+
+Core::FireTime::~FireTime(void)
+{
+    ClearFireTime();
+
+    if (mIsDue)
+    {
+        mQueue->RemoveFromDueList(*this);
+    }
+}
+
+void Core::FireTime::SetQueue(FireTimeQueue &aQueue)
+{
+    OT_ASSERT(mQueue == nullptr);
+
+    mQueue = &aQueue;
+
+    if (mHasFireTime)
+    {
+        mQueue->Add(*this);
+    }
+}
+
+void Core::FireTime::ClearFireTime(void)
+{
+    if (mHasFireTime && (mQueue != nullptr))
+    {
+        mQueue->Remove(*this);
+    }
+
+    mHasFireTime = false;
+}
+
 void Core::FireTime::SetFireTime(TimeMilli aFireTime)
 {
     if (mHasFireTime)
     {
         VerifyOrExit(aFireTime < mFireTime);
+        ClearFireTime();
     }
 
     mFireTime    = aFireTime;
     mHasFireTime = true;
 
+    if (mQueue != nullptr)
+    {
+        mQueue->Add(*this);
+    }
+
 exit:
     return;
 }
@@ -1189,6 +1287,276 @@ void Core::FireTime::UpdateNextFireTimeOn(NextFireTime &aNextFireTime) const
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Core::FireTimeQueue
+
+Core::FireTimeQueue::FireTimeQueue(void)
+    : mHead(nullptr)
+    , mTail(nullptr)
+    , mDueHead(nullptr)
+    , mDueTail(nullptr)
+{
+}
+
+void Core::FireTimeQueue::Add(FireTime &aFireTime)
+{
+    // Search backward from the tail for the position to insert
+    // `aFireTime`. A newly set fire time is often the latest one
+    // (e.g., the multicast age time of a record), so it is
+    // typically inserted at or close to the tail. Entries with
+    // the same fire time are kept in the order they are added.
+
+    FireTime *prev = mTail;
+
+    while ((prev != nullptr) && (aFireTime.mFireTime < prev->mFireTime))
+    {
+        prev = prev->mPrev;
+    }
+
+    aFireTime.mPrev = prev;
+
+    if (prev == nullptr)
+    {
+        aFireTime.mNext = mHead;
+        mHead           = &aFireTime;
+    }
+    else
+    {
+        aFireTime.mNext = prev->mNext;
+        prev->mNext     = &aFireTime;
+    }
+
+    if (aFireTime.mNext == nullptr)
+    {
+        mTail = &aFireTime;
+    }
+    else
+    {
+        aFireTime.mNext->mPrev = &aFireTime;
+    }
+}
+
+void Core::FireTimeQueue::Remove(FireTime &aFireTime)
+{
+    if (aFireTime.mPrev == nullptr)
+    {
+        mHead = aFireTime.mNext;
+    }
+    else
+    {
+        aFireTime.mPrev->mNext = aFireTime.mNext;
+    }
+
+    if (aFireTime.mNext == nullptr)
+    {
+        mTail = aFireTime.mPrev;
+    }
+    else
+    {
+        aFireTime.mNext->mPrev = aFireTime.mPrev;
+    }
+
+    aFireTime.mPrev = nullptr;
+    aFireTime.mNext = nullptr;
+}
+
+void Core::FireTimeQueue::UpdateNextFireTimeOn(NextFireTime &aNextFireTime) const
+{
+    if (mHead != nullptr)
+    {
+        aNextFireTime.UpdateIfEarlier(mHead->mFireTime);
+    }
+}
+
+void Core::FireTimeQueue::PrepareDueList(TimeMilli aNow)
+{
+    // Adds all objects whose fire time is reached to the due list.
+    // The due list is kept separate from the queue so it can be
+    // safely iterated while the fire times (and therefore the
+    // queue) are changed by the visited objects.
+
+    for (FireTime *fireTime = mHead; fireTime != nullptr; fireTime = fireTime->mNext)
+    {
+        if (fireTime->mFireTime > aNow)
+        {
+            break;
+        }
+
+        AddToDueList(*fireTime);
+    }
+}
+
+void Core::FireTimeQueue::AddToDueList(FireTime &aFireTime)
+{
+    VerifyOrExit(!aFireTime.mIsDue);
+
+    aFireTime.mIsDue   = true;
+    aFireTime.mNextDue = nullptr;
+
+    if (mDueTail == nullptr)
+    {
+        mDueHead = &aFireTime;
+    }
+    else
+    {
+        mDueTail->mNextDue = &aFireTime;
+    }
+
+    mDueTail = &aFireTime;
+
+exit:
+    return;
+}
+
+void Core::FireTimeQueue::RemoveFromDueList(FireTime &aFireTime)
+{
+    FireTime *prev = nullptr;
+
+    for (FireTime *fireTime = mDueHead; fireTime != nullptr; prev = fireTime, fireTime = fireTime->mNextDue)
+    {
+        if (fireTime != &aFireTime)
+        {
+            continue;
+        }
+
+        if (prev == nullptr)
+        {
+            mDueHead = aFireTime.mNextDue;
+        }
+        else
+        {
+            prev->mNextDue = aFireTime.mNextDue;
+        }
+
+        if (mDueTail == &aFireTime)
+        {
+            mDueTail = prev;
+        }
+
+        break;
+    }
+
+    aFireTime.mNextDue = nullptr;
+    aFireTime.mIsDue   = false;
+}
+
+void Core::FireTimeQueue::ClearDueList(void)
+{
+    FireTime *next;
+
+    for (FireTime *fireTime = mDueHead; fireTime != nullptr; fireTime = next)
+    {
+        next               = fireTime->mNextDue;
+        fireTime->mNextDue = nullptr;
+        fireTime->mIsDue   = false;
+    }
+
+    mDueHead = nullptr;
+    mDueTail = nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Core::NameHash
+
+uint32_t Core::NameHash::Calculate(const char *aFirstLabel, const char *aLabels)
+{
+    NameHash nameHash;
+
+    nameHash.AddLabels(aFirstLabel);
+    nameHash.AddLabels(aLabels);
+    nameHash.AddLabels(kLocalDomain);
+
+    return nameHash.GetHash();
+}
+
+void Core::NameHash::AddLabels(const char *aLabels)
+{
+    VerifyOrExit((aLabels != nullptr) && (*aLabels != kNullChar));
+
+    AddLabelSeparator();
+
+    for (; *aLabels != kNullChar; aLabels++)
+    {
+        if ((aLabels[0] == '.') && (aLabels[1] == kNullChar))
+        {
+            break;
+        }
+
+        AddChar(*aLabels);
+    }
+
+exit:
+    return;
+}
+
+void Core::NameHash::AddName(const Name &aName)
+{
+    uint16_t          offset;
+    const Message    *message;
+    Name::LabelBuffer label;
+    uint8_t           labelLength;
+
+    if (aName.IsFromCString())
+    {
+        AddLabels(aName.GetAsCString());
+        ExitNow();
+    }
+
+    VerifyOrExit(aName.IsFromMessage());
+
+    message = &aName.GetAsMessage(offset);
+
+    while (true)
+    {
+        labelLength = sizeof(label);
+        SuccessOrExit(Name::ReadLabel(*message, offset, label, labelLength));
+
+        AddLabelSeparator();
+
+        for (uint8_t index = 0; index < labelLength; index++)
+        {
+            AddChar(label[index]);
+        }
+    }
+
+exit:
+    return;
+}
+
+void Core::NameHash::AddLabelSeparator(void)
+{
+    if (!mIsEmpty)
+    {
+        AddChar('.');
+    }
+
+    mIsEmpty = false;
+}
+
+void Core::NameHash::AddChar(char aChar)
+{
+    // FNV-1a hash over lowercase chars.
+
+    mHash.AddByte(static_cast<uint8_t>(ToLowercase(aChar)));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Core::HashedName
+
+uint32_t Core::HashedName::GetHash(void) const
+{
+    if (!mIsHashCalculated)
+    {
+        NameHash nameHash;
+
+        nameHash.AddName(mName);
+        mHash             = nameHash.GetHash();
+        mIsHashCalculated = true;
+    }
+
+    return mHash;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Core::Entry
 
@@ -1283,8 +1651,12 @@ void Core::Entry::ScheduleCallbackTask(void)
         Get<Core>().mEntryTask.Post();
         break;
 
-    case kProbing:
     case kRemoving:
+        // `mEntryTask` also removes the entries in `kRemoving` state.
+        Get<Core>().mEntryTask.Post();
+        break;
+
+    case kProbing:
         break;
     }
 
@@ -1944,9 +2316,16 @@ Core::HostEntry::HostEntry(void)
 
 Error Core::HostEntry::Init(Instance &aInstance, const char *aName)
 {
+    Error error;
+
+    SetQueue(aInstance.Get<Core>().mHostEntryQueue);
     Entry::Init(aInstance);
 
-    return mName.Set(aName);
+    SuccessOrExit(error = mName.Set(aName));
+    mNameHash = NameHash::Calculate(/* aFirstLabel */ nullptr, mName.AsCString());
+
+exit:
+    return error;
 }
 
 bool Core::HostEntry::Matches(const Name &aName) const
@@ -1954,6 +2333,11 @@ bool Core::HostEntry::Matches(const Name &aName) const
     return aName.Matches(/* aFirstLabel */ nullptr, mName.AsCString(), kLocalDomain);
 }
 
+bool Core::HostEntry::Matches(const HashedName &aName) const
+{
+    return (mNameHash == aName.GetHash()) && Matches(aName.GetName());
+}
+
 bool Core::HostEntry::Matches(const Host &aHost) const { return NameMatch(mName, aHost.mHostName); }
 
 bool Core::HostEntry::Matches(const LocalHost &aLocalHost) const { return NameMatch(mName, aLocalHost.GetName()); }
@@ -2500,11 +2884,15 @@ Error Core::ServiceEntry::Init(Instance &aInstance, const char *aServiceInstance
 {
     Error error;
 
+    SetQueue(aInstance.Get<Core>().mServiceEntryQueue);
     Entry::Init(aInstance);
 
     SuccessOrExit(error = mServiceInstance.Set(aServiceInstance));
     SuccessOrExit(error = mServiceType.Set(aServiceType));
 
+    mNameHash        = NameHash::Calculate(mServiceInstance.AsCString(), mServiceType.AsCString());
+    mServiceTypeHash = NameHash::Calculate(/* aFirstLabel */ nullptr, mServiceType.AsCString());
+
 exit:
     return error;
 }
@@ -2524,6 +2912,11 @@ bool Core::ServiceEntry::Matches(const Name &aFullName) const
     return aFullName.Matches(mServiceInstance.AsCString(), mServiceType.AsCString(), kLocalDomain);
 }
 
+bool Core::ServiceEntry::Matches(const HashedName &aFullName) const
+{
+    return (mNameHash == aFullName.GetHash()) && Matches(aFullName.GetName());
+}
+
 bool Core::ServiceEntry::MatchesServiceType(const Name &aServiceType) const
 {
     // When matching service type, PTR record should be
@@ -2532,6 +2925,11 @@ bool Core::ServiceEntry::MatchesServiceType(const Name &aServiceType) const
     return mPtrRecord.CanAnswer() && aServiceType.Matches(nullptr, mServiceType.AsCString(), kLocalDomain);
 }
 
+bool Core::ServiceEntry::MatchesServiceType(const HashedName &aServiceType) const
+{
+    return (mServiceTypeHash == aServiceType.GetHash()) && MatchesServiceType(aServiceType.GetName());
+}
+
 bool Core::ServiceEntry::Matches(const Service &aService) const
 {
     return NameMatch(mServiceInstance, aService.mServiceInstance) && NameMatch(mServiceType, aService.mServiceType);
@@ -2892,6 +3290,15 @@ void Core::ServiceEntry::PrepareResponseRecords(EntryContext &aContext)
 
     DiscoverOffsetsAndHost(hostEntry);
 
+    if (hostEntry != nullptr)
+    {
+        // The append state of `hostEntry` may be changed below. We
+        // add it to the due list so that its state is cleared after
+        // the response is sent (see `HandleEntryTimer()`).
+
+        Get<Core>().mHostEntryQueue.AddToDueList(*hostEntry);
+    }
+
     // We determine records to include in Additional Data section
     // per RFC 6763 section 12:
     //
@@ -3470,6 +3877,7 @@ Error Core::ServiceType::Init(Instance &aInstance, const char *aServiceType)
     Error error;
 
     InstanceLocatorInit::Init(aInstance);
+    SetQueue(Get<Core>().mServiceTypeQueue);
 
     mNext       = nullptr;
     mNumEntries = 0;
@@ -3650,6 +4058,9 @@ void Core::TxMessage::Init(Type aType, uint16_t aMessageId)
     mServicesDnssdOffset = kUnspecifiedOffset;
     mType                = aType;
 
+    mIsTruncated               = false;
+    mIsKnownAnswerContinuation = false;
+
     // Allocate messages. The main `mMsgPtr` is always allocated.
     // The Authority and Addition section messages are allocated
     // the first time they are used.
@@ -3695,7 +4106,10 @@ Message &Core::TxMessage::SelectMessageFor(Section aSection)
         break;
 
     case kMulticastQuery:
-        mainSection  = kQuestionSection;
+        // In a continuation message of a multi-packet query, there
+        // is no question and known-answer records are appended
+        // to the main message.
+        mainSection  = mIsKnownAnswerContinuation ? kAnswerSection : kQuestionSection;
         extraSection = kAnswerSection;
         break;
     case kLegacyUnicastResponse:
@@ -3961,6 +4375,50 @@ exit:
     return;
 }
 
+bool Core::TxMessage::CheckSizeLimitToContinueKnownAnswers(void)
+{
+    // Splits a long known-answer list of a query over multiple
+    // messages (RFC 6762 section 7.2). This is called after a
+    // known-answer record is appended to a query message (with its
+    // state saved before appending the record). If the message
+    // exceeds the size limit, it is restored to its saved state
+    // (removing the last record) and sent with TC flag set. The
+    // message is then re-initialized as a continuation message
+    // (with no question) and `true` is returned to signal that the
+    // last known-answer record should be appended again.
+
+    bool shouldAppendAgain = false;
+
+    VerifyOrExit(IsOverSizeLimit());
+
+    shouldAppendAgain = true;
+
+    RestoreToSavedState();
+    mIsTruncated = true;
+    Send();
+    Reinit();
+
+    mIsKnownAnswerContinuation = true;
+
+exit:
+    return shouldAppendAgain;
+}
+
+void Core::TxMessage::CompleteMultiPacketQuery(void)
+{
+    // Sends the last message of a multi-packet query (with TC flag
+    // cleared) so that no other question is appended after the
+    // known-answer records in a continuation message.
+
+    VerifyOrExit(mIsKnownAnswerContinuation);
+
+    Send();
+    Reinit();
+
+exit:
+    return;
+}
+
 void Core::TxMessage::Send(void)
 {
     static constexpr uint16_t kHeaderOffset = 0;
@@ -3971,6 +4429,12 @@ void Core::TxMessage::Send(void)
 
     SuccessOrAssert(mMsgPtr->Read(kHeaderOffset, header));
     mRecordCounts.WriteTo(header);
+
+    if (mIsTruncated)
+    {
+        header.SetTruncationFlag();
+    }
+
     mMsgPtr->Write(kHeaderOffset, header);
 
     if (!mExtraMsgPtr.IsNull())
@@ -3979,6 +4443,7 @@ void Core::TxMessage::Send(void)
     }
 
     Get<Core>().mTxMessageHistory.Add(*mMsgPtr);
+    UpdateTxCounters();
 
     LogVerbose("Sending %s message len:%u", TypeToString(mType), mMsgPtr->GetLength());
 
@@ -4009,6 +4474,35 @@ exit:
     return;
 }
 
+void Core::TxMessage::UpdateTxCounters(void) const
+{
+    TxCounters &counters = Get<Core>().mTxCounters;
+
+    switch (mType)
+    {
+    case kMulticastProbe:
+    case kMulticastQuery:
+        counters.mQueryMessages++;
+        counters.mQueryRecords += mRecordCounts.GetTotal();
+        counters.mQueryBytes += mMsgPtr->GetLength();
+
+        if (mIsTruncated)
+        {
+            counters.mTruncatedQueryMessages++;
+        }
+
+        break;
+
+    case kMulticastResponse:
+    case kUnicastResponse:
+    case kLegacyUnicastResponse:
+        counters.mResponseMessages++;
+        counters.mResponseRecords += mRecordCounts.GetTotal();
+        counters.mResponseBytes += mMsgPtr->GetLength();
+        break;
+    }
+}
+
 void Core::TxMessage::Reinit(void)
 {
     Init(GetType());
@@ -4356,7 +4850,8 @@ exit:
 
 void Core::RxMessage::ProcessQuestion(Question &aQuestion)
 {
-    Name name(*mMessagePtr, aQuestion.mNameOffset);
+    Name       name(*mMessagePtr, aQuestion.mNameOffset);
+    HashedName hashedName(name);
 
     VerifyOrExit(aQuestion.mIsRrClassInternet);
 
@@ -4375,11 +4870,11 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
 
     // Check if question name matches a `HostEntry` or a `ServiceEntry`.
 
-    aQuestion.mEntry = Get<Core>().mHostEntries.FindMatching(name);
+    aQuestion.mEntry = Get<Core>().mHostEntries.FindMatching(hashedName);
 
     if (aQuestion.mEntry == nullptr)
     {
-        aQuestion.mEntry        = Get<Core>().mServiceEntries.FindMatching(name);
+        aQuestion.mEntry        = Get<Core>().mServiceEntries.FindMatching(hashedName);
         aQuestion.mIsForService = (aQuestion.mEntry != nullptr);
     }
 
@@ -4418,6 +4913,7 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
         bool              isSubType;
         Name::LabelBuffer subLabel;
         Name              baseType;
+        HashedName        hashedBaseType(baseType);
 
         VerifyOrExit(QuestionMatches(aQuestion.mRrType, ResourceRecord::kTypePtr));
 
@@ -4430,7 +4926,7 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
 
         for (ServiceEntry &serviceEntry : Get<Core>().mServiceEntries)
         {
-            if ((serviceEntry.GetState() != Entry::kRegistered) || !serviceEntry.MatchesServiceType(baseType))
+            if ((serviceEntry.GetState() != Entry::kRegistered) || !serviceEntry.MatchesServiceType(hashedBaseType))
             {
                 continue;
             }
@@ -4505,6 +5001,7 @@ void Core::RxMessage::AnswerServiceTypeQuestion(const Question   &aQuestion,
 {
     Name              serviceType(*mMessagePtr, aQuestion.mNameOffset);
     Name              baseType;
+    HashedName        hashedBaseType(baseType);
     Name::LabelBuffer labelBuffer;
     const char       *subLabel;
 
@@ -4522,7 +5019,7 @@ void Core::RxMessage::AnswerServiceTypeQuestion(const Question   &aQuestion,
     {
         bool shouldSuppress = false;
 
-        if ((serviceEntry->GetState() != Entry::kRegistered) || !serviceEntry->MatchesServiceType(baseType))
+        if ((serviceEntry->GetState() != Entry::kRegistered) || !serviceEntry->MatchesServiceType(hashedBaseType))
         {
             continue;
         }
@@ -4712,6 +5209,24 @@ void Core::RxMessage::SendUnicastResponse(void)
     }
 
     context.mResponseMessage.Send();
+
+    // `HandleEntryTimer()` only visits the due entries and relies on
+    // all other entries having a clear append state.
+
+    for (HostEntry &entry : Get<Core>().mHostEntries)
+    {
+        entry.ClearAppendState();
+    }
+
+    for (ServiceEntry &entry : Get<Core>().mServiceEntries)
+    {
+        entry.ClearAppendState();
+    }
+
+    for (ServiceType &serviceType : Get<Core>().mServiceTypes)
+    {
+        serviceType.ClearAppendState();
+    }
 }
 
 void Core::RxMessage::ProcessResponse(void)
@@ -4798,14 +5313,16 @@ void Core::RxMessage::IterateOnAllRecordsInResponse(RecordProcessor aRecordProce
                 continue;
             }
 
-            (this->*aRecordProcessor)(name, record, offset);
+            (this->*aRecordProcessor)(HashedName(name), record, offset);
 
             offset += static_cast<uint16_t>(record.GetSize());
         }
     }
 }
 
-void Core::RxMessage::ProcessRecordForConflict(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
+void Core::RxMessage::ProcessRecordForConflict(const HashedName     &aName,
+                                               const ResourceRecord &aRecord,
+                                               uint16_t              aRecordOffset)
 {
     HostEntry    *hostEntry;
     ServiceEntry *serviceEntry;
@@ -4830,7 +5347,7 @@ exit:
     OT_UNUSED_VARIABLE(aRecordOffset);
 }
 
-void Core::RxMessage::ProcessPtrRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
+void Core::RxMessage::ProcessPtrRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
 {
     BrowseCache *browseCache;
 
@@ -4845,7 +5362,7 @@ exit:
     return;
 }
 
-void Core::RxMessage::ProcessSrvRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
+void Core::RxMessage::ProcessSrvRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
 {
     SrvCache *srvCache;
 
@@ -4860,7 +5377,7 @@ exit:
     return;
 }
 
-void Core::RxMessage::ProcessTxtRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
+void Core::RxMessage::ProcessTxtRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
 {
     TxtCache *txtCache;
 
@@ -4875,7 +5392,7 @@ exit:
     return;
 }
 
-void Core::RxMessage::ProcessAaaaRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
+void Core::RxMessage::ProcessAaaaRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
 {
     Ip6AddrCache *ip6AddrCache;
 
@@ -4890,7 +5407,7 @@ exit:
     return;
 }
 
-void Core::RxMessage::ProcessARecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
+void Core::RxMessage::ProcessARecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
 {
     Ip4AddrCache *ip4AddrCache;
 
@@ -4905,7 +5422,7 @@ exit:
     return;
 }
 
-void Core::RxMessage::ProcessOtherRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
+void Core::RxMessage::ProcessOtherRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset)
 {
     // Unlike other `Process{Specific}Record()` methods where
     // we know for sure that we can have only one match, for
@@ -5315,56 +5832,76 @@ void Core::AddPassiveIp6AddrCache(const char *aHostName)
 
 void Core::HandleCacheTimer(void)
 {
-    CacheContext      context(GetInstance());
-    ExpirationChecker expirationChecker(context.GetNow());
-
-    // First remove all expired entries.
+    static const CacheEntry::Type kCacheTypes[] = {
+        CacheEntry::kSrvCache,     CacheEntry::kTxtCache,     CacheEntry::kBrowseCache,
+        CacheEntry::kIp6AddrCache, CacheEntry::kIp4AddrCache, CacheEntry::kRecordCache,
+    };
 
-    mBrowseCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mSrvCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mTxtCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mIp6AddrCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mIp4AddrCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mRecordCacheList.RemoveAndFreeAllMatching(expirationChecker);
+    CacheContext context(GetInstance());
 
-    // Process cache types in a specific order to optimize name
-    // compression when constructing query messages.
+    // First remove all expired entries. An expired entry always has
+    // a fire time no later than its delete time, so we only need to
+    // check the due entries at the start of the queue to decide
+    // whether any entry needs to be removed.
 
-    for (SrvCache &srvCache : mSrvCacheList)
+    for (FireTime *fireTime = mCacheQueue.GetHead(); fireTime != nullptr; fireTime = fireTime->GetNextInQueue())
     {
-        srvCache.HandleTimer(context);
-    }
+        if (fireTime->GetFireTime() > context.GetNow())
+        {
+            break;
+        }
 
-    for (TxtCache &txtCache : mTxtCacheList)
-    {
-        txtCache.HandleTimer(context);
+        if (static_cast<CacheEntry *>(fireTime)->ShouldDelete(context.GetNow()))
+        {
+            ExpirationChecker expirationChecker(context.GetNow());
+
+            mBrowseCacheList.RemoveAndFreeAllMatching(expirationChecker);
+            mSrvCacheList.RemoveAndFreeAllMatching(expirationChecker);
+            mTxtCacheList.RemoveAndFreeAllMatching(expirationChecker);
+            mIp6AddrCacheList.RemoveAndFreeAllMatching(expirationChecker);
+            mIp4AddrCacheList.RemoveAndFreeAllMatching(expirationChecker);
+            mRecordCacheList.RemoveAndFreeAllMatching(expirationChecker);
+            break;
+        }
     }
 
-    for (BrowseCache &browseCache : mBrowseCacheList)
-    {
-        browseCache.HandleTimer(context);
-    }
+    // Only the entries whose fire time is reached are visited.
+    // Process cache types in a specific order to optimize name
+    // compression when constructing query messages.
 
-    for (Ip6AddrCache &addrCache : mIp6AddrCacheList)
-    {
-        addrCache.HandleTimer(context);
-    }
+    mCacheQueue.PrepareDueList(context.GetNow());
 
-    for (Ip4AddrCache &addrCache : mIp4AddrCacheList)
+    for (CacheEntry::Type type : kCacheTypes)
     {
-        addrCache.HandleTimer(context);
+        HandleDueCaches(type, context);
     }
 
-    for (RecordCache &recordCache : mRecordCacheList)
+    context.mQueryMessage.Send();
+
+    for (FireTime *fireTime = mCacheQueue.GetDueList(); fireTime != nullptr; fireTime = fireTime->GetNextDue())
     {
-        recordCache.HandleTimer(context);
+        static_cast<CacheEntry *>(fireTime)->ClearAppendState();
     }
 
-    context.mQueryMessage.Send();
+    mCacheQueue.ClearDueList();
 
+    mCacheQueue.UpdateNextFireTimeOn(context.mNextFireTime);
     mCacheTimer.FireAtIfEarlier(context.mNextFireTime);
 }
 
+void Core::HandleDueCaches(CacheEntry::Type aType, CacheContext &aContext)
+{
+    for (FireTime *fireTime = mCacheQueue.GetDueList(); fireTime != nullptr; fireTime = fireTime->GetNextDue())
+    {
+        CacheEntry &cacheEntry = *static_cast<CacheEntry *>(fireTime);
+
+        if (cacheEntry.GetType() == aType)
+        {
+            cacheEntry.HandleTimer(aContext);
+        }
+    }
+}
+
 void Core::HandleCacheTask(void)
 {
     // `CacheTask` is used to remove empty/null callbacks
@@ -5617,6 +6154,7 @@ TimeMilli Core::CacheRecordInfo::GetQueryTime(uint8_t aAttemptIndex) const
 void Core::CacheEntry::Init(Instance &aInstance, Type aType)
 {
     InstanceLocatorInit::Init(aInstance);
+    SetQueue(Get<Core>().mCacheQueue);
 
     mType                  = aType;
     mContinuousRetry       = false;
@@ -5626,6 +6164,13 @@ void Core::CacheEntry::Init(Instance &aInstance, Type aType)
     mDeleteTime            = TimerMilli::GetNow() + kNonActiveDeleteTimeout;
     mRetryInterval         = 0;
     mJitteredRetryInterval = 0;
+
+    // Set the fire time to the delete time so that the timer
+    // handler visits and removes a passive entry, which does
+    // not get any records, once its delete time is reached.
+
+    SetFireTime(mDeleteTime);
+    ScheduleTimer();
 }
 
 void Core::CacheEntry::SetIsActive(bool aIsActive)
@@ -5807,7 +6352,7 @@ void Core::CacheEntry::ClearEmptyCallbacks(void)
     }
 }
 
-void Core::CacheEntry::HandleTimer(CacheContext &aContext)
+void Core::CacheEntry::ClearAppendState(void)
 {
     switch (mType)
     {
@@ -5830,6 +6375,11 @@ void Core::CacheEntry::HandleTimer(CacheContext &aContext)
     case kRecordCache:
         break;
     }
+}
+
+void Core::CacheEntry::HandleTimer(CacheContext &aContext)
+{
+    ClearAppendState();
 
     VerifyOrExit(HasFireTime());
     VerifyOrExit(GetFireTime() <= aContext.GetNow());
@@ -6042,6 +6592,21 @@ Error Core::BrowseCache::Init(Instance &aInstance, const char *aServiceType, con
     SuccessOrExit(error = mServiceType.Set(aServiceType));
     SuccessOrExit(error = mSubTypeLabel.Set(aSubTypeLabel));
 
+    if (mSubTypeLabel.IsNull())
+    {
+        mNameHash = NameHash::Calculate(/* aFirstLabel */ nullptr, mServiceType.AsCString());
+    }
+    else
+    {
+        NameHash nameHash;
+
+        nameHash.AddLabels(mSubTypeLabel.AsCString());
+        nameHash.AddLabels(kSubServiceLabel);
+        nameHash.AddLabels(mServiceType.AsCString());
+        nameHash.AddLabels(kLocalDomain);
+        mNameHash = nameHash.GetHash();
+    }
+
 exit:
     return error;
 }
@@ -6081,6 +6646,11 @@ exit:
     return matches;
 }
 
+bool Core::BrowseCache::Matches(const HashedName &aFullName) const
+{
+    return (mNameHash == aFullName.GetHash()) && Matches(aFullName.GetName());
+}
+
 bool Core::BrowseCache::Matches(const char *aServiceType, const char *aSubTypeLabel) const
 {
     bool matches = false;
@@ -6174,6 +6744,15 @@ exit:
 void Core::BrowseCache::PreparePtrQuestion(TxMessage &aQuery, TimeMilli aNow)
 {
     Question question;
+    bool     canSplit;
+
+    // If the PTR question is the first one in `aQuery`, a long
+    // known-answer list which does not fit in one message is split
+    // over multiple messages. Otherwise, `CacheEntry::PrepareQuery()`
+    // moves the question along with all its known-answers to a new
+    // message when they do not fit.
+
+    canSplit = aQuery.IsEmpty();
 
     DiscoverCompressOffsets();
 
@@ -6192,8 +6771,20 @@ void Core::BrowseCache::PreparePtrQuestion(TxMessage &aQuery, TimeMilli aNow)
             continue;
         }
 
+        if (canSplit)
+        {
+            aQuery.SaveCurrentState();
+        }
+
         AppendKnownAnswer(aQuery, ptrEntry, aNow);
+
+        if (canSplit && aQuery.CheckSizeLimitToContinueKnownAnswers())
+        {
+            AppendKnownAnswer(aQuery, ptrEntry, aNow);
+        }
     }
+
+    aQuery.CompleteMultiPacketQuery();
 }
 
 void Core::BrowseCache::DiscoverCompressOffsets(void)
@@ -6376,6 +6967,7 @@ Error Core::ServiceCache::Init(Instance &aInstance, Type aType, const char *aSer
     ClearCompressOffsets();
     SuccessOrExit(error = mServiceInstance.Set(aServiceInstance));
     SuccessOrExit(error = mServiceType.Set(aServiceType));
+    mNameHash = NameHash::Calculate(mServiceInstance.AsCString(), mServiceType.AsCString());
 
 exit:
     return error;
@@ -6392,6 +6984,11 @@ bool Core::ServiceCache::Matches(const Name &aFullName) const
     return aFullName.Matches(mServiceInstance.AsCString(), mServiceType.AsCString(), kLocalDomain);
 }
 
+bool Core::ServiceCache::Matches(const HashedName &aFullName) const
+{
+    return (mNameHash == aFullName.GetHash()) && Matches(aFullName.GetName());
+}
+
 bool Core::ServiceCache::Matches(const char *aServiceInstance, const char *aServiceType) const
 {
     return NameMatch(mServiceInstance, aServiceInstance) && NameMatch(mServiceType, aServiceType);
@@ -6465,6 +7062,8 @@ Error Core::SrvCache::Init(Instance &aInstance, const SrvResolver &aResolver)
 
 bool Core::SrvCache::Matches(const Name &aFullName) const { return ServiceCache::Matches(aFullName); }
 
+bool Core::SrvCache::Matches(const HashedName &aFullName) const { return ServiceCache::Matches(aFullName); }
+
 bool Core::SrvCache::Matches(const ServiceName &aServiceName) const
 {
     return ServiceCache::Matches(aServiceName.mServiceInstance, aServiceName.mServiceType);
@@ -6663,6 +7262,8 @@ Error Core::TxtCache::Init(Instance &aInstance, const TxtResolver &aResolver)
 
 bool Core::TxtCache::Matches(const Name &aFullName) const { return ServiceCache::Matches(aFullName); }
 
+bool Core::TxtCache::Matches(const HashedName &aFullName) const { return ServiceCache::Matches(aFullName); }
+
 bool Core::TxtCache::Matches(const ServiceName &aServiceName) const
 {
     return ServiceCache::Matches(aServiceName.mServiceInstance, aServiceName.mServiceType);
@@ -6833,10 +7434,16 @@ Error Core::AddrCache::Init(Instance &aInstance, Type aType, const char *aHostNa
 {
     CacheEntry::Init(aInstance, aType);
 
+    Error error;
+
     mNext        = nullptr;
     mShouldFlush = false;
 
-    return mName.Set(aHostName);
+    SuccessOrExit(error = mName.Set(aHostName));
+    mNameHash = NameHash::Calculate(/* aFirstLabel */ nullptr, mName.AsCString());
+
+exit:
+    return error;
 }
 
 Error Core::AddrCache::Init(Instance &aInstance, Type aType, const AddressResolver &aResolver)
@@ -6849,6 +7456,11 @@ bool Core::AddrCache::Matches(const Name &aFullName) const
     return aFullName.Matches(nullptr, mName.AsCString(), kLocalDomain);
 }
 
+bool Core::AddrCache::Matches(const HashedName &aFullName) const
+{
+    return (mNameHash == aFullName.GetHash()) && Matches(aFullName.GetName());
+}
+
 bool Core::AddrCache::Matches(const char *aName) const { return NameMatch(mName, aName); }
 
 bool Core::AddrCache::Matches(const AddressResolver &aResolver) const { return Matches(aResolver.mHostName); }
@@ -7265,6 +7877,7 @@ Error Core::RecordCache::Init(Instance &aInstance, const RecordQuerier &aQuerier
     SuccessOrExit(error = mFirstLabel.Set(aQuerier.mFirstLabel));
     SuccessOrExit(error = mNextLabels.Set(aQuerier.mNextLabels));
     mRecordType = aQuerier.mRecordType;
+    mNameHash   = NameHash::Calculate(mFirstLabel.AsCString(), mNextLabels.AsCString());
 
 exit:
     return error;
@@ -7276,6 +7889,11 @@ bool Core::RecordCache::Matches(const Name &aFullName, uint16_t aRecordType) con
            aFullName.Matches(mFirstLabel.AsCString(), mNextLabels.AsCString(), kLocalDomain);
 }
 
+bool Core::RecordCache::Matches(const HashedName &aFullName, uint16_t aRecordType) const
+{
+    return (mNameHash == aFullName.GetHash()) && Matches(aFullName.GetName(), aRecordType);
+}
+
 bool Core::RecordCache::Matches(const RecordQuerier &aQuerier) const
 {
     bool matches = false;
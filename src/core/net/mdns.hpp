@@ -41,6 +41,7 @@
 #include "common/debug.hpp"
 #include "common/equatable.hpp"
 #include "common/error.hpp"
+#include "common/fnv_hash.hpp"
 #include "common/heap_allocatable.hpp"
 #include "common/heap_array.hpp"
 #include "common/heap_data.hpp"
@@ -694,6 +695,35 @@ public:
      */
     void SetMaxMessageSize(uint16_t aMaxSize) { mMaxMessageSize = aMaxSize; }
 
+    /**
+     * Represents the mDNS transmit counters.
+     *
+     * The counters can be used to determine the average number of records packed in each sent message and the
+     * average bytes per record.
+     */
+    struct TxCounters : public Clearable<TxCounters>
+    {
+        uint32_t mQueryMessages;          ///< Number of sent query and probe messages.
+        uint32_t mQueryRecords;           ///< Number of questions and records in sent query and probe messages.
+        uint32_t mQueryBytes;             ///< Number of bytes in sent query and probe messages.
+        uint32_t mTruncatedQueryMessages; ///< Number of sent query messages with TC flag (multi-packet query).
+        uint32_t mResponseMessages;       ///< Number of sent response messages (multicast and unicast).
+        uint32_t mResponseRecords;        ///< Number of records in sent response messages.
+        uint32_t mResponseBytes;          ///< Number of bytes in sent response messages.
+    };
+
+    /**
+     * Returns the mDNS transmit counters.
+     *
+     * @returns The transmit counters.
+     */
+    const TxCounters &GetTxCounters(void) const { return mTxCounters; }
+
+    /**
+     * Resets the mDNS transmit counters.
+     */
+    void ResetTxCounters(void) { mTxCounters.Clear(); }
+
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
 
     /**
@@ -1011,6 +1041,7 @@ private:
         void     ReadFrom(const Header &aHeader);
         void     WriteTo(Header &aHeader) const;
         bool     IsEmpty(void) const;
+        uint16_t GetTotal(void) const;
 
     private:
         uint16_t mCounts[kNumSections];
@@ -1043,22 +1074,133 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+    class FireTimeQueue;
+
     class FireTime
     {
+        friend class FireTimeQueue;
+
     public:
-        FireTime(void) { ClearFireTime(); }
-        void      ClearFireTime(void) { mHasFireTime = false; }
-        bool      HasFireTime(void) const { return mHasFireTime; }
-        TimeMilli GetFireTime(void) const { return mFireTime; }
-        void      SetFireTime(TimeMilli aFireTime);
+        FireTime(void);
+        ~FireTime(void);
+        void            ClearFireTime(void);
+        bool            HasFireTime(void) const { return mHasFireTime; }
+        TimeMilli       GetFireTime(void) const { return mFireTime; }
+        void            SetFireTime(TimeMilli aFireTime);
+        FireTime       *GetNextInQueue(void) { return mNext; }
+        const FireTime *GetNextInQueue(void) const { return mNext; }
+        FireTime       *GetNextDue(void) { return mNextDue; }
 
     protected:
+        void SetQueue(FireTimeQueue &aQueue);
         void ScheduleFireTimeOn(TimerMilli &aTimer);
         void UpdateNextFireTimeOn(NextFireTime &aNextFireTime) const;
 
     private:
-        TimeMilli mFireTime;
-        bool      mHasFireTime;
+        FireTimeQueue *mQueue;
+        FireTime      *mPrev;
+        FireTime      *mNext;
+        FireTime      *mNextDue;
+        TimeMilli      mFireTime;
+        bool           mHasFireTime;
+        bool           mIsDue;
+    };
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    class FireTimeQueue : private NonCopyable
+    {
+        // Keeps all `FireTime` objects of one kind (host entries,
+        // service entries, service types, or cache entries) that
+        // have a fire time in a list sorted by their fire time. A
+        // `FireTime` is added to or removed from the queue when its
+        // fire time is set or cleared.
+        //
+        // The timer handlers use the "due list" to visit only the
+        // objects whose fire time is reached, instead of iterating
+        // over all of them. Other objects which get modified while
+        // preparing a message (e.g., a `HostEntry` whose addresses
+        // are appended by a `ServiceEntry`) are also added to the
+        // due list so that their append state can be cleared once
+        // the message is sent.
+
+        friend class FireTime;
+
+    public:
+        FireTimeQueue(void);
+
+        FireTime       *GetHead(void) { return mHead; }
+        const FireTime *GetHead(void) const { return mHead; }
+        void            UpdateNextFireTimeOn(NextFireTime &aNextFireTime) const;
+        void            PrepareDueList(TimeMilli aNow);
+        void            AddToDueList(FireTime &aFireTime);
+        FireTime       *GetDueList(void) { return mDueHead; }
+        void            ClearDueList(void);
+
+    private:
+        void Add(FireTime &aFireTime);
+        void Remove(FireTime &aFireTime);
+        void RemoveFromDueList(FireTime &aFireTime);
+
+        FireTime *mHead;
+        FireTime *mTail;
+        FireTime *mDueHead;
+        FireTime *mDueTail;
+    };
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    class NameHash
+    {
+        // Calculates a case-insensitive hash of a DNS name. Labels
+        // are joined using dot '.' char (ignoring a trailing dot),
+        // so the same hash is calculated for a name read from a
+        // message and for the same name given as C strings (labels).
+        // Entries and caches keep the hash of their name, allowing a
+        // name from a received message to be quickly compared
+        // against them before performing the full label-by-label
+        // name comparison.
+
+    public:
+        NameHash(void)
+            : mIsEmpty(true)
+        {
+        }
+
+        void     AddLabels(const char *aLabels);
+        void     AddName(const Name &aName);
+        uint32_t GetHash(void) const { return mHash.GetHash(); }
+
+        static uint32_t Calculate(const char *aFirstLabel, const char *aLabels);
+
+    private:
+        void AddLabelSeparator(void);
+        void AddChar(char aChar);
+
+        Fnv1aHash mHash;
+        bool      mIsEmpty;
+    };
+
+    class HashedName
+    {
+        // A name (from a received message) along with its `NameHash`.
+        // The hash is calculated on first use.
+
+    public:
+        explicit HashedName(const Name &aName)
+            : mName(aName)
+            , mHash(0)
+            , mIsHashCalculated(false)
+        {
+        }
+
+        const Name &GetName(void) const { return mName; }
+        uint32_t    GetHash(void) const;
+
+    private:
+        const Name      &mName;
+        mutable uint32_t mHash;
+        mutable bool     mIsHashCalculated;
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1289,6 +1431,7 @@ private:
         Error Init(Instance &aInstance, const Key &aKey) { return Init(aInstance, aKey.mName); }
         bool  IsEmpty(void) const;
         bool  Matches(const Name &aName) const;
+        bool  Matches(const HashedName &aName) const;
         bool  Matches(const Host &aHost) const;
         bool  Matches(const LocalHost &aLocalHost) const;
         bool  Matches(const Key &aKey) const;
@@ -1341,6 +1484,7 @@ private:
 
         HostEntry           *mNext;
         Heap::String         mName;
+        uint32_t             mNameHash;
         AddrRecord           mIp6AddrRecord;
         OwnedPtr<AddrRecord> mIp4AddrRecord;
         uint16_t             mNameOffset;
@@ -1360,11 +1504,13 @@ private:
         Error Init(Instance &aInstance, const Key &aKey);
         bool  IsEmpty(void) const;
         bool  Matches(const Name &aFullName) const;
+        bool  Matches(const HashedName &aFullName) const;
         bool  Matches(const Service &aService) const;
         bool  Matches(const Key &aKey) const;
         bool  Matches(State aState) const { return GetState() == aState; }
         bool  Matches(const ServiceEntry &aEntry) const { return (this == &aEntry); }
         bool  MatchesServiceType(const Name &aServiceType) const;
+        bool  MatchesServiceType(const HashedName &aServiceType) const;
         bool  CanAnswerSubType(const char *aSubLabel) const;
         void  Register(const Service &aService, const Callback &aCallback);
         void  Register(const Key &aKey, const Callback &aCallback);
@@ -1426,6 +1572,8 @@ private:
         ServiceEntry       *mNext;
         Heap::String        mServiceInstance;
         Heap::String        mServiceType;
+        uint32_t            mNameHash;
+        uint32_t            mServiceTypeHash;
         RecordInfo          mPtrRecord;
         RecordInfo          mSrvRecord;
         RecordInfo          mTxtRecord;
@@ -1497,6 +1645,7 @@ private:
         TxMessage(Instance &aInstance, Type aType, uint16_t aQueryId = 0);
         TxMessage(Instance &aInstance, Type aType, const AddressInfo &aUnicastDest, uint16_t aQueryId);
         Type          GetType(void) const { return mType; }
+        bool          IsEmpty(void) const { return mRecordCounts.IsEmpty(); }
         Message      &SelectMessageFor(Section aSection);
         AppendOutcome AppendLabel(Section aSection, const char *aLabel, uint16_t &aCompressOffset);
         AppendOutcome AppendMultipleLabels(Section aSection, const char *aLabels, uint16_t &aCompressOffset);
@@ -1506,6 +1655,8 @@ private:
         void          AddQuestionFrom(const Message &aMessage);
         void          IncrementRecordCount(Section aSection) { mRecordCounts.Increment(aSection); }
         void          CheckSizeLimitToPrepareAgain(bool &aPrepareAgain);
+        bool          CheckSizeLimitToContinueKnownAnswers(void);
+        void          CompleteMultiPacketQuery(void);
         void          SaveCurrentState(void);
         void          RestoreToSavedState(void);
         void          Send(void);
@@ -1516,6 +1667,7 @@ private:
         void          Init(Type aType, uint16_t aMessageId = 0);
         void          Reinit(void);
         bool          IsOverSizeLimit(void) const;
+        void          UpdateTxCounters(void) const;
         AppendOutcome AppendLabels(Section     aSection,
                                    const char *aLabels,
                                    bool        aIsSingleLabel,
@@ -1538,6 +1690,8 @@ private:
         uint16_t          mServicesDnssdOffset; // Offset to `_services._dns-sd`
         AddressInfo       mUnicastDest;
         Type              mType;
+        bool              mIsTruncated;               // Set the TC flag (more known-answers follow).
+        bool              mIsKnownAnswerContinuation; // Continues known-answers of a multi-packet query.
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1585,7 +1739,7 @@ private:
         void                ProcessResponse(void);
 
     private:
-        typedef void (RxMessage::*RecordProcessor)(const Name           &aName,
+        typedef void (RxMessage::*RecordProcessor)(const HashedName     &aName,
                                                    const ResourceRecord &aRecord,
                                                    uint16_t              aRecordOffset);
 
@@ -1620,13 +1774,13 @@ private:
         bool ShouldSuppressKnownAnswer(const Question &aQuestion, const ServiceType &aServiceType) const;
         void SendUnicastResponse(void);
         void IterateOnAllRecordsInResponse(RecordProcessor aRecordProcessor);
-        void ProcessRecordForConflict(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
-        void ProcessPtrRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
-        void ProcessSrvRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
-        void ProcessTxtRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
-        void ProcessAaaaRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
-        void ProcessARecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
-        void ProcessOtherRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
+        void ProcessRecordForConflict(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
+        void ProcessPtrRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
+        void ProcessSrvRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
+        void ProcessTxtRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
+        void ProcessAaaaRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
+        void ProcessARecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
+        void ProcessOtherRecord(const HashedName &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
 
         RxMessage            *mNext;
         TimeMilli             mRxTime;
@@ -1841,11 +1995,6 @@ private:
         // (e.g., query message construction).
 
     public:
-        void HandleTimer(CacheContext &aContext);
-        void ClearEmptyCallbacks(void);
-        void ScheduleQuery(TimeMilli aQueryTime);
-
-    protected:
         enum Type : uint8_t
         {
             kBrowseCache,
@@ -1856,9 +2005,16 @@ private:
             kRecordCache,
         };
 
+        Type GetType(void) const { return mType; }
+        bool ShouldDelete(TimeMilli aNow) const;
+        void HandleTimer(CacheContext &aContext);
+        void ClearAppendState(void);
+        void ClearEmptyCallbacks(void);
+        void ScheduleQuery(TimeMilli aQueryTime);
+
+    protected:
         void  Init(Instance &aInstance, Type aType);
         bool  IsActive(void) const { return mIsActive; }
-        bool  ShouldDelete(TimeMilli aNow) const;
         void  StartInitialQueries(void);
         void  StopQueryRetries(void) { mContinuousRetry = false; }
         Error Add(const ResultCallback &aCallback);
@@ -1911,6 +2067,7 @@ private:
     public:
         void  ClearCompressOffsets(void);
         bool  Matches(const Name &aFullName) const;
+        bool  Matches(const HashedName &aFullName) const;
         bool  Matches(const char *aServiceType, const char *aSubTypeLabel) const;
         bool  Matches(const Browser &aBrowser) const;
         bool  Matches(const ExpirationChecker &aChecker) const;
@@ -1950,6 +2107,7 @@ private:
         BrowseCache         *mNext;
         Heap::String         mServiceType;
         Heap::String         mSubTypeLabel;
+        uint32_t             mNameHash;
         OwningList<PtrEntry> mPtrEntries;
         uint16_t             mServiceTypeOffset;
         uint16_t             mSubServiceTypeOffset;
@@ -1988,6 +2146,7 @@ private:
 
         Error Init(Instance &aInstance, Type aType, const char *aServiceInstance, const char *aServiceType);
         bool  Matches(const Name &aFullName) const;
+        bool  Matches(const HashedName &aFullName) const;
         bool  Matches(const char *aServiceInstance, const char *aServiceType) const;
         void  PrepareQueryQuestion(TxMessage &aQuery, uint16_t aRrType);
         void  AppendServiceNameTo(TxMessage &aTxMessage, Section aSection);
@@ -1998,6 +2157,7 @@ private:
         CacheRecordInfo mRecord;
         Heap::String    mServiceInstance;
         Heap::String    mServiceType;
+        uint32_t        mNameHash;
         uint16_t        mServiceNameOffset;
         uint16_t        mServiceTypeOffset;
     };
@@ -2014,6 +2174,7 @@ private:
 
     public:
         bool  Matches(const Name &aFullName) const;
+        bool  Matches(const HashedName &aFullName) const;
         bool  Matches(const SrvResolver &aResolver) const;
         bool  Matches(const ServiceName &aServiceName) const;
         bool  Matches(const ExpirationChecker &aChecker) const;
@@ -2052,6 +2213,7 @@ private:
 
     public:
         bool  Matches(const Name &aFullName) const;
+        bool  Matches(const HashedName &aFullName) const;
         bool  Matches(const TxtResolver &aResolver) const;
         bool  Matches(const ServiceName &aServiceName) const;
         bool  Matches(const ExpirationChecker &aChecker) const;
@@ -2087,6 +2249,7 @@ private:
 
     public:
         bool  Matches(const Name &aFullName) const;
+        bool  Matches(const HashedName &aFullName) const;
         bool  Matches(const char *aName) const;
         bool  Matches(const AddressResolver &aResolver) const;
         bool  Matches(const ExpirationChecker &aChecker) const;
@@ -2127,6 +2290,7 @@ private:
 
         AddrCache            *mNext;
         Heap::String          mName;
+        uint32_t              mNameHash;
         OwningList<AddrEntry> mCommittedEntries;
         OwningList<AddrEntry> mNewEntries;
         bool                  mShouldFlush;
@@ -2176,6 +2340,7 @@ private:
 
     public:
         bool  Matches(const Name &aFullName, uint16_t aRecordType) const;
+        bool  Matches(const HashedName &aFullName, uint16_t aRecordType) const;
         bool  Matches(const RecordQuerier &aQuerier) const;
         bool  Matches(const ExpirationChecker &aChecker) const;
         Error Add(const RecordQuerier &aQuerier);
@@ -2235,6 +2400,7 @@ private:
         RecordCache               *mNext;
         Heap::String               mFirstLabel;
         Heap::String               mNextLabels;
+        uint32_t                   mNameHash;
         uint16_t                   mRecordType;
         OwningList<NewRecordEntry> mNewEntries;
         OwningList<RecordEntry>    mCommittedEntries;
@@ -2359,10 +2525,18 @@ private:
     TimeMilli RandomizeInitialQueryTxTime(void);
     void      RemoveEmptyEntries(void);
     void      HandleEntryTimer(void);
+    void      HandleDueCaches(CacheEntry::Type aType, CacheContext &aContext);
     void      HandleEntryTask(void);
     void      HandleCacheTimer(void);
     void      HandleCacheTask(void);
 
+    template <typename EntryType>
+    void DetermineNextAggrTxTime(const FireTimeQueue &aQueue,
+                                 TimeMilli            aWindowEnd,
+                                 NextFireTime        &aNextAggrTxTime) const;
+    template <typename EntryType> void HandleDueEntries(FireTimeQueue &aQueue, EntryContext &aContext);
+    template <typename EntryType> void ClearAppendStateOnDueEntries(FireTimeQueue &aQueue);
+
     static bool     IsKeyForService(const Key &aKey) { return aKey.mServiceType != nullptr; }
     static uint32_t DetermineTtl(uint32_t aTtl, uint32_t aDefaultTtl);
     static bool     NameMatch(const Heap::String &aHeapString, const char *aName);
@@ -2397,6 +2571,9 @@ private:
     uint16_t                 mMaxMessageSize;
     uint32_t                 mInfraIfIndex;
     LocalHost                mLocalHost;
+    FireTimeQueue            mHostEntryQueue;
+    FireTimeQueue            mServiceEntryQueue;
+    FireTimeQueue            mServiceTypeQueue;
     OwningList<HostEntry>    mHostEntries;
     OwningList<ServiceEntry> mServiceEntries;
     OwningList<ServiceType>  mServiceTypes;
@@ -2405,8 +2582,10 @@ private:
     EntryTimer               mEntryTimer;
     EntryTask                mEntryTask;
     TxMessageHistory         mTxMessageHistory;
+    TxCounters               mTxCounters;
     ConflictCallback         mConflictCallback;
 
+    FireTimeQueue            mCacheQueue;
     OwningList<BrowseCache>  mBrowseCacheList;
     OwningList<SrvCache>     mSrvCacheList;
     OwningList<TxtCache>     mTxtCacheList;
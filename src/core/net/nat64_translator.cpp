@@ -33,6 +33,7 @@
 
 #include "nat64_translator.hpp"
 
+#include "common/fnv_hash.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -109,12 +110,13 @@ uint16_t Translator::GetDestinationPortOrIcmp4Id(const Ip4::Headers &aIp4Headers
 
 Error Translator::TranslateIp6ToIp4(Message &aMessage)
 {
-    Error        error      = kErrorNone;
-    DropReason   dropReason = kReasonUnknown;
-    Ip6::Headers ip6Headers;
-    Ip4::Header  ip4Header;
-    uint16_t     srcPortOrId = 0;
-    Mapping     *mapping     = nullptr;
+    Error           error      = kErrorNone;
+    DropReason      dropReason = kReasonUnknown;
+    Ip6::Headers    ip6Headers;
+    Ip4::Header     ip4Header;
+    Checksum::Delta checksumDelta;
+    uint16_t        srcPortOrId = 0;
+    Mapping        *mapping     = nullptr;
 
     VerifyOrExit(mState == kStateActive, error = kErrorAbort);
 
@@ -132,7 +134,7 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
         ExitNow(error = kErrorAbort);
     }
 
-    mapping = mActiveMappings.FindMatching(ip6Headers);
+    mapping = mActiveMappings.Find(ip6Headers);
 
     if (mapping == nullptr)
     {
@@ -164,22 +166,34 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
     ip4Header.SetTtl(ip6Headers.GetIpHopLimit());
     ip4Header.SetIdentification(0);
 
+    // The transport checksum is updated incrementally (RFC 1624)
+    // from the changed pseudo-header and port (or ICMP ID) fields,
+    // so the cost of translation does not depend on the payload
+    // size. Here we remove the IPv6 pseudo-header addresses, the
+    // IPv4 ones are added for TCP and UDP (ICMPv4 checksum does not
+    // cover a pseudo-header).
+
+    checksumDelta.Remove(ip6Headers.GetSourceAddress());
+    checksumDelta.Remove(ip6Headers.GetDestinationAddress());
+
     switch (ip6Headers.GetIpProto())
     {
     // The IP header is consumed, so the next header is at offset 0.
     case Ip6::kProtoUdp:
         ip4Header.SetProtocol(Ip4::kProtoUdp);
-        ip6Headers.SetSourcePort(srcPortOrId);
+        UpdateChecksumFor6To4(ip6Headers, ip4Header, srcPortOrId, checksumDelta);
         aMessage.Write(0, ip6Headers.GetUdpHeader());
         break;
     case Ip6::kProtoTcp:
         ip4Header.SetProtocol(Ip4::kProtoTcp);
-        ip6Headers.SetSourcePort(srcPortOrId);
+        UpdateChecksumFor6To4(ip6Headers, ip4Header, srcPortOrId, checksumDelta);
         aMessage.Write(0, ip6Headers.GetTcpHeader());
         break;
     case Ip6::kProtoIcmp6:
         ip4Header.SetProtocol(Ip4::kProtoIcmp);
-        SuccessOrExit(TranslateIcmp6(aMessage, srcPortOrId));
+        checksumDelta.RemoveUint16(ip6Headers.GetIpLength());
+        checksumDelta.RemoveUint16(Ip6::kProtoIcmp6);
+        SuccessOrExit(TranslateIcmp6(aMessage, srcPortOrId, checksumDelta));
         break;
     default:
         dropReason = kReasonUnsupportedProto;
@@ -189,10 +203,11 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
     // TODO: Implement the logic for replying ICMP messages.
     ip4Header.SetTotalLength(sizeof(Ip4::Header) + aMessage.DetermineLengthAfterOffset());
 
-    Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
-                                    ip4Header.GetProtocol());
     Checksum::UpdateIp4HeaderChecksum(ip4Header);
 
+    // The IPv4 header is written in the space of the removed IPv6
+    // header, so the payload is never moved.
+
     if (aMessage.Prepend(ip4Header) != kErrorNone)
     {
         // This should never happen since the IPv4 header is shorter
@@ -217,12 +232,14 @@ exit:
 
 Error Translator::TranslateIp4ToIp6(Message &aMessage)
 {
-    Error        error      = kErrorNone;
-    DropReason   dropReason = kReasonUnknown;
-    Ip6::Header  ip6Header;
-    Ip4::Headers ip4Headers;
-    uint16_t     dstPortOrId = 0;
-    Mapping     *mapping     = nullptr;
+    Error           error      = kErrorNone;
+    DropReason      dropReason = kReasonUnknown;
+    Ip6::Header     ip6Header;
+    Ip4::Headers    ip4Headers;
+    Checksum::Delta checksumDelta;
+    uint16_t        dstPortOrId          = 0;
+    bool            shouldCalculateFully = false;
+    Mapping        *mapping              = nullptr;
 
     VerifyOrExit(mState == kStateActive, error = kErrorDrop);
 
@@ -232,7 +249,7 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
         ExitNow(error = kErrorDrop);
     }
 
-    mapping = mActiveMappings.FindMatching(ip4Headers);
+    mapping = mActiveMappings.Find(ip4Headers);
 
     if (mapping == nullptr)
     {
@@ -258,26 +275,37 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     ip6Header.SetFlow(0);
     ip6Header.SetHopLimit(ip4Headers.GetIpTtl());
 
+    ip6Header.SetPayloadLength(aMessage.DetermineLengthAfterOffset());
+
     // Note: TCP and UDP are the same for both IPv4 and IPv6 except
-    // for the checksum calculation, we will update the checksum in
-    // the payload later. However, we need to translate ICMPv6
-    // messages to ICMP messages in IPv4.
+    // for the checksum calculation. However, we need to translate
+    // ICMP messages to ICMPv6 messages. The checksum is updated
+    // incrementally (RFC 1624), except for an IPv4 UDP datagram
+    // without a checksum (zero) for which it is calculated over the
+    // whole datagram since UDP checksum is mandatory in IPv6.
+
+    checksumDelta.Add(ip6Header.GetSource());
+    checksumDelta.Add(ip6Header.GetDestination());
+
     switch (ip4Headers.GetIpProto())
     {
     // The IP header is consumed , so the next header is at offset 0.
     case Ip4::kProtoUdp:
         ip6Header.SetNextHeader(Ip6::kProtoUdp);
-        ip4Headers.SetDestinationPort(dstPortOrId);
+        shouldCalculateFully = (ip4Headers.GetChecksum() == 0);
+        UpdateChecksumFor4To6(ip4Headers, dstPortOrId, checksumDelta);
         aMessage.Write(0, ip4Headers.GetUdpHeader());
         break;
     case Ip4::kProtoTcp:
         ip6Header.SetNextHeader(Ip6::kProtoTcp);
-        ip4Headers.SetDestinationPort(dstPortOrId);
+        UpdateChecksumFor4To6(ip4Headers, dstPortOrId, checksumDelta);
         aMessage.Write(0, ip4Headers.GetTcpHeader());
         break;
     case Ip4::kProtoIcmp:
         ip6Header.SetNextHeader(Ip6::kProtoIcmp6);
-        SuccessOrExit(TranslateIcmp4(aMessage, dstPortOrId));
+        checksumDelta.AddUint16(ip6Header.GetPayloadLength());
+        checksumDelta.AddUint16(Ip6::kProtoIcmp6);
+        SuccessOrExit(TranslateIcmp4(aMessage, dstPortOrId, checksumDelta));
         break;
     default:
         dropReason = kReasonUnsupportedProto;
@@ -285,10 +313,17 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     }
 
     // TODO: Implement the logic for replying ICMP datagrams.
-    ip6Header.SetPayloadLength(aMessage.DetermineLengthAfterOffset());
 
-    Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
-                                    ip6Header.GetNextHeader());
+    if (shouldCalculateFully)
+    {
+        Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
+                                        ip6Header.GetNextHeader());
+    }
+
+    // The IPv6 header is written in the space of the removed IPv4
+    // header and the reserved header space of the message (messages
+    // from `NewIp4Message()` reserve room for an IPv6 header), so the
+    // payload is not moved.
 
     if (aMessage.Prepend(ip6Header) != kErrorNone)
     {
@@ -353,8 +388,66 @@ void Translator::Mapping::Free(void)
     Get<Translator>().mMappingPool.Free(*this);
 }
 
+uint16_t Translator::Mapping::GetIp6KeyPortOrId(void) const
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    return mSrcPortOrId;
+#else
+    return 0;
+#endif
+}
+
+uint16_t Translator::Mapping::GetIp4KeyPortOrId(void) const
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    return mTranslatedPortOrId;
+#else
+    return 0;
+#endif
+}
+
+void Translator::RemoveMapping(Mapping &aMapping)
+{
+    mActiveMappings.Remove(aMapping);
+    aMapping.Free();
+}
+
+void Translator::RemoveAllMappings(void)
+{
+    while (!mActiveMappings.IsEmpty())
+    {
+        RemoveMapping(*mActiveMappings.GetHead());
+    }
+}
+
+bool Translator::RemoveExpiredMappings(TimeMilli aNow)
+{
+    // Mappings are ordered from the most to the least recently used,
+    // so we walk back from the tail and stop at the first mapping
+    // used within `kMinExpireTimeout`, as none of the ones before it
+    // can be expired.
+
+    bool     didRemoveAny = false;
+    Mapping *mapping      = mActiveMappings.GetTail();
+
+    while ((mapping != nullptr) && (mapping->DetermineDurationSinceUse(aNow) >= kMinExpireTimeout))
+    {
+        Mapping *prev = mapping->mPrev;
+
+        if (mapping->IsExpired(aNow))
+        {
+            RemoveMapping(*mapping);
+            didRemoveAny = true;
+        }
+
+        mapping = prev;
+    }
+
+    return didRemoveAny;
+}
+
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
-uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
+uint16_t Translator::AllocateSourcePort(const Ip4::Address &aIp4Address, uint16_t aSrcPort)
 {
     // The translated port is randomly allocated from the range of
     // dynamic or private ports (RFC 7605 section 4). In this way, we
@@ -376,7 +469,7 @@ uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
             port++;
         }
 
-    } while (mActiveMappings.ContainsMatching(port));
+    } while (mActiveMappings.FindByIp4(aIp4Address, port) != nullptr);
 
     return port;
 }
@@ -406,16 +499,16 @@ Error Translator::AllocateIp4Address(Ip4::Address &aIp4Address)
 
     numberOfHosts = mMaxHostId - mMinHostId + 1;
 
-    if (mActiveMappings.CountAllEntries() >= numberOfHosts)
+    if (mActiveMappings.GetLength() >= numberOfHosts)
     {
         EvictStaleMapping();
-        VerifyOrExit(mActiveMappings.CountAllEntries() < numberOfHosts, error = kErrorFailed);
+        VerifyOrExit(mActiveMappings.GetLength() < numberOfHosts, error = kErrorFailed);
     }
 
     do
     {
         GetNextIp4Address(aIp4Address);
-    } while (mActiveMappings.ContainsMatching(aIp4Address));
+    } while (mActiveMappings.FindByIp4(aIp4Address, 0) != nullptr);
 
 exit:
     return error;
@@ -453,16 +546,20 @@ Translator::Mapping *Translator::AllocateMapping(const Ip6::Headers &aIp6Headers
 
     VerifyOrExit(mapping != nullptr);
 
-    mActiveMappings.Push(*mapping);
     mapping->mCounters.Clear();
-    mapping->mId         = ++mNextMappingId;
-    mapping->mIp6Address = aIp6Headers.GetSourceAddress();
-    mapping->mIp4Address = ip4Addr;
+    mapping->mId          = ++mNextMappingId;
+    mapping->mIp6Address  = aIp6Headers.GetSourceAddress();
+    mapping->mIp4Address  = ip4Addr;
+    mapping->mLastUseTime = TimerMilli::GetNow();
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     mapping->mSrcPortOrId        = GetSourcePortOrIcmp6Id(aIp6Headers);
-    mapping->mTranslatedPortOrId = AllocateSourcePort(mapping->mSrcPortOrId);
+    mapping->mTranslatedPortOrId = AllocateSourcePort(ip4Addr, mapping->mSrcPortOrId);
 #endif
 
+    // The mapping is added after its addresses and ports are set,
+    // since they determine its hash buckets.
+    mActiveMappings.Add(*mapping);
+
     LogInfo("Mapping created: %s", mapping->ToString().AsCString());
 
 exit:
@@ -542,31 +639,39 @@ void Translator::EvictStaleMapping(void)
 {
     // First tries to remove expired mappings, if there is no expired
     // mapping, it will then try to evict a stale mapping.
+    //
+    // Mappings eligible for eviction are the least recently used
+    // ones, so we walk back from the tail of the list and stop at the
+    // first non-eligible mapping. Since the walk goes from the oldest
+    // to the newest, we can also stop as soon as we find an ICMP-only
+    // mapping (the most preferred category).
 
-    TimeMilli      now            = TimerMilli::GetNow();
-    const Mapping *evictCandidate = nullptr;
-    bool           didRemoveAny;
-
-    didRemoveAny = mActiveMappings.RemoveAndFreeAllMatching(ExpirationChecker(now));
+    TimeMilli now            = TimerMilli::GetNow();
+    Mapping  *evictCandidate = nullptr;
 
-    VerifyOrExit(!didRemoveAny);
+    VerifyOrExit(!RemoveExpiredMappings(now));
 
-    for (const Mapping &mapping : mActiveMappings)
+    for (Mapping *mapping = mActiveMappings.GetTail(); mapping != nullptr; mapping = mapping->mPrev)
     {
-        if (!mapping.IsEligibleForEviction(now))
+        if (!mapping->IsEligibleForEviction(now))
         {
-            continue;
+            break;
         }
 
-        if ((evictCandidate == nullptr) || mapping.IsBetterEvictionCandidateOver(*evictCandidate, now))
+        if ((evictCandidate == nullptr) || mapping->IsBetterEvictionCandidateOver(*evictCandidate, now))
         {
-            evictCandidate = &mapping;
+            evictCandidate = mapping;
+        }
+
+        if (evictCandidate->DetermineProtocolCategory() == Mapping::kIcmpOnly)
+        {
+            break;
         }
     }
 
     if (evictCandidate != nullptr)
     {
-        mActiveMappings.RemoveMatching(*evictCandidate);
+        RemoveMapping(*evictCandidate);
     }
 
 exit:
@@ -588,6 +693,8 @@ void Translator::Mapping::Touch(uint8_t aProtocol)
 
     mLastUseTime    = TimerMilli::GetNow();
     mExpirationTime = mLastUseTime + timeout;
+
+    Get<Translator>().mActiveMappings.MoveToHead(*this);
 }
 
 bool Translator::Mapping::Matches(const Ip6::Headers &aIp6Headers) const
@@ -620,7 +727,235 @@ exit:
     return matches;
 }
 
-Error Translator::TranslateIcmp4(Message &aMessage, uint16_t aOriginalId)
+//---------------------------------------------------------------------------------------------------------------------
+// Translator::MappingTable
+
+void Translator::MappingTable::Clear(void)
+{
+    mHead   = nullptr;
+    mTail   = nullptr;
+    mLength = 0;
+    ClearAllBytes(mIp6Buckets);
+    ClearAllBytes(mIp4Buckets);
+}
+
+void Translator::MappingTable::Add(Mapping &aMapping)
+{
+    Mapping *&ip6Bucket = mIp6Buckets[BucketFor(aMapping.mIp6Address, aMapping.GetIp6KeyPortOrId())];
+    Mapping *&ip4Bucket = mIp4Buckets[BucketFor(aMapping.mIp4Address, aMapping.GetIp4KeyPortOrId())];
+
+    aMapping.mPrev = nullptr;
+    aMapping.mNext = mHead;
+
+    if (mHead != nullptr)
+    {
+        mHead->mPrev = &aMapping;
+    }
+    else
+    {
+        mTail = &aMapping;
+    }
+
+    mHead = &aMapping;
+
+    aMapping.mNextByIp6 = ip6Bucket;
+    ip6Bucket           = &aMapping;
+    aMapping.mNextByIp4 = ip4Bucket;
+    ip4Bucket           = &aMapping;
+
+    mLength++;
+}
+
+void Translator::MappingTable::Remove(Mapping &aMapping)
+{
+    Mapping **entry;
+
+    for (entry = &mIp6Buckets[BucketFor(aMapping.mIp6Address, aMapping.GetIp6KeyPortOrId())]; *entry != &aMapping;
+         entry = &(*entry)->mNextByIp6)
+    {
+        OT_ASSERT(*entry != nullptr);
+    }
+
+    *entry = aMapping.mNextByIp6;
+
+    for (entry = &mIp4Buckets[BucketFor(aMapping.mIp4Address, aMapping.GetIp4KeyPortOrId())]; *entry != &aMapping;
+         entry = &(*entry)->mNextByIp4)
+    {
+        OT_ASSERT(*entry != nullptr);
+    }
+
+    *entry = aMapping.mNextByIp4;
+
+    if (aMapping.mPrev != nullptr)
+    {
+        aMapping.mPrev->mNext = aMapping.mNext;
+    }
+    else
+    {
+        mHead = aMapping.mNext;
+    }
+
+    if (aMapping.mNext != nullptr)
+    {
+        aMapping.mNext->mPrev = aMapping.mPrev;
+    }
+    else
+    {
+        mTail = aMapping.mPrev;
+    }
+
+    aMapping.mNext      = nullptr;
+    aMapping.mPrev      = nullptr;
+    aMapping.mNextByIp6 = nullptr;
+    aMapping.mNextByIp4 = nullptr;
+
+    mLength--;
+}
+
+void Translator::MappingTable::MoveToHead(Mapping &aMapping)
+{
+    VerifyOrExit(mHead != &aMapping);
+
+    // `aMapping` is not the head, so it has a previous entry.
+
+    aMapping.mPrev->mNext = aMapping.mNext;
+
+    if (aMapping.mNext != nullptr)
+    {
+        aMapping.mNext->mPrev = aMapping.mPrev;
+    }
+    else
+    {
+        mTail = aMapping.mPrev;
+    }
+
+    aMapping.mPrev = nullptr;
+    aMapping.mNext = mHead;
+    mHead->mPrev   = &aMapping;
+    mHead          = &aMapping;
+
+exit:
+    return;
+}
+
+Translator::Mapping *Translator::MappingTable::Find(const Ip6::Headers &aIp6Headers)
+{
+    uint16_t portOrId = 0;
+    Mapping *mapping;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    portOrId = GetSourcePortOrIcmp6Id(aIp6Headers);
+#endif
+
+    for (mapping = mIp6Buckets[BucketFor(aIp6Headers.GetSourceAddress(), portOrId)]; mapping != nullptr;
+         mapping = mapping->mNextByIp6)
+    {
+        if (mapping->Matches(aIp6Headers))
+        {
+            break;
+        }
+    }
+
+    return mapping;
+}
+
+Translator::Mapping *Translator::MappingTable::Find(const Ip4::Headers &aIp4Headers)
+{
+    uint16_t portOrId = 0;
+    Mapping *mapping;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    portOrId = GetDestinationPortOrIcmp4Id(aIp4Headers);
+#endif
+
+    for (mapping = mIp4Buckets[BucketFor(aIp4Headers.GetDestinationAddress(), portOrId)]; mapping != nullptr;
+         mapping = mapping->mNextByIp4)
+    {
+        if (mapping->Matches(aIp4Headers))
+        {
+            break;
+        }
+    }
+
+    return mapping;
+}
+
+Translator::Mapping *Translator::MappingTable::FindByIp4(const Ip4::Address &aIp4Address, uint16_t aPortOrId)
+{
+    Mapping *mapping;
+
+    for (mapping = mIp4Buckets[BucketFor(aIp4Address, aPortOrId)]; mapping != nullptr; mapping = mapping->mNextByIp4)
+    {
+        if ((mapping->mIp4Address == aIp4Address) && (mapping->GetIp4KeyPortOrId() == aPortOrId))
+        {
+            break;
+        }
+    }
+
+    return mapping;
+}
+
+uint16_t Translator::MappingTable::BucketFor(const Ip6::Address &aIp6Address, uint16_t aPortOrId)
+{
+    Fnv1aHash hash;
+
+    hash.Add(aIp6Address);
+    hash.Add(aPortOrId);
+
+    return BucketFor(hash.GetHash());
+}
+
+uint16_t Translator::MappingTable::BucketFor(const Ip4::Address &aIp4Address, uint16_t aPortOrId)
+{
+    Fnv1aHash hash;
+
+    hash.Add(aIp4Address);
+    hash.Add(aPortOrId);
+
+    return BucketFor(hash.GetHash());
+}
+
+uint16_t Translator::MappingTable::BucketFor(uint32_t aHash)
+{
+    // Fibonacci hashing: the upper bits of the product depend on all
+    // bits of `aHash`.
+
+    return static_cast<uint16_t>((aHash * kGoldenRatio) >> 16) & (kNumBuckets - 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void Translator::UpdateChecksumFor6To4(Ip6::Headers      &aIp6Headers,
+                                       const Ip4::Header &aIp4Header,
+                                       uint16_t           aSrcPort,
+                                       Checksum::Delta   &aChecksumDelta)
+{
+    // Updates the TCP/UDP source port and checksum in `aIp6Headers`.
+    // `aChecksumDelta` already has the IPv6 addresses removed.
+
+    aChecksumDelta.Add(aIp4Header.GetSource());
+    aChecksumDelta.Add(aIp4Header.GetDestination());
+    aChecksumDelta.ReplaceUint16(aIp6Headers.GetSourcePort(), aSrcPort);
+
+    aIp6Headers.SetSourcePort(aSrcPort);
+    aIp6Headers.SetChecksum(aChecksumDelta.ApplyTo(aIp6Headers.GetChecksum()));
+}
+
+void Translator::UpdateChecksumFor4To6(Ip4::Headers &aIp4Headers, uint16_t aDstPort, Checksum::Delta &aChecksumDelta)
+{
+    // Updates the TCP/UDP destination port and checksum in
+    // `aIp4Headers`. `aChecksumDelta` already has the IPv6 addresses
+    // added.
+
+    aChecksumDelta.Remove(aIp4Headers.GetSourceAddress());
+    aChecksumDelta.Remove(aIp4Headers.GetDestinationAddress());
+    aChecksumDelta.ReplaceUint16(aIp4Headers.GetDestinationPort(), aDstPort);
+
+    aIp4Headers.SetDestinationPort(aDstPort);
+    aIp4Headers.SetChecksum(aChecksumDelta.ApplyTo(aIp4Headers.GetChecksum()));
+}
+
+Error Translator::TranslateIcmp4(Message &aMessage, uint16_t aOriginalId, Checksum::Delta &aChecksumDelta)
 {
     Error            error = kErrorNone;
     Ip4::Icmp4Header icmp4Header;
@@ -641,6 +976,9 @@ Error Translator::TranslateIcmp4(Message &aMessage, uint16_t aOriginalId)
         SuccessOrExit(error = aMessage.Read(0, icmp6Header));
         icmp6Header.SetType(Ip6::Icmp6Header::kTypeEchoReply);
         icmp6Header.SetId(aOriginalId);
+        aChecksumDelta.ReplaceUint16(icmp4Header.GetType() << 8, icmp6Header.GetType() << 8);
+        aChecksumDelta.ReplaceUint16(icmp4Header.GetId(), aOriginalId);
+        icmp6Header.SetChecksum(aChecksumDelta.ApplyTo(icmp4Header.GetChecksum()));
         aMessage.Write(0, icmp6Header);
         break;
 
@@ -653,7 +991,7 @@ exit:
     return error;
 }
 
-Error Translator::TranslateIcmp6(Message &aMessage, uint16_t aTranslatedId)
+Error Translator::TranslateIcmp6(Message &aMessage, uint16_t aTranslatedId, Checksum::Delta &aChecksumDelta)
 {
     Error            error = kErrorNone;
     Ip4::Icmp4Header icmp4Header;
@@ -674,6 +1012,9 @@ Error Translator::TranslateIcmp6(Message &aMessage, uint16_t aTranslatedId)
         SuccessOrExit(error = aMessage.Read(0, icmp4Header));
         icmp4Header.SetType(Ip4::Icmp4Header::Type::kTypeEchoRequest);
         icmp4Header.SetId(aTranslatedId);
+        aChecksumDelta.ReplaceUint16(icmp6Header.GetType() << 8, icmp4Header.GetType() << 8);
+        aChecksumDelta.ReplaceUint16(icmp6Header.GetId(), aTranslatedId);
+        icmp4Header.SetChecksum(aChecksumDelta.ApplyTo(icmp6Header.GetChecksum()));
         aMessage.Write(0, icmp4Header);
         break;
 
@@ -711,7 +1052,7 @@ Error Translator::SetIp4Cidr(const Ip4::Cidr &aCidr)
 
     mNextHostId = mMinHostId;
 
-    mActiveMappings.Free();
+    RemoveAllMappings();
 
     LogInfo("IPv4 CIDR for NAT64: %s (%lu addresses)", aCidr.ToString().AsCString(),
             ToUlong(mMaxHostId - mMinHostId + 1));
@@ -733,7 +1074,7 @@ void Translator::ClearIp4Cidr(void)
     LogInfo("Clearing IPv4 CIDR");
 
     mIp4Cidr.Clear();
-    mActiveMappings.Free();
+    RemoveAllMappings();
 
     UpdateState();
 
@@ -785,7 +1126,7 @@ exit:
 
 void Translator::HandleTimer(void)
 {
-    mActiveMappings.RemoveAndFreeAllMatching(ExpirationChecker(TimerMilli::GetNow()));
+    RemoveExpiredMappings(TimerMilli::GetNow());
     mTimer.Start(Min(kIcmpTimeout, kIdleTimeout));
 }
 
@@ -874,7 +1215,7 @@ void Translator::SetState(State aState)
     case kStateDisabled:
     case kStateNotRunning:
     case kStateIdle:
-        mActiveMappings.Free();
+        RemoveAllMappings();
         break;
     case kStateActive:
         break;
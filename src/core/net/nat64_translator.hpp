@@ -37,9 +37,9 @@
 #include "openthread-core-config.h"
 
 #include "common/locator.hpp"
-#include "common/owning_list.hpp"
 #include "common/pool.hpp"
 #include "common/timer.hpp"
+#include "net/checksum.hpp"
 #include "net/ip4_types.hpp"
 #include "net/ip6.hpp"
 
@@ -285,11 +285,19 @@ private:
 
     static_assert(kIdleTimeout >= kMinUdpTimeout, "OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS is too short");
 
+    // A mapping not used for `kMinExpireTimeout` may have expired.
+    static constexpr uint32_t kMinExpireTimeout = (kIdleTimeout < kIcmpTimeout) ? kIdleTimeout : kIcmpTimeout;
+
     static constexpr uint32_t kPoolSize = OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS;
 
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     static constexpr uint16_t kMinTranslationPort = 49152;
     static constexpr uint16_t kMaxTranslationPort = 65535;
+
+    // Translated ports preserve the parity of the source port, so
+    // only half of the range is available for any given mapping.
+    static_assert(kPoolSize <= (kMaxTranslationPort - kMinTranslationPort + 1) / 2,
+                  "OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS exceeds the translated port range");
 #endif
 
     static constexpr DropReason kReasonUnknown          = OT_NAT64_DROP_REASON_UNKNOWN;
@@ -297,7 +305,7 @@ private:
     static constexpr DropReason kReasonUnsupportedProto = OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO;
     static constexpr DropReason kReasonNoMapping        = OT_NAT64_DROP_REASON_NO_MAPPING;
 
-    struct Mapping : public InstanceLocatorInit, public LinkedListEntry<Mapping>
+    struct Mapping : public InstanceLocatorInit
     {
         static constexpr uint16_t kInfoStringSize = 80;
 
@@ -310,28 +318,30 @@ private:
             kTcpAndMaybeOthers,
         };
 
-        void          Init(Instance &aInstance) { InstanceLocatorInit::Init(aInstance); }
-        void          Free(void);
-        void          Touch(uint8_t aProtocol);
-        InfoString    ToString(void) const;
-        void          CopyTo(AddressMapping &aMapping, TimeMilli aNow) const;
-        uint32_t      DetermineDurationSinceUse(TimeMilli aNow) const { return aNow - mLastUseTime; }
-        ProtoCategory DetermineProtocolCategory(void) const;
-        bool          IsEligibleForEviction(TimeMilli aNow) const;
-        bool          IsBetterEvictionCandidateOver(const Mapping &aOther, TimeMilli aNow) const;
-        bool          Matches(const Ip6::Headers &aIp6Headers) const;
-        bool          Matches(const Ip4::Headers &aIp4Headers) const;
-        bool          Matches(const ExpirationChecker &aChecker) const { return aChecker.IsExpired(mExpirationTime); }
-        bool          Matches(const Mapping &aMapping) const { return this == &aMapping; }
-#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
-        bool Matches(const uint16_t aPort) const { return mTranslatedPortOrId == aPort; }
-#else
-        bool Matches(const Ip4::Address &aIp4Address) const { return mIp4Address == aIp4Address; }
-#endif
+        void           Init(Instance &aInstance) { InstanceLocatorInit::Init(aInstance); }
+        void           Free(void);
+        void           Touch(uint8_t aProtocol);
+        InfoString     ToString(void) const;
+        void           CopyTo(AddressMapping &aMapping, TimeMilli aNow) const;
+        uint32_t       DetermineDurationSinceUse(TimeMilli aNow) const { return aNow - mLastUseTime; }
+        ProtoCategory  DetermineProtocolCategory(void) const;
+        bool           IsExpired(TimeMilli aNow) const { return aNow >= mExpirationTime; }
+        bool           IsEligibleForEviction(TimeMilli aNow) const;
+        bool           IsBetterEvictionCandidateOver(const Mapping &aOther, TimeMilli aNow) const;
+        bool           Matches(const Ip6::Headers &aIp6Headers) const;
+        bool           Matches(const Ip4::Headers &aIp4Headers) const;
+        Mapping       *GetNext(void) { return mNext; }
+        const Mapping *GetNext(void) const { return mNext; }
+        void           SetNext(Mapping *aNext) { mNext = aNext; }
+        uint16_t       GetIp6KeyPortOrId(void) const;
+        uint16_t       GetIp4KeyPortOrId(void) const;
 
         static bool IsCounterZero(const ProtocolCounters::Counters &aCounters);
 
-        Mapping         *mNext;
+        Mapping         *mNext;      // Next (less recently used) mapping in `MappingTable`.
+        Mapping         *mPrev;      // Previous (more recently used) mapping in `MappingTable`.
+        Mapping         *mNextByIp6; // Next mapping in the same IPv6 hash bucket.
+        Mapping         *mNextByIp4; // Next mapping in the same IPv4 hash bucket.
         uint64_t         mId;
         TimeMilli        mLastUseTime;
         TimeMilli        mExpirationTime;
@@ -344,21 +354,75 @@ private:
 #endif
     };
 
+    class MappingTable
+    {
+        // Tracks the active mappings. Mappings are kept in a doubly
+        // linked list ordered from the most to the least recently
+        // used one, and are indexed by two hash tables: one keyed by
+        // the IPv6 source address (and port or ICMP ID when port
+        // translation is enabled) for outbound translation, and one
+        // keyed by the IPv4 address (and translated port or ICMP ID)
+        // for inbound translation.
+
+    public:
+        MappingTable(void) { Clear(); }
+
+        void           Clear(void);
+        bool           IsEmpty(void) const { return mHead == nullptr; }
+        uint16_t       GetLength(void) const { return mLength; }
+        Mapping       *GetHead(void) { return mHead; }
+        const Mapping *GetHead(void) const { return mHead; }
+        Mapping       *GetTail(void) { return mTail; }
+        void           Add(Mapping &aMapping);
+        void           Remove(Mapping &aMapping);
+        void           MoveToHead(Mapping &aMapping);
+        Mapping       *Find(const Ip6::Headers &aIp6Headers);
+        Mapping       *Find(const Ip4::Headers &aIp4Headers);
+        Mapping       *FindByIp4(const Ip4::Address &aIp4Address, uint16_t aPortOrId);
+
+    private:
+        static constexpr uint16_t kNumBuckets  = OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE;
+        static constexpr uint32_t kGoldenRatio = 2654435769u;
+
+        static_assert(kNumBuckets > 0 && (kNumBuckets & (kNumBuckets - 1)) == 0,
+                      "OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE MUST be a power of two");
+
+        static uint16_t BucketFor(const Ip6::Address &aIp6Address, uint16_t aPortOrId);
+        static uint16_t BucketFor(const Ip4::Address &aIp4Address, uint16_t aPortOrId);
+        static uint16_t BucketFor(uint32_t aHash);
+
+        Mapping *mHead;
+        Mapping *mTail;
+        uint16_t mLength;
+        Mapping *mIp6Buckets[kNumBuckets];
+        Mapping *mIp4Buckets[kNumBuckets];
+    };
+
     bool     IsEnabled(void) const { return mState != kStateDisabled; }
     bool     HasValidPrefixAndCidr(void) const;
     void     SetState(State aState);
     void     UpdateState(void);
-    Error    TranslateIcmp4(Message &aMessage, uint16_t aOriginalId);
-    Error    TranslateIcmp6(Message &aMessage, uint16_t aTranslatedId);
+    Error    TranslateIcmp4(Message &aMessage, uint16_t aOriginalId, Checksum::Delta &aChecksumDelta);
+    Error    TranslateIcmp6(Message &aMessage, uint16_t aTranslatedId, Checksum::Delta &aChecksumDelta);
     void     GetNextIp4Address(Ip4::Address &aIp4Address);
     Error    AllocateIp4Address(Ip4::Address &aIp4Address);
     Mapping *AllocateMapping(const Ip6::Headers &aIp6Headers);
+    void     RemoveMapping(Mapping &aMapping);
+    void     RemoveAllMappings(void);
+    bool     RemoveExpiredMappings(TimeMilli aNow);
     void     EvictStaleMapping(void);
     void     HandleTimer(void);
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
-    uint16_t AllocateSourcePort(uint16_t aSrcPort);
+    uint16_t AllocateSourcePort(const Ip4::Address &aIp4Address, uint16_t aSrcPort);
 #endif
 
+    static void     UpdateChecksumFor6To4(Ip6::Headers      &aIp6Headers,
+                                          const Ip4::Header &aIp4Header,
+                                          uint16_t           aSrcPort,
+                                          Checksum::Delta   &aChecksumDelta);
+    static void     UpdateChecksumFor4To6(Ip4::Headers    &aIp4Headers,
+                                          uint16_t         aDstPort,
+                                          Checksum::Delta &aChecksumDelta);
     static uint16_t GetSourcePortOrIcmp6Id(const Ip6::Headers &aIp6Headers);
     static uint16_t GetDestinationPortOrIcmp4Id(const Ip4::Headers &aIp4Headers);
 
@@ -367,7 +431,7 @@ private:
     State                    mState;
     uint64_t                 mNextMappingId;
     Pool<Mapping, kPoolSize> mMappingPool;
-    OwningList<Mapping>      mActiveMappings;
+    MappingTable             mActiveMappings;
     Ip6::Prefix              mNat64Prefix;
     Ip4::Cidr                mIp4Cidr;
     uint32_t                 mMinHostId;
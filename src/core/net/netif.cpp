@@ -436,6 +436,10 @@ void Netif::SignalUnicastAddressChange(AddressEvent aEvent, const UnicastAddress
 
     Get<Notifier>().Signal(event);
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+    Get<MeshForwarder>().InvalidateRouteCache();
+#endif
+
 #if OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
     Get<Srp::Client>().HandleUnicastAddressEvent(aEvent, aAddress);
 #endif
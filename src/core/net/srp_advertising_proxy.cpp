@@ -232,7 +232,7 @@ void AdvertisingProxy::AdvertiseRemovalOf(Host &aHost)
     {
         Host &advHost = adv.mHost;
 
-        if (!aHost.Matches(advHost.GetFullName()) || advHost.IsDeleted())
+        if (!aHost.Matches(advHost) || advHost.IsDeleted())
         {
             continue;
         }
@@ -241,7 +241,7 @@ void AdvertisingProxy::AdvertiseRemovalOf(Host &aHost)
         {
             Service *service;
 
-            service = aHost.FindService(advService.GetInstanceName());
+            service = aHost.FindService(advService);
 
             if (service == nullptr)
             {
@@ -329,7 +329,7 @@ void AdvertisingProxy::AdvertiseRemovalOf(Service &aService)
         const Host    &advHost = adv.mHost;
         const Service *advService;
 
-        if (!aService.mHost->Matches(advHost.GetFullName()))
+        if (!aService.mHost->Matches(advHost))
         {
             continue;
         }
@@ -339,7 +339,7 @@ void AdvertisingProxy::AdvertiseRemovalOf(Service &aService)
             break;
         }
 
-        advService = advHost.FindService(aService.GetInstanceName());
+        advService = advHost.FindService(aService);
 
         if ((advService != nullptr) && !advService->IsDeleted())
         {
@@ -381,7 +381,7 @@ void AdvertisingProxy::Advertise(Host &aHost, const Server::MessageMetadata &aMe
 
     for (AdvInfo &adv : mAdvInfoList)
     {
-        if (!aHost.Matches(adv.mHost.GetFullName()))
+        if (!aHost.Matches(adv.mHost))
         {
             continue;
         }
@@ -404,7 +404,7 @@ void AdvertisingProxy::Advertise(Host &aHost, const Server::MessageMetadata &aMe
         }
     }
 
-    existingHost = Get<Server>().mHosts.FindMatching(aHost.GetFullName());
+    existingHost = Get<Server>().FindHost(aHost);
 
     if (existingHost != nullptr)
     {
@@ -614,7 +614,7 @@ bool AdvertisingProxy::CompareAndUpdateHostAndServices(Host &aHost, Host &aExist
 
     for (Service &service : aHost.mServices)
     {
-        Service *existingService = aExistingHost.mServices.FindMatching(service.GetInstanceName());
+        Service *existingService = aExistingHost.FindService(service);
 
         if (existingService != nullptr)
         {
@@ -821,7 +821,7 @@ bool AdvertisingProxy::CompareAndUpdateHost(Host &aHost, Host &aExistingHost)
         {
             for (Service &existingService : aExistingHost.mServices)
             {
-                if (!aHost.HasService(existingService.GetInstanceName()))
+                if (!aHost.HasService(existingService))
                 {
                     UnregisterKey(existingService);
                 }
@@ -855,7 +855,7 @@ bool AdvertisingProxy::CompareAndUpdateHost(Host &aHost, Host &aExistingHost)
             continue;
         }
 
-        if (aHost.HasService(existingService.GetInstanceName()))
+        if (aHost.HasService(existingService))
         {
             // The `existingService` that are contained in `aHost`
             // are updated in `CompareAndUpdateService()`.
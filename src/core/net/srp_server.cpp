@@ -33,6 +33,7 @@
 
 #include "srp_server.hpp"
 
+
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
 #include "instance/instance.hpp"
@@ -78,6 +79,9 @@ Server::Server(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mSocket(aInstance, *this)
     , mLeaseTimer(aInstance)
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    , mPersistTimer(aInstance)
+#endif
     , mOutstandingUpdatesTimer(aInstance)
     , mCompletedUpdateTask(aInstance)
     , mServiceUpdateId(Random::NonCrypto::Generate<uint32_t>())
@@ -89,10 +93,14 @@ Server::Server(Instance &aInstance)
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     , mAutoEnable(false)
 #endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    , mHasRestoredHosts(false)
+#endif
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     , mFastStartMode(false)
 #endif
 {
+    mLeaseCounters.Clear();
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
@@ -137,6 +145,14 @@ void Server::SetEnabled(bool aEnabled)
     }
     else
     {
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+        // The server is disabled on purpose, so its registered hosts
+        // are cleared and are not restored when it is enabled again.
+        if (mState != kStateDisabled)
+        {
+            ClearSavedHosts();
+        }
+#endif
         Disable();
     }
 }
@@ -464,7 +480,8 @@ void Server::RemoveHost(Host *aHost, RetainName aRetainName)
     else
     {
         aHost->SetKeyLease(0);
-        IgnoreError(mHosts.Remove(*aHost));
+        RemoveCommittedHost(*aHost);
+        mLeaseQueue.Remove(*aHost);
         LogInfo("Fully remove host %s", aHost->GetFullName());
     }
 
@@ -492,14 +509,88 @@ void Server::RemoveHost(Host *aHost, RetainName aRetainName)
         aHost->Free();
     }
 
+    HandleHostsChange();
+
+exit:
+    return;
+}
+
+void Server::AddCommittedHost(Host &aHost)
+{
+    // Adds `aHost` to the list of committed hosts and adds it along
+    // with all its services to the name tables. Services that are
+    // later added to or removed from `aHost` update the tables from
+    // `Host::AddService()` and `Host::RemoveService()`.
+
+    mHosts.Push(aHost);
+    mHostNameTable.Add(aHost);
+
+    for (Service &service : aHost.mServices)
+    {
+        AddToNameTables(service);
+    }
+
+    aHost.mIsInNameTables = true;
+
+    HandleHostsChange();
+}
+
+void Server::RemoveCommittedHost(Host &aHost)
+{
+    IgnoreError(mHosts.Remove(aHost));
+    VerifyOrExit(aHost.mIsInNameTables);
+
+    mHostNameTable.Remove(aHost);
+
+    for (Service &service : aHost.mServices)
+    {
+        RemoveFromNameTables(service);
+    }
+
+    aHost.mIsInNameTables = false;
+
 exit:
     return;
 }
 
+void Server::HandleHostsChange(void)
+{
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE && OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    Get<Dns::ServiceDiscovery::Server>().HandleSrpServerHostsChange();
+#endif
+}
+
+void Server::AddToNameTables(Service &aService)
+{
+    mInstanceNameTable.Add(aService);
+    mServiceNameTable.Add(aService);
+}
+
+void Server::RemoveFromNameTables(Service &aService)
+{
+    mInstanceNameTable.Remove(aService);
+    mServiceNameTable.Remove(aService);
+}
+
+const Server::Host *Server::FindHost(const char *aFullName, uint32_t aFullNameHash) const
+{
+    const Host *host = nullptr;
+
+    while ((host = mHostNameTable.FindNext(aFullNameHash, host)) != nullptr)
+    {
+        if (host->Matches(aFullName, aFullNameHash))
+        {
+            break;
+        }
+    }
+
+    return host;
+}
+
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *existingHost = FindHost(aHost);
 
     if ((existingHost != nullptr) && (aHost.mKey != existingHost->mKey))
     {
@@ -507,17 +598,16 @@ bool Server::HasNameConflictsWith(Host &aHost) const
         ExitNow(hasConflicts = true);
     }
 
-    for (const Host &host : mHosts)
+    // Verify that no allocated services of other hosts (with a
+    // different key) have the same instance name.
+
+    for (const Service &service : aHost.mServices)
     {
-        if (aHost.mKey == host.mKey)
-        {
-            continue;
-        }
+        const Service *existingService = nullptr;
 
-        // Verify that no allocated services have the same instance name.
-        for (const Service &service : aHost.mServices)
+        while ((existingService = mInstanceNameTable.FindNext(service.mInstanceNameHash, existingService)) != nullptr)
         {
-            if (host.HasService(service.GetInstanceName()))
+            if (existingService->Matches(service) && (existingService->GetHost().mKey != aHost.mKey))
             {
                 LogWarn("Name conflict: service name %s has already been allocated", service.GetInstanceName());
                 ExitNow(hasConflicts = true);
@@ -617,7 +707,13 @@ void Server::CommitSrpUpdate(Error                    aError,
     grantedKeyLease = useShortLease ? grantedLease : aLeaseConfig.GrantKeyLease(hostKeyLease);
     grantedTtl      = aTtlConfig.GrantTtl(grantedLease, aHost.GetTtl());
 
-    existingHost = mHosts.RemoveMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost);
+
+    if (existingHost != nullptr)
+    {
+        RemoveCommittedHost(*existingHost);
+        mLeaseQueue.Remove(*existingHost);
+    }
 
     LogInfo("Committing update for %s host %s", (existingHost != nullptr) ? "existing" : "new", aHost.GetFullName());
     LogInfo("    Granted lease:%lu, key-lease:%lu, ttl:%lu", ToUlong(grantedLease), ToUlong(grantedKeyLease),
@@ -632,13 +728,16 @@ void Server::CommitSrpUpdate(Error                    aError,
         if (existingHost != nullptr)
         {
             LogInfo("Fully remove host %s", aHost.GetFullName());
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+            SchedulePersist();
+#endif
         }
 
         aHost.Free();
         ExitNow();
     }
 
-    mHosts.Push(aHost);
+    AddCommittedHost(aHost);
 
     for (Service &service : aHost.mServices)
     {
@@ -656,7 +755,7 @@ void Server::CommitSrpUpdate(Error                    aError,
             {
                 action = Service::kRemoveButRetainName;
             }
-            else if ((existingHost != nullptr) && existingHost->HasService(service.GetInstanceName()))
+            else if ((existingHost != nullptr) && existingHost->HasService(service))
             {
                 action = Service::kUpdateExisting;
             }
@@ -675,7 +774,7 @@ void Server::CommitSrpUpdate(Error                    aError,
 
         while ((existingService = existingHost->mServices.Pop()) != nullptr)
         {
-            if (!aHost.HasService(existingService->GetInstanceName()))
+            if (!aHost.HasService(*existingService))
             {
                 aHost.AddService(*existingService);
 
@@ -719,10 +818,12 @@ void Server::CommitSrpUpdate(Error                    aError,
     }
 #endif
 
-    if (!aHost.IsDeleted())
-    {
-        mLeaseTimer.FireAtIfEarlier(Min(aHost.GetExpireTime(), aHost.GetKeyExpireTime()));
-    }
+    mLeaseQueue.Add(aHost);
+    UpdateLeaseTimer();
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    SchedulePersist(aHost);
+#endif
 
 exit:
     if (aMessageInfo != nullptr)
@@ -785,6 +886,16 @@ void Server::Start(void)
     SuccessOrExit(error = PrepareSocket());
     LogInfo("Start listening on port %u", mPort);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    // Saved hosts are restored only on the first start after the
+    // instance is initialized, i.e., after a reboot or a restart.
+    if (!mHasRestoredHosts)
+    {
+        mHasRestoredHosts = true;
+        RestoreHosts();
+    }
+#endif
+
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
     Get<AdvertisingProxy>().HandleServerStateChange();
 #endif
@@ -887,11 +998,24 @@ void Server::Stop(void)
 
     mState = kStateStopped;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    // Save any pending change before removing the hosts so that
+    // they are restored when the server is started again.
+    if (mPersistTimer.IsRunning())
+    {
+        SaveHosts();
+    }
+#endif
+
     while (!mHosts.IsEmpty())
     {
         RemoveHost(mHosts.GetHead(), kDeleteName);
     }
 
+    mHostNameTable.Clear();
+    mInstanceNameTable.Clear();
+    mServiceNameTable.Clear();
+
     // TODO: We should cancel any outstanding service updates, but current
     // OTBR mDNS publisher cannot properly handle it.
     while (!mOutstandingUpdates.IsEmpty())
@@ -1229,7 +1353,7 @@ Error Server::ProcessServiceDiscoveryInstructions(Host                  &aHost,
             // service is processed.
 
             VerifyOrExit(service->mServiceName.IsNull(), error = kErrorFailed);
-            SuccessOrExit(error = service->mServiceName.Set(serviceName));
+            SuccessOrExit(error = service->SetServiceName(serviceName));
             service->mIsDeleted = isDelete;
         }
 
@@ -1373,7 +1497,7 @@ Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, Mes
     uint16_t          offset = aMetadata.mOffset;
     uint16_t          sigOffset;
     uint16_t          sigRdataOffset;
-    Dns::Name::Buffer signerName;
+    uint16_t          signerNameOffset;
     uint16_t          signatureLength;
 
     VerifyOrExit(aMetadata.mDnsHeader.GetAdditionalRecordCount() == 2, error = kErrorFailed);
@@ -1425,7 +1549,8 @@ Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, Mes
     // implemented because the end device may not be able to get
     // the synchronized date/time.
 
-    SuccessOrExit(error = Dns::Name::ReadName(aMessage, offset, signerName));
+    signerNameOffset = offset;
+    SuccessOrExit(error = Dns::Name::ParseName(aMessage, offset));
 
     signatureLength = sigRecord.GetLength() - (offset - sigRdataOffset);
     offset += signatureLength;
@@ -1437,7 +1562,7 @@ Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, Mes
     VerifyOrExit(signatureLength == Crypto::Ecdsa::P256::Signature::kSize, error = kErrorParse);
 
     SuccessOrExit(error = VerifySignature(aHost->mKey, aMessage, aMetadata.mDnsHeader, sigOffset, sigRdataOffset,
-                                          sigRecord.GetLength(), signerName));
+                                          sigRecord.GetLength(), signerNameOffset));
 
     aMetadata.mOffset = offset;
 
@@ -1452,15 +1577,16 @@ Error Server::VerifySignature(const Host::Key  &aKey,
                               uint16_t          aSigOffset,
                               uint16_t          aSigRdataOffset,
                               uint16_t          aSigRdataLength,
-                              const char       *aSignerName) const
+                              uint16_t          aSignerNameOffset) const
 {
+    static constexpr uint8_t kRootLabelLength = 0;
+
     Error                          error;
     uint16_t                       offset = aMessage.GetOffset();
     uint16_t                       signatureOffset;
     Crypto::Sha256                 sha256;
     Crypto::Sha256::Hash           hash;
     Crypto::Ecdsa::P256::Signature signature;
-    Message                       *signerNameMessage = nullptr;
 
     VerifyOrExit(aSigRdataLength >= Crypto::Ecdsa::P256::Signature::kSize, error = kErrorInvalidArgs);
 
@@ -1471,10 +1597,27 @@ Error Server::VerifySignature(const Host::Key  &aKey,
 
     // The uncompressed (canonical) form of the signer name should be used for signature
     // verification. See https://tools.ietf.org/html/rfc2931#section-3.1 for details.
-    signerNameMessage = Get<Ip6::Udp>().NewMessage();
-    VerifyOrExit(signerNameMessage != nullptr, error = kErrorNoBufs);
-    SuccessOrExit(error = Dns::Name::AppendName(aSignerName, *signerNameMessage));
-    sha256.Update(*signerNameMessage, signerNameMessage->GetOffset(), signerNameMessage->GetLength());
+    // The labels are read one by one from `aMessage` (following any compression pointers)
+    // and fed directly into the hash.
+    while (true)
+    {
+        Dns::Name::LabelBuffer label;
+        uint8_t                labelLength = sizeof(label);
+
+        error = Dns::Name::ReadLabel(aMessage, aSignerNameOffset, label, labelLength);
+
+        if (error == kErrorNotFound)
+        {
+            break;
+        }
+
+        SuccessOrExit(error);
+
+        sha256.Update(labelLength);
+        sha256.Update(label, labelLength);
+    }
+
+    sha256.Update(kRootLabelLength);
 
     // We need the DNS header before appending the SIG RR.
     aDnsHeader.SetAdditionalRecordCount(aDnsHeader.GetAdditionalRecordCount() - 1);
@@ -1490,7 +1633,6 @@ Error Server::VerifySignature(const Host::Key  &aKey,
 
 exit:
     LogWarnOnError(error, "verify message signature");
-    FreeMessage(signerNameMessage);
     return error;
 }
 
@@ -1505,7 +1647,7 @@ void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost);
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -1516,7 +1658,7 @@ void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
     {
         Service *service;
 
-        if (existingService.mIsDeleted || aHost.HasService(existingService.GetInstanceName()))
+        if (existingService.mIsDeleted || aHost.HasService(existingService))
         {
             continue;
         }
@@ -1525,7 +1667,7 @@ void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
                                       aMetadata.mRxTime);
         VerifyOrExit(service != nullptr, error = kErrorNoBufs);
 
-        SuccessOrExit(error = service->mServiceName.Set(existingService.GetServiceName()));
+        SuccessOrExit(error = service->SetServiceName(existingService.GetServiceName()));
         service->mIsDeleted = true;
         service->SetKeyLease(existingService.GetKeyLease());
     }
@@ -1751,28 +1893,39 @@ exit:
 
 void Server::HandleLeaseTimer(void)
 {
-    NextFireTime nextExpireTime;
-    Host        *nextHost;
+    TimeMilli now         = TimerMilli::GetNow();
+    uint32_t  expirations = mLeaseCounters.mExpirations;
+    Host     *host;
+
+    mLeaseCounters.mTimerFires++;
 
-    for (Host *host = mHosts.GetHead(); host != nullptr; host = nextHost)
+    // `mLeaseQueue` is sorted by the lease event time of the hosts,
+    // so only the hosts at the head of the queue with an expired
+    // lease or key lease (on the host or any of its services) are
+    // processed.
+
+    while (((host = mLeaseQueue.GetHead()) != nullptr) && (host->mLeaseEventTime <= now))
     {
-        nextHost = host->GetNext();
+        uint32_t hostExpirations = mLeaseCounters.mExpirations;
+
+        mLeaseCounters.mHostsProcessed++;
 
-        if (host->GetKeyExpireTime() <= nextExpireTime.GetNow())
+        if (host->GetKeyExpireTime() <= now)
         {
             LogInfo("KEY LEASE of host %s expired", host->GetFullName());
+            mLeaseCounters.mExpirations++;
 
             // Removes the whole host and all services if the KEY RR expired.
             RemoveHost(host, kDeleteName);
+            continue;
         }
-        else if (host->IsDeleted())
+
+        if (host->IsDeleted())
         {
             // The host has been deleted, but the hostname & service instance names retain.
 
             Service *next;
 
-            nextExpireTime.UpdateIfEarlier(host->GetKeyExpireTime());
-
             // Check if any service instance name expired.
             for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
             {
@@ -1780,20 +1933,18 @@ void Server::HandleLeaseTimer(void)
 
                 OT_ASSERT(service->mIsDeleted);
 
-                if (service->GetKeyExpireTime() <= nextExpireTime.GetNow())
+                if (service->GetKeyExpireTime() <= now)
                 {
                     service->Log(Service::kKeyLeaseExpired);
+                    mLeaseCounters.mExpirations++;
                     host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
                 }
-                else
-                {
-                    nextExpireTime.UpdateIfEarlier(service->GetKeyExpireTime());
-                }
             }
         }
-        else if (host->GetExpireTime() <= nextExpireTime.GetNow())
+        else if (host->GetExpireTime() <= now)
         {
             LogInfo("LEASE of host %s expired", host->GetFullName());
+            mLeaseCounters.mExpirations++;
 
             // If the host expired, delete all resources of this host and its services.
             for (Service &service : host->mServices)
@@ -1803,8 +1954,6 @@ void Server::HandleLeaseTimer(void)
             }
 
             RemoveHost(host, kRetainName);
-
-            nextExpireTime.UpdateIfEarlier(host->GetKeyExpireTime());
         }
         else
         {
@@ -1812,41 +1961,65 @@ void Server::HandleLeaseTimer(void)
 
             Service *next;
 
-            OT_ASSERT(!host->IsDeleted());
-
-            nextExpireTime.UpdateIfEarlier(host->GetExpireTime());
-
             for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
             {
                 next = service->GetNext();
 
-                if (service->GetKeyExpireTime() <= nextExpireTime.GetNow())
+                if (service->GetKeyExpireTime() <= now)
                 {
                     service->Log(Service::kKeyLeaseExpired);
+                    mLeaseCounters.mExpirations++;
                     host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
                 }
-                else if (service->mIsDeleted)
-                {
-                    // The service has been deleted but the name retains.
-                    nextExpireTime.UpdateIfEarlier(service->GetKeyExpireTime());
-                }
-                else if (service->GetExpireTime() <= nextExpireTime.GetNow())
+                else if (!service->mIsDeleted && (service->GetExpireTime() <= now))
                 {
                     service->Log(Service::kLeaseExpired);
+                    mLeaseCounters.mExpirations++;
 
                     // The service is expired, delete it.
                     host->RemoveService(service, kRetainName, kNotifyServiceHandler);
-                    nextExpireTime.UpdateIfEarlier(service->GetKeyExpireTime());
-                }
-                else
-                {
-                    nextExpireTime.UpdateIfEarlier(service->GetExpireTime());
                 }
             }
         }
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+        if (mLeaseCounters.mExpirations != hostExpirations)
+        {
+            SchedulePersist(*host);
+        }
+#else
+        OT_UNUSED_VARIABLE(hostExpirations);
+#endif
+
+        mLeaseQueue.Update(*host);
+    }
+
+    UpdateLeaseTimer();
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    // Hosts removed due to key lease expiration are deleted from
+    // `Settings` on the next save.
+    if (mLeaseCounters.mExpirations != expirations)
+    {
+        SchedulePersist();
     }
+#else
+    OT_UNUSED_VARIABLE(expirations);
+#endif
+}
 
-    mLeaseTimer.FireAtIfEarlier(nextExpireTime);
+void Server::UpdateLeaseTimer(void)
+{
+    Host *head = mLeaseQueue.GetHead();
+
+    if (head == nullptr)
+    {
+        mLeaseTimer.Stop();
+    }
+    else
+    {
+        mLeaseTimer.FireAt(head->mLeaseEventTime);
+    }
 }
 
 void Server::HandleOutstandingUpdatesTimer(void)
@@ -1996,13 +2169,15 @@ Error Server::Service::Init(const char *aInstanceName, const char *aInstanceLabe
 
     LeaseTracker::Init(aUpdateTime);
 
-    mNext        = nullptr;
-    mHost        = &aHost;
-    mPriority    = 0;
-    mWeight      = 0;
-    mPort        = 0;
-    mIsDeleted   = false;
-    mIsCommitted = false;
+    mNext                = nullptr;
+    mNextInInstanceTable = nullptr;
+    mNextInServiceTable  = nullptr;
+    mHost                = &aHost;
+    mPriority            = 0;
+    mWeight              = 0;
+    mPort                = 0;
+    mIsDeleted           = false;
+    mIsCommitted         = false;
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
     mIsRegistered      = false;
     mIsKeyRegistered   = false;
@@ -2017,8 +2192,11 @@ Error Server::Service::Init(const char *aInstanceName, const char *aInstanceLabe
     mParsedSrv            = false;
     mParsedTxt            = false;
 
+    mServiceNameHash = 0;
+
     SuccessOrExit(error = mInstanceLabel.Set(aInstanceLabel));
-    error = mInstanceName.Set(aInstanceName);
+    SuccessOrExit(error = mInstanceName.Set(aInstanceName));
+    mInstanceNameHash = Dns::Name::CalculateHash(aInstanceName);
 
 exit:
     return error;
@@ -2071,6 +2249,27 @@ bool Server::Service::Matches(const char *aInstanceName) const
     return StringMatch(mInstanceName.AsCString(), aInstanceName, kStringCaseInsensitiveMatch);
 }
 
+bool Server::Service::Matches(const char *aInstanceName, uint32_t aInstanceNameHash) const
+{
+    return (mInstanceNameHash == aInstanceNameHash) && Matches(aInstanceName);
+}
+
+bool Server::Service::Matches(const Service &aService) const
+{
+    return Matches(aService.GetInstanceName(), aService.mInstanceNameHash);
+}
+
+Error Server::Service::SetServiceName(const char *aServiceName)
+{
+    Error error;
+
+    SuccessOrExit(error = mServiceName.Set(aServiceName));
+    mServiceNameHash = Dns::Name::CalculateHash(aServiceName);
+
+exit:
+    return error;
+}
+
 bool Server::Service::HasSubTypeServiceName(const char *aSubTypeServiceName) const
 {
     bool has = false;
@@ -2146,8 +2345,17 @@ exit:
 Server::Host::Host(Instance &aInstance, TimeMilli aUpdateTime)
     : InstanceLocator(aInstance)
     , mNext(nullptr)
+    , mNextInNameTable(nullptr)
+    , mPrevInLeaseQueue(nullptr)
+    , mNextInLeaseQueue(nullptr)
+    , mLeaseEventTime(aUpdateTime)
+    , mFullNameHash(0)
     , mParsedKey(false)
     , mUseShortLeaseOption(false)
+    , mIsInNameTables(false)
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    , mShouldSave(false)
+#endif
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
     , mIsRegistered(false)
     , mIsKeyRegistered(false)
@@ -2173,13 +2381,15 @@ Error Server::Host::SetFullName(const char *aFullName)
 
     if (mFullName.IsNull())
     {
-        error = mFullName.Set(aFullName);
+        SuccessOrExit(error = mFullName.Set(aFullName));
+        mFullNameHash = Dns::Name::CalculateHash(aFullName);
     }
     else
     {
         error = Matches(aFullName) ? kErrorNone : kErrorFailed;
     }
 
+exit:
     return error;
 }
 
@@ -2188,6 +2398,13 @@ bool Server::Host::Matches(const char *aFullName) const
     return StringMatch(mFullName.AsCString(), aFullName, kStringCaseInsensitiveMatch);
 }
 
+bool Server::Host::Matches(const char *aFullName, uint32_t aFullNameHash) const
+{
+    return (mFullNameHash == aFullNameHash) && Matches(aFullName);
+}
+
+bool Server::Host::Matches(const Host &aHost) const { return Matches(aHost.GetFullName(), aHost.mFullNameHash); }
+
 const Server::Service *Server::Host::GetNextService(const Service *aPrevService) const
 {
     return (aPrevService == nullptr) ? mServices.GetHead() : aPrevService->GetNext();
@@ -2210,6 +2427,11 @@ void Server::Host::AddService(Service &aService)
 {
     aService.mHost = this;
     mServices.Push(aService);
+
+    if (mIsInNameTables)
+    {
+        Get<Server>().AddToNameTables(aService);
+    }
 }
 
 void Server::Host::RemoveService(Service *aService, RetainName aRetainName, NotifyMode aNotifyServiceHandler)
@@ -2250,9 +2472,17 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
     if (!aRetainName)
     {
         IgnoreError(mServices.Remove(*aService));
+
+        if (mIsInNameTables)
+        {
+            server.RemoveFromNameTables(*aService);
+        }
+
         aService->Free();
     }
 
+    server.HandleHostsChange();
+
 exit:
     return;
 }
@@ -2267,14 +2497,17 @@ void Server::Host::FreeAllServices(void)
 
 void Server::Host::ClearResources(void) { mAddresses.Free(); }
 
-Server::Service *Server::Host::FindService(const char *aInstanceName) { return mServices.FindMatching(aInstanceName); }
+Server::Service *Server::Host::FindService(const char *aInstanceName)
+{
+    return AsNonConst(AsConst(this)->FindService(aInstanceName));
+}
 
 const Server::Service *Server::Host::FindService(const char *aInstanceName) const
 {
-    return mServices.FindMatching(aInstanceName);
+    return mServices.FindMatching(aInstanceName, Dns::Name::CalculateHash(aInstanceName));
 }
 
-bool Server::Host::HasService(const char *aInstanceName) const { return mServices.ContainsMatching(aInstanceName); }
+bool Server::Host::HasService(const char *aInstanceName) const { return FindService(aInstanceName) != nullptr; }
 
 Error Server::Host::AddIp6Address(const Ip6::Address &aIp6Address)
 {
@@ -2301,6 +2534,701 @@ exit:
     return error;
 }
 
+TimeMilli Server::Host::DetermineLeaseEventTime(void) const
+{
+    // Determines the earliest time at which the lease or the key
+    // lease of the host or any of its services expires. For a
+    // deleted host or service only the key lease is tracked.
+
+    TimeMilli eventTime = GetKeyExpireTime();
+
+    if (!IsDeleted())
+    {
+        eventTime = Min(eventTime, GetExpireTime());
+    }
+
+    for (const Service &service : mServices)
+    {
+        eventTime = Min(eventTime, service.GetKeyExpireTime());
+
+        if (!service.IsDeleted())
+        {
+            eventTime = Min(eventTime, service.GetExpireTime());
+        }
+    }
+
+    return eventTime;
+}
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+void Server::SchedulePersist(void)
+{
+    // Changes are combined and saved together after a short delay.
+    // The timer is not restarted by later changes, which bounds the
+    // time a change can remain unsaved.
+
+    if (!mPersistTimer.IsRunning())
+    {
+        mPersistTimer.Start(kPersistSaveDelay);
+    }
+}
+
+void Server::SchedulePersist(Host &aHost)
+{
+    aHost.mShouldSave = true;
+    SchedulePersist();
+}
+
+void Server::SaveHosts(void)
+{
+    // Updates the saved hosts in `Settings`, one entry per host. Each
+    // entry starts with the format version and the host name which
+    // identifies the entry. Only the entries of removed hosts are
+    // deleted, and only the changed hosts (marked by `mShouldSave`)
+    // are saved again. Unchanged entries are kept as they are.
+
+    TimeMilli now        = TimerMilli::GetNow();
+    uint8_t  *buffer     = nullptr;
+    uint16_t  numSaved   = 0;
+    uint16_t  numDeleted = 0;
+    int       index      = 0;
+
+    mPersistTimer.Stop();
+
+    buffer = static_cast<uint8_t *>(Heap::CAlloc(kMaxPersistedHostSize, sizeof(uint8_t)));
+
+    if (buffer == nullptr)
+    {
+        LogWarn("Failed to save hosts: %s", ErrorToString(kErrorNoBufs));
+        ExitNow();
+    }
+
+    while (true)
+    {
+        uint16_t          length = kMaxPersistedHostSize;
+        FrameData         frameData;
+        uint8_t           version;
+        Dns::Name::Buffer name;
+        const Host       *host = nullptr;
+
+        SuccessOrExit(Get<Settings>().ReadSrpServerHost(index, buffer, length));
+
+        frameData.Init(buffer, Min(length, kMaxPersistedHostSize));
+
+        if ((frameData.ReadUint8(version) == kErrorNone) && (version == kPersistFormatVersion) &&
+            (ReadName(frameData, name) == kErrorNone))
+        {
+            host = FindHost(name, Dns::Name::CalculateHash(name));
+        }
+
+        if ((host != nullptr) && !host->mShouldSave)
+        {
+            index++;
+            continue;
+        }
+
+        // The host is removed or changed (or the entry is invalid).
+        // The order of the remaining entries is not guaranteed to
+        // be kept on delete, so the scan is restarted from the
+        // first entry.
+
+        SuccessOrExit(Get<Settings>().DeleteSrpServerHost(index));
+
+        if (host == nullptr)
+        {
+            numDeleted++;
+        }
+
+        index = 0;
+    }
+
+exit:
+    if (buffer != nullptr)
+    {
+        for (Host &host : mHosts)
+        {
+            Error error;
+
+            if (!host.mShouldSave)
+            {
+                continue;
+            }
+
+            host.mShouldSave = false;
+            error            = SaveHost(host, buffer, now);
+
+            if (error != kErrorNone)
+            {
+                LogWarn("Failed to save host %s: %s", host.GetFullName(), ErrorToString(error));
+                continue;
+            }
+
+            numSaved++;
+        }
+    }
+
+    if ((numSaved != 0) || (numDeleted != 0))
+    {
+        LogInfo("Saved %u hosts, deleted %u hosts", numSaved, numDeleted);
+    }
+
+    Heap::Free(buffer);
+}
+
+Error Server::SaveHost(const Host &aHost, uint8_t *aBuffer, TimeMilli aNow)
+{
+    Error        error;
+    FrameBuilder frameBuilder;
+
+    frameBuilder.Init(aBuffer, kMaxPersistedHostSize);
+
+    SuccessOrExit(error = frameBuilder.AppendUint8(kPersistFormatVersion));
+    SuccessOrExit(error = AppendName(frameBuilder, aHost.GetFullName()));
+    SuccessOrExit(error = aHost.AppendTo(frameBuilder, aNow));
+
+    error = Get<Settings>().AddSrpServerHost(aBuffer, frameBuilder.GetLength());
+
+exit:
+    return error;
+}
+
+void Server::ClearSavedHosts(void)
+{
+    mPersistTimer.Stop();
+    Get<Settings>().DeleteAllSrpServerHosts();
+}
+
+void Server::RestoreHosts(void)
+{
+    TimeMilli now        = TimerMilli::GetNow();
+    uint8_t  *buffer     = nullptr;
+    uint16_t  numHosts   = 0;
+    uint16_t  numDropped = 0;
+
+    VerifyOrExit(mHosts.IsEmpty());
+
+    buffer = static_cast<uint8_t *>(Heap::CAlloc(kMaxPersistedHostSize, sizeof(uint8_t)));
+    VerifyOrExit(buffer != nullptr);
+
+    for (int index = 0;; index++)
+    {
+        uint16_t  length = kMaxPersistedHostSize;
+        FrameData frameData;
+        Error     error;
+
+        SuccessOrExit(Get<Settings>().ReadSrpServerHost(index, buffer, length));
+
+        frameData.Init(buffer, Min(length, kMaxPersistedHostSize));
+        error = RestoreHost(frameData, now);
+
+        if (error != kErrorNone)
+        {
+            if (error != kErrorNotFound)
+            {
+                LogWarn("Failed to restore host at index %d: %s", index, ErrorToString(error));
+            }
+
+            numDropped++;
+            continue;
+        }
+
+        numHosts++;
+    }
+
+exit:
+    if (numHosts != 0)
+    {
+        LogInfo("Restored %u hosts", numHosts);
+        UpdateLeaseTimer();
+    }
+
+    if (numDropped != 0)
+    {
+        // Save all restored hosts again. This deletes the entries of
+        // the dropped hosts along with any duplicate entry of a
+        // restored host from `Settings`.
+
+        for (Host &host : mHosts)
+        {
+            host.mShouldSave = true;
+        }
+
+        SchedulePersist();
+    }
+
+    Heap::Free(buffer);
+}
+
+Error Server::RestoreHost(FrameData &aFrameData, TimeMilli aNow)
+{
+    // Returns `kErrorNotFound` if the host is dropped since its lease
+    // or key lease had already expired when it was saved.
+
+    Error             error = kErrorNone;
+    Host             *host  = nullptr;
+    uint8_t           version;
+    bool              isExpired;
+    Dns::Name::Buffer name;
+
+    SuccessOrExit(error = aFrameData.ReadUint8(version));
+    VerifyOrExit(version == kPersistFormatVersion, error = kErrorNotCapable);
+    SuccessOrExit(error = ReadName(aFrameData, name));
+
+    host = Host::Allocate(GetInstance(), aNow);
+    VerifyOrExit(host != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = host->SetFullName(name));
+    SuccessOrExit(error = host->ReadFrom(aFrameData, aNow, isExpired));
+
+    if (isExpired)
+    {
+        LogInfo("Dropped host %s, lease expired", name);
+        ExitNow(error = kErrorNotFound);
+    }
+
+    VerifyOrExit(FindHost(*host) == nullptr, error = kErrorDuplicated);
+
+    AddCommittedHost(*host);
+    mLeaseQueue.Add(*host);
+
+    LogInfo("Restored host %s", host->GetFullName());
+
+exit:
+    if ((error != kErrorNone) && (host != nullptr))
+    {
+        host->Free();
+    }
+
+    return error;
+}
+
+Error Server::AppendName(FrameBuilder &aFrameBuilder, const char *aName)
+{
+    Error   error;
+    uint8_t length = static_cast<uint8_t>(StringLength(aName, Dns::Name::kMaxNameSize - 1));
+
+    SuccessOrExit(error = aFrameBuilder.AppendUint8(length));
+    error = aFrameBuilder.AppendBytes(aName, length);
+
+exit:
+    return error;
+}
+
+Error Server::ReadName(FrameData &aFrameData, Dns::Name::Buffer &aName)
+{
+    Error   error;
+    uint8_t length;
+
+    SuccessOrExit(error = aFrameData.ReadUint8(length));
+    VerifyOrExit(length < sizeof(aName), error = kErrorParse);
+    SuccessOrExit(error = aFrameData.ReadBytes(aName, length));
+    aName[length] = kNullChar;
+
+exit:
+    return error;
+}
+
+Error Server::LeaseTracker::AppendLeaseInfoTo(FrameBuilder &aFrameBuilder, TimeMilli aNow) const
+{
+    // The time elapsed since the last update is saved (instead of
+    // the update time itself) so that the expire times can be
+    // determined relative to the time the entry is restored.
+
+    Error error;
+
+    SuccessOrExit(error = aFrameBuilder.AppendUint<kBigEndian>(mLease));
+    SuccessOrExit(error = aFrameBuilder.AppendUint<kBigEndian>(mKeyLease));
+    SuccessOrExit(error = aFrameBuilder.AppendUint<kBigEndian>(mTtl));
+    error = aFrameBuilder.AppendUint<kBigEndian>(static_cast<uint32_t>(aNow - mUpdateTime));
+
+exit:
+    return error;
+}
+
+Error Server::LeaseTracker::ReadLeaseInfoFrom(FrameData &aFrameData, TimeMilli aNow, bool &aIsExpired)
+{
+    // The remaining lease and key lease at the time the entry was
+    // saved are restored, counting from `aNow`. The time the server
+    // was not running is not accounted for since it cannot be
+    // determined: the platform time `otPlatTimeGet()` has no defined
+    // epoch and may restart from zero after a reboot. The client is
+    // expected to refresh its registration before the lease ends.
+    // `aIsExpired` is set if the key lease or (for an entry that is
+    // not deleted) the lease had expired when the entry was saved.
+
+    Error    error;
+    uint32_t elapsed;
+
+    SuccessOrExit(error = aFrameData.ReadUint<kBigEndian>(mLease));
+    SuccessOrExit(error = aFrameData.ReadUint<kBigEndian>(mKeyLease));
+    SuccessOrExit(error = aFrameData.ReadUint<kBigEndian>(mTtl));
+    SuccessOrExit(error = aFrameData.ReadUint<kBigEndian>(elapsed));
+
+    aIsExpired = (elapsed >= static_cast<uint64_t>(mKeyLease) * 1000u) ||
+                 ((mLease != 0) && (elapsed >= static_cast<uint64_t>(mLease) * 1000u));
+
+    VerifyOrExit(!aIsExpired);
+
+    mUpdateTime = aNow - elapsed;
+
+exit:
+    return error;
+}
+
+Error Server::Host::AppendTo(FrameBuilder &aFrameBuilder, TimeMilli aNow) const
+{
+    // The host name is appended by `Server::SaveHost()` as it is
+    // used to identify the saved entry.
+
+    Error    error;
+    uint32_t numServices;
+
+    SuccessOrExit(error = AppendLeaseInfoTo(aFrameBuilder, aNow));
+    SuccessOrExit(error = aFrameBuilder.AppendUint8(mUseShortLeaseOption ? 1 : 0));
+    SuccessOrExit(error = aFrameBuilder.Append(mKey));
+
+    VerifyOrExit(mAddresses.GetLength() <= NumericLimits<uint8_t>::kMax, error = kErrorNoBufs);
+    SuccessOrExit(error = aFrameBuilder.AppendUint8(static_cast<uint8_t>(mAddresses.GetLength())));
+
+    for (const Ip6::Address &address : mAddresses)
+    {
+        SuccessOrExit(error = aFrameBuilder.Append(address));
+    }
+
+    numServices = mServices.CountAllEntries();
+    VerifyOrExit(numServices <= NumericLimits<uint8_t>::kMax, error = kErrorNoBufs);
+    SuccessOrExit(error = aFrameBuilder.AppendUint8(static_cast<uint8_t>(numServices)));
+
+    for (const Service &service : mServices)
+    {
+        SuccessOrExit(error = service.AppendTo(aFrameBuilder, aNow));
+    }
+
+exit:
+    return error;
+}
+
+Error Server::Host::ReadFrom(FrameData &aFrameData, TimeMilli aNow, bool &aIsExpired)
+{
+    // Services whose lease or key lease had expired when the entry
+    // was saved are not restored. `aIsExpired` is set if the host itself
+    // expired.
+
+    Error             error;
+    uint8_t           flags;
+    uint8_t           count;
+    Dns::Name::Buffer name;
+
+    SuccessOrExit(error = ReadLeaseInfoFrom(aFrameData, aNow, aIsExpired));
+    VerifyOrExit(!aIsExpired);
+
+    SuccessOrExit(error = aFrameData.ReadUint8(flags));
+    SetUseShortLeaseOption(flags != 0);
+    SuccessOrExit(error = aFrameData.Read(mKey));
+
+    SuccessOrExit(error = aFrameData.ReadUint8(count));
+
+    for (; count > 0; count--)
+    {
+        Ip6::Address address;
+
+        SuccessOrExit(error = aFrameData.Read(address));
+        SuccessOrExit(error = mAddresses.PushBack(address));
+    }
+
+    SuccessOrExit(error = aFrameData.ReadUint8(count));
+
+    for (; count > 0; count--)
+    {
+        Dns::Name::Buffer label;
+        Service          *service;
+        bool              isServiceExpired;
+
+        SuccessOrExit(error = ReadName(aFrameData, name));
+        SuccessOrExit(error = ReadName(aFrameData, label));
+        VerifyOrExit(!HasService(name), error = kErrorDuplicated);
+
+        service = AddNewService(name, label, aNow);
+        VerifyOrExit(service != nullptr, error = kErrorNoBufs);
+
+        SuccessOrExit(error = service->ReadFrom(aFrameData, aNow, isServiceExpired));
+
+        if (isServiceExpired)
+        {
+            IgnoreError(mServices.Remove(*service));
+            service->Free();
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error Server::Service::AppendTo(FrameBuilder &aFrameBuilder, TimeMilli aNow) const
+{
+    Error error;
+
+    SuccessOrExit(error = AppendName(aFrameBuilder, GetInstanceName()));
+    SuccessOrExit(error = AppendName(aFrameBuilder, GetInstanceLabel()));
+    SuccessOrExit(error = AppendLeaseInfoTo(aFrameBuilder, aNow));
+    SuccessOrExit(error = aFrameBuilder.AppendUint8(mIsDeleted ? 1 : 0));
+    SuccessOrExit(error = AppendName(aFrameBuilder, GetServiceName()));
+
+    VerifyOrExit(mSubTypes.GetLength() <= NumericLimits<uint8_t>::kMax, error = kErrorNoBufs);
+    SuccessOrExit(error = aFrameBuilder.AppendUint8(static_cast<uint8_t>(mSubTypes.GetLength())));
+
+    for (const Heap::String &subType : mSubTypes)
+    {
+        SuccessOrExit(error = AppendName(aFrameBuilder, subType.AsCString()));
+    }
+
+    SuccessOrExit(error = aFrameBuilder.AppendUint<kBigEndian>(mPriority));
+    SuccessOrExit(error = aFrameBuilder.AppendUint<kBigEndian>(mWeight));
+    SuccessOrExit(error = aFrameBuilder.AppendUint<kBigEndian>(mPort));
+    SuccessOrExit(error = aFrameBuilder.AppendUint<kBigEndian>(mTxtData.GetLength()));
+    error = aFrameBuilder.AppendBytes(mTxtData.GetBytes(), mTxtData.GetLength());
+
+exit:
+    return error;
+}
+
+Error Server::Service::ReadFrom(FrameData &aFrameData, TimeMilli aNow, bool &aIsExpired)
+{
+    // The instance name and label are read by `Host::ReadFrom()`
+    // to allocate and initialize the `Service`. The rest of the
+    // entry is read even when the service is expired so that the
+    // next service can be read.
+
+    Error             error;
+    uint8_t           flags;
+    uint8_t           count;
+    uint16_t          txtLength;
+    Dns::Name::Buffer name;
+
+    SuccessOrExit(error = ReadLeaseInfoFrom(aFrameData, aNow, aIsExpired));
+    SuccessOrExit(error = aFrameData.ReadUint8(flags));
+    mIsDeleted = (flags != 0);
+    SuccessOrExit(error = ReadName(aFrameData, name));
+    SuccessOrExit(error = SetServiceName(name));
+
+    SuccessOrExit(error = aFrameData.ReadUint8(count));
+
+    for (; count > 0; count--)
+    {
+        Heap::String *subType;
+
+        SuccessOrExit(error = ReadName(aFrameData, name));
+
+        subType = mSubTypes.PushBack();
+        VerifyOrExit(subType != nullptr, error = kErrorNoBufs);
+        SuccessOrExit(error = subType->Set(name));
+    }
+
+    SuccessOrExit(error = aFrameData.ReadUint<kBigEndian>(mPriority));
+    SuccessOrExit(error = aFrameData.ReadUint<kBigEndian>(mWeight));
+    SuccessOrExit(error = aFrameData.ReadUint<kBigEndian>(mPort));
+    SuccessOrExit(error = aFrameData.ReadUint<kBigEndian>(txtLength));
+    VerifyOrExit(aFrameData.CanRead(txtLength), error = kErrorParse);
+    SuccessOrExit(error = mTxtData.SetFrom(aFrameData.GetBytes(), txtLength));
+    aFrameData.SkipOver(txtLength);
+
+    mIsCommitted = true;
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// Server::LeaseQueue
+
+void Server::LeaseQueue::Add(Host &aHost)
+{
+    // Hosts are added after they are committed (with a newly granted
+    // lease) so their lease event time is very likely later than that
+    // of most other hosts. We search backward from the tail to find
+    // the position to insert `aHost`.
+
+    Host *prev;
+
+    aHost.mLeaseEventTime = aHost.DetermineLeaseEventTime();
+
+    for (prev = mTail; prev != nullptr; prev = prev->mPrevInLeaseQueue)
+    {
+        if (prev->mLeaseEventTime <= aHost.mLeaseEventTime)
+        {
+            break;
+        }
+    }
+
+    aHost.mPrevInLeaseQueue = prev;
+    aHost.mNextInLeaseQueue = (prev == nullptr) ? mHead : prev->mNextInLeaseQueue;
+
+    if (prev == nullptr)
+    {
+        mHead = &aHost;
+    }
+    else
+    {
+        prev->mNextInLeaseQueue = &aHost;
+    }
+
+    if (aHost.mNextInLeaseQueue == nullptr)
+    {
+        mTail = &aHost;
+    }
+    else
+    {
+        aHost.mNextInLeaseQueue->mPrevInLeaseQueue = &aHost;
+    }
+}
+
+void Server::LeaseQueue::Remove(Host &aHost)
+{
+    VerifyOrExit((aHost.mPrevInLeaseQueue != nullptr) || (mHead == &aHost));
+
+    if (aHost.mPrevInLeaseQueue == nullptr)
+    {
+        mHead = aHost.mNextInLeaseQueue;
+    }
+    else
+    {
+        aHost.mPrevInLeaseQueue->mNextInLeaseQueue = aHost.mNextInLeaseQueue;
+    }
+
+    if (aHost.mNextInLeaseQueue == nullptr)
+    {
+        mTail = aHost.mPrevInLeaseQueue;
+    }
+    else
+    {
+        aHost.mNextInLeaseQueue->mPrevInLeaseQueue = aHost.mPrevInLeaseQueue;
+    }
+
+    aHost.mPrevInLeaseQueue = nullptr;
+    aHost.mNextInLeaseQueue = nullptr;
+
+exit:
+    return;
+}
+
+void Server::LeaseQueue::Update(Host &aHost)
+{
+    Remove(aHost);
+    Add(aHost);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Server::NameHashTable
+
+template <typename EntryType, EntryType *EntryType::*kNextMember, uint32_t (EntryType::*kGetHash)(void) const>
+Server::NameHashTable<EntryType, kNextMember, kGetHash>::NameHashTable(void)
+    : mBuckets(mInitialBuckets)
+    , mNumBuckets(kInitialNumBuckets)
+    , mNumEntries(0)
+{
+    ClearAllBytes(mInitialBuckets);
+}
+
+template <typename EntryType, EntryType *EntryType::*kNextMember, uint32_t (EntryType::*kGetHash)(void) const>
+void Server::NameHashTable<EntryType, kNextMember, kGetHash>::Add(EntryType &aEntry)
+{
+    if (mNumEntries >= mNumBuckets)
+    {
+        Grow();
+    }
+
+    AddToBucket(aEntry);
+    mNumEntries++;
+}
+
+template <typename EntryType, EntryType *EntryType::*kNextMember, uint32_t (EntryType::*kGetHash)(void) const>
+void Server::NameHashTable<EntryType, kNextMember, kGetHash>::Remove(EntryType &aEntry)
+{
+    for (EntryType **link = &mBuckets[BucketFor((aEntry.*kGetHash)())]; *link != nullptr;
+         link             = &((*link)->*kNextMember))
+    {
+        if (*link == &aEntry)
+        {
+            *link               = aEntry.*kNextMember;
+            aEntry.*kNextMember = nullptr;
+            mNumEntries--;
+            break;
+        }
+    }
+}
+
+template <typename EntryType, EntryType *EntryType::*kNextMember, uint32_t (EntryType::*kGetHash)(void) const>
+void Server::NameHashTable<EntryType, kNextMember, kGetHash>::Clear(void)
+{
+    FreeBuckets();
+
+    mBuckets    = mInitialBuckets;
+    mNumBuckets = kInitialNumBuckets;
+    mNumEntries = 0;
+    ClearAllBytes(mInitialBuckets);
+}
+
+template <typename EntryType, EntryType *EntryType::*kNextMember, uint32_t (EntryType::*kGetHash)(void) const>
+void Server::NameHashTable<EntryType, kNextMember, kGetHash>::AddToBucket(EntryType &aEntry)
+{
+    EntryType *&head = mBuckets[BucketFor((aEntry.*kGetHash)())];
+
+    aEntry.*kNextMember = head;
+    head                = &aEntry;
+}
+
+template <typename EntryType, EntryType *EntryType::*kNextMember, uint32_t (EntryType::*kGetHash)(void) const>
+void Server::NameHashTable<EntryType, kNextMember, kGetHash>::Grow(void)
+{
+    // If a larger bucket array cannot be allocated, we keep using
+    // the current one with longer bucket lists.
+
+    EntryType **oldBuckets    = mBuckets;
+    uint32_t    oldNumBuckets = mNumBuckets;
+    EntryType **newBuckets;
+
+    VerifyOrExit(mNumBuckets < kMaxNumBuckets);
+
+    newBuckets = static_cast<EntryType **>(Heap::CAlloc(2 * mNumBuckets, sizeof(EntryType *)));
+    VerifyOrExit(newBuckets != nullptr);
+
+    mBuckets = newBuckets;
+    mNumBuckets *= 2;
+
+    for (uint32_t index = 0; index < oldNumBuckets; index++)
+    {
+        EntryType *entry = oldBuckets[index];
+
+        while (entry != nullptr)
+        {
+            EntryType *next = entry->*kNextMember;
+
+            AddToBucket(*entry);
+            entry = next;
+        }
+    }
+
+    if (oldBuckets != mInitialBuckets)
+    {
+        Heap::Free(oldBuckets);
+    }
+
+exit:
+    return;
+}
+
+template <typename EntryType, EntryType *EntryType::*kNextMember, uint32_t (EntryType::*kGetHash)(void) const>
+void Server::NameHashTable<EntryType, kNextMember, kGetHash>::FreeBuckets(void)
+{
+    if (mBuckets != mInitialBuckets)
+    {
+        Heap::Free(mBuckets);
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // Server::UpdateMetadata
 
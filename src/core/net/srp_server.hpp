@@ -57,6 +57,8 @@
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
 #include "common/clearable.hpp"
+#include "common/frame_builder.hpp"
+#include "common/frame_data.hpp"
 #include "common/heap.hpp"
 #include "common/heap_allocatable.hpp"
 #include "common/heap_array.hpp"
@@ -88,6 +90,8 @@ struct otSrpServerService
 
 namespace ot {
 
+class UnitTester;
+
 namespace Dns {
 namespace ServiceDiscovery {
 class Server;
@@ -119,6 +123,7 @@ class Server : public InstanceLocator, private NonCopyable
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     friend class BorderRouter::RoutingManager;
 #endif
+    friend class ot::UnitTester;
 
     enum RetainName : bool
     {
@@ -233,6 +238,10 @@ public:
         void  SetLease(uint32_t aLease) { mLease = aLease; }
         void  SetKeyLease(uint32_t aKeyLease) { mKeyLease = aKeyLease; }
         Error ProcessTtl(uint32_t aTtl);
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+        Error AppendLeaseInfoTo(FrameBuilder &aFrameBuilder, TimeMilli aNow) const;
+        Error ReadLeaseInfoFrom(FrameData &aFrameData, TimeMilli aNow, bool &aIsExpired);
+#endif
 
     private:
         uint32_t  mLease;
@@ -255,6 +264,7 @@ public:
         friend class LinkedListEntry<Service>;
         friend class Heap::Allocatable<Service>;
         friend class AdvertisingProxy;
+        friend class ot::UnitTester;
 
     public:
         /**
@@ -289,6 +299,26 @@ public:
          */
         const char *GetServiceName(void) const { return mServiceName.AsCString(); }
 
+        /**
+         * Gets the hash of the service instance name.
+         *
+         * The hash is calculated using `Dns::Name::CalculateHash()` and can be used to quickly rule out a match before
+         * comparing the full name.
+         *
+         * @returns The hash of the service instance name.
+         */
+        uint32_t GetInstanceNameHash(void) const { return mInstanceNameHash; }
+
+        /**
+         * Gets the hash of the full service name of the service.
+         *
+         * The hash is calculated using `Dns::Name::CalculateHash()` and can be used to quickly rule out a match before
+         * comparing the full name.
+         *
+         * @returns The hash of the service name.
+         */
+        uint32_t GetServiceNameHash(void) const { return mServiceNameHash; }
+
         /**
          * Gets number of sub-types of this service.
          *
@@ -409,8 +439,15 @@ public:
 
         Error Init(const char *aInstanceName, const char *aInstanceLabel, Host &aHost, TimeMilli aUpdateTime);
         Error SetTxtDataFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+        Error SetServiceName(const char *aServiceName);
         bool  Matches(const char *aInstanceName) const;
+        bool  Matches(const char *aInstanceName, uint32_t aInstanceNameHash) const;
+        bool  Matches(const Service &aService) const;
         void  Log(Action aAction) const;
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+        Error AppendTo(FrameBuilder &aFrameBuilder, TimeMilli aNow) const;
+        Error ReadFrom(FrameData &aFrameData, TimeMilli aNow, bool &aIsExpired);
+#endif
 
         template <uint16_t kLabelSize>
         static Error ParseSubTypeServiceName(const char *aSubTypeServiceName, char (&aLabel)[kLabelSize])
@@ -419,10 +456,14 @@ public:
         }
 
         Service                  *mNext;
+        Service                  *mNextInInstanceTable;
+        Service                  *mNextInServiceTable;
         Heap::String              mInstanceName;
         Heap::String              mInstanceLabel;
         Heap::String              mServiceName;
         Heap::Array<Heap::String> mSubTypes;
+        uint32_t                  mInstanceNameHash;
+        uint32_t                  mServiceNameHash;
         Host                     *mHost;
         Heap::Data                mTxtData;
         uint16_t                  mPriority;
@@ -455,9 +496,11 @@ public:
                  private NonCopyable
     {
         friend class Server;
+        friend class LinkedList<Host>;
         friend class LinkedListEntry<Host>;
         friend class Heap::Allocatable<Host>;
         friend class AdvertisingProxy;
+        friend class ot::UnitTester;
 
     public:
         typedef Crypto::Ecdsa::P256::PublicKey Key; ///< Host key (public ECDSA P256 key).
@@ -479,6 +522,16 @@ public:
          */
         const char *GetFullName(void) const { return mFullName.AsCString(); }
 
+        /**
+         * Returns the hash of the full name of the host.
+         *
+         * The hash is calculated using `Dns::Name::CalculateHash()` and can be used to quickly rule out a match before
+         * comparing the full name.
+         *
+         * @returns The hash of the host full name.
+         */
+        uint32_t GetFullNameHash(void) const { return mFullNameHash; }
+
         /**
          * Returns addresses of the host.
          *
@@ -530,6 +583,8 @@ public:
         ~Host(void);
 
         Error SetFullName(const char *aFullName);
+        bool  Matches(const char *aFullName, uint32_t aFullNameHash) const;
+        bool  Matches(const Host &aHost) const;
         void  SetUseShortLeaseOption(bool aUse) { mUseShortLeaseOption = aUse; }
         bool  ShouldUseShortLeaseOption(void) const { return mUseShortLeaseOption; }
 
@@ -537,19 +592,36 @@ public:
         void           AddService(Service &aService);
         void           RemoveService(Service *aService, RetainName aRetainName, NotifyMode aNotifyServiceHandler);
         bool           HasService(const char *aInstanceName) const;
+        bool           HasService(const Service &aService) const { return mServices.ContainsMatching(aService); }
         Service       *FindService(const char *aInstanceName);
         const Service *FindService(const char *aInstanceName) const;
+        Service       *FindService(const Service &aService) { return mServices.FindMatching(aService); }
+        const Service *FindService(const Service &aService) const { return mServices.FindMatching(aService); }
         void           FreeAllServices(void);
         void           ClearResources(void);
         Error          AddIp6Address(const Ip6::Address &aIp6Address);
+        TimeMilli      DetermineLeaseEventTime(void) const;
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+        Error AppendTo(FrameBuilder &aFrameBuilder, TimeMilli aNow) const;
+        Error ReadFrom(FrameData &aFrameData, TimeMilli aNow, bool &aIsExpired);
+#endif
 
         Host                     *mNext;
+        Host                     *mNextInNameTable;
+        Host                     *mPrevInLeaseQueue;
+        Host                     *mNextInLeaseQueue;
+        TimeMilli                 mLeaseEventTime;
         Heap::String              mFullName;
+        uint32_t                  mFullNameHash;
         Heap::Array<Ip6::Address> mAddresses;
         Key                       mKey;
         LinkedList<Service>       mServices;
         bool                      mParsedKey : 1;
         bool                      mUseShortLeaseOption : 1; // Use short lease option (lease only 4 bytes).
+        bool                      mIsInNameTables : 1;      // Host (and its services) are in server name tables.
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+        bool mShouldSave : 1; // Host is changed since it was last saved in `Settings`.
+#endif
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
         bool                  mIsRegistered : 1;
         bool                  mIsKeyRegistered : 1;
@@ -820,6 +892,28 @@ public:
      */
     const otSrpServerResponseCounters *GetResponseCounters(void) const { return &mResponseCounters; }
 
+    /**
+     * Represents the lease timer counters of the SRP server.
+     */
+    struct LeaseCounters : public Clearable<LeaseCounters>
+    {
+        uint32_t mTimerFires;     ///< Number of times the lease timer fired.
+        uint32_t mHostsProcessed; ///< Number of hosts (with an expired lease or key lease) processed by the timer.
+        uint32_t mExpirations;    ///< Number of host and service lease or key lease expirations.
+    };
+
+    /**
+     * Returns the lease timer counters of the SRP server.
+     *
+     * @returns The lease timer counters.
+     */
+    const LeaseCounters &GetLeaseCounters(void) const { return mLeaseCounters; }
+
+    /**
+     * Resets the lease timer counters of the SRP server.
+     */
+    void ResetLeaseCounters(void) { mLeaseCounters.Clear(); }
+
     /**
      * Receives the service update result from service handler set by
      * SetServiceHandler.
@@ -950,7 +1044,7 @@ private:
                           uint16_t          aSigOffset,
                           uint16_t          aSigRdataOffset,
                           uint16_t          aSigRdataLength,
-                          const char       *aSignerName) const;
+                          uint16_t          aSignerNameOffset) const;
     Error ProcessZoneSection(const Message &aMessage, MessageMetadata &aMetadata) const;
     Error ProcessHostDescriptionInstruction(Host                  &aHost,
                                             const Message         &aMessage,
@@ -984,11 +1078,113 @@ private:
 
     void UpdateResponseCounters(Dns::Header::Response aResponseCode);
     void UpdateAddrResolverCacheTable(const Ip6::MessageInfo &aMessageInfo, const Host &aHost);
+    void UpdateLeaseTimer(void);
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    static constexpr uint8_t  kPersistFormatVersion = 3;
+    static constexpr uint16_t kMaxPersistedHostSize = OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_MAX_HOST_SIZE;
+    static constexpr uint32_t kPersistSaveDelay     = OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_SAVE_DELAY;
+
+    void         SchedulePersist(void);
+    void         SchedulePersist(Host &aHost);
+    void         HandlePersistTimer(void) { SaveHosts(); }
+    void         SaveHosts(void);
+    Error        SaveHost(const Host &aHost, uint8_t *aBuffer, TimeMilli aNow);
+    void         ClearSavedHosts(void);
+    void         RestoreHosts(void);
+    Error        RestoreHost(FrameData &aFrameData, TimeMilli aNow);
+    static Error AppendName(FrameBuilder &aFrameBuilder, const char *aName);
+    static Error ReadName(FrameData &aFrameData, Dns::Name::Buffer &aName);
+#endif
+
+    template <typename EntryType, EntryType *EntryType::*kNextMember, uint32_t (EntryType::*kGetHash)(void) const>
+    class NameHashTable
+    {
+        // Keeps the committed hosts (or their services) in buckets
+        // indexed by a name hash, where each bucket is a list linked
+        // through `kNextMember`. The bucket array is doubled (when it
+        // can be allocated) as entries are added so that the average
+        // bucket length stays at or below one.
+
+    public:
+        NameHashTable(void);
+        ~NameHashTable(void) { FreeBuckets(); }
+
+        void Add(EntryType &aEntry);
+        void Remove(EntryType &aEntry);
+        void Clear(void);
+
+        const EntryType *FindNext(uint32_t aHash, const EntryType *aPrevEntry) const
+        {
+            const EntryType *entry = (aPrevEntry == nullptr) ? mBuckets[BucketFor(aHash)] : aPrevEntry->*kNextMember;
+
+            while ((entry != nullptr) && ((entry->*kGetHash)() != aHash))
+            {
+                entry = entry->*kNextMember;
+            }
+
+            return entry;
+        }
+
+    private:
+        static constexpr uint32_t kInitialNumBuckets = 16;
+        static constexpr uint32_t kMaxNumBuckets     = 1u << 16;
+
+        uint32_t BucketFor(uint32_t aHash) const { return aHash & (mNumBuckets - 1); }
+        void     AddToBucket(EntryType &aEntry);
+        void     Grow(void);
+        void     FreeBuckets(void);
+
+        EntryType **mBuckets;
+        uint32_t    mNumBuckets;
+        uint32_t    mNumEntries;
+        EntryType  *mInitialBuckets[kInitialNumBuckets];
+    };
+
+    using HostNameTable     = NameHashTable<Host, &Host::mNextInNameTable, &Host::GetFullNameHash>;
+    using InstanceNameTable = NameHashTable<Service, &Service::mNextInInstanceTable, &Service::GetInstanceNameHash>;
+    using ServiceNameTable  = NameHashTable<Service, &Service::mNextInServiceTable, &Service::GetServiceNameHash>;
+
+    void        AddCommittedHost(Host &aHost);
+    void        RemoveCommittedHost(Host &aHost);
+    void        HandleHostsChange(void);
+    void        AddToNameTables(Service &aService);
+    void        RemoveFromNameTables(Service &aService);
+    Host       *FindHost(const Host &aHost) { return AsNonConst(AsConst(this)->FindHost(aHost)); }
+    const Host *FindHost(const Host &aHost) const { return FindHost(aHost.GetFullName(), aHost.mFullNameHash); }
+    const Host *FindHost(const char *aFullName, uint32_t aFullNameHash) const;
+
+    class LeaseQueue
+    {
+        // Keeps the committed hosts sorted by their lease event time,
+        // i.e., the earliest time the lease or key lease of the host
+        // or any of its services expires, so that the lease timer
+        // only needs to process the hosts at the head of the queue.
+
+    public:
+        LeaseQueue(void)
+            : mHead(nullptr)
+            , mTail(nullptr)
+        {
+        }
+
+        Host *GetHead(void) { return mHead; }
+        void  Add(Host &aHost);
+        void  Remove(Host &aHost);
+        void  Update(Host &aHost);
+
+    private:
+        Host *mHead;
+        Host *mTail;
+    };
 
     using LeaseTimer           = TimerMilliIn<Server, &Server::HandleLeaseTimer>;
     using UpdateTimer          = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
     using CompletedUpdatesTask = TaskletIn<Server, &Server::ProcessCompletedUpdates>;
     using ServerSocket         = Ip6::Udp::SocketIn<Server, &Server::HandleUdpReceive>;
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    using PersistTimer = TimerMilliIn<Server, &Server::HandlePersistTimer>;
+#endif
 
     ServerSocket mSocket;
 
@@ -999,8 +1195,15 @@ private:
     TtlConfig   mTtlConfig;
     LeaseConfig mLeaseConfig;
 
-    LinkedList<Host> mHosts;
-    LeaseTimer       mLeaseTimer;
+    LinkedList<Host>  mHosts;
+    HostNameTable     mHostNameTable;
+    InstanceNameTable mInstanceNameTable;
+    ServiceNameTable  mServiceNameTable;
+    LeaseQueue        mLeaseQueue;
+    LeaseTimer        mLeaseTimer;
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    PersistTimer mPersistTimer;
+#endif
 
     UpdateTimer                mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
@@ -1016,6 +1219,9 @@ private:
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     bool mAutoEnable : 1;
 #endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    bool mHasRestoredHosts : 1;
+#endif
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     bool        mFastStartMode : 1;
@@ -1023,6 +1229,7 @@ private:
 #endif
 
     otSrpServerResponseCounters mResponseCounters;
+    LeaseCounters               mLeaseCounters;
 };
 
 } // namespace Srp
@@ -60,8 +60,12 @@ Tcp::Tcp(Instance &aInstance)
     , mTimer(aInstance)
     , mTasklet(aInstance)
     , mEphemeralPort(kDynamicPortMin)
+    , mDelayedAckTimeout(OPENTHREAD_CONFIG_TCP_DELAYED_ACK_TIMEOUT)
+    , mAckThinningSegments(OPENTHREAD_CONFIG_TCP_ACK_THINNING_SEGMENTS)
+    , mSackEnabled(OPENTHREAD_CONFIG_TCP_SACK_ENABLE)
 {
     OT_UNUSED_VARIABLE(mEphemeralPort);
+    ClearAllBytes(mEndpointBuckets);
 }
 
 Error Tcp::Endpoint::Initialize(Instance &aInstance, const otTcpEndpointInitializeArgs &aArgs)
@@ -73,6 +77,8 @@ Error Tcp::Endpoint::Initialize(Instance &aInstance, const otTcpEndpointInitiali
 
     SuccessOrExit(error = aInstance.Get<Tcp>().mEndpoints.Add(*this));
 
+    mNextInBucket             = nullptr;
+    mBucket                   = kNoBucket;
     mContext                  = aArgs.mContext;
     mEstablishedCallback      = aArgs.mEstablishedCallback;
     mSendDoneCallback         = aArgs.mSendDoneCallback;
@@ -98,13 +104,13 @@ Error Tcp::Endpoint::Initialize(Instance &aInstance, const otTcpEndpointInitiali
         bmp_init(tp.reassbmp, BITS_TO_BYTES(recvbuflen));
     }
 
+    /* The instance is set first since initialize_tcb() queries it for the SACK setting. */
+    tp.instance      = &aInstance;
     tp.accepted_from = nullptr;
     initialize_tcb(&tp);
 
     /* Note that we do not need to zero-initialize mReceiveLinks. */
 
-    tp.instance = &aInstance;
-
 exit:
     return error;
 }
@@ -138,6 +144,8 @@ const SockAddr &Tcp::Endpoint::GetPeerAddress(void) const
     return AsCoreType(&temp);
 }
 
+uint16_t Tcp::Endpoint::GetMaxSegmentSize(void) const { return static_cast<uint16_t>(GetTcb().t_maxseg); }
+
 Error Tcp::Endpoint::Bind(const SockAddr &aSockName)
 {
     Error         error;
@@ -299,6 +307,7 @@ Error Tcp::Endpoint::Deinitialize(void)
 
     SuccessOrExit(error = Get<Tcp>().mEndpoints.Remove(*this));
     SetNext(nullptr);
+    Get<Tcp>().RemoveFromBucket(*this);
 
     SuccessOrExit(error = Abort());
 
@@ -658,7 +667,7 @@ Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, Message
     aMessageInfo.mPeerPort = BigEndian::HostSwap16(tcpHeader->th_sport);
     aMessageInfo.mSockPort = BigEndian::HostSwap16(tcpHeader->th_dport);
 
-    endpoint = mEndpoints.FindMatching(aMessageInfo);
+    endpoint = FindEndpoint(aMessageInfo);
 
     if (endpoint != nullptr)
     {
@@ -688,6 +697,9 @@ Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, Message
         OT_ASSERT(nextAction != RELOOKUP_REQUIRED);
         if (sig.accepted_connection != nullptr)
         {
+            // The 4-tuple of an accepted endpoint is set after its state
+            // changes, so it is added to its bucket here.
+            UpdateBucket(Tcp::Endpoint::FromTcb(*sig.accepted_connection));
             ProcessSignals(Tcp::Endpoint::FromTcb(*sig.accepted_connection), nullptr, 0, sig);
         }
         ExitNow();
@@ -700,6 +712,95 @@ exit:
     return error;
 }
 
+uint16_t Tcp::BucketFor(uint16_t aLocalPort, uint16_t aPeerPort, const Address &aPeerAddress)
+{
+    // The local address is not included since it is mostly the same
+    // for all connections.
+
+    uint16_t hash = aLocalPort ^ aPeerPort;
+
+    for (uint16_t word : aPeerAddress.mFields.m16)
+    {
+        hash ^= word;
+    }
+
+    hash ^= (hash >> 8);
+
+    return hash & (kNumEndpointBuckets - 1);
+}
+
+Tcp::Endpoint *Tcp::FindEndpoint(const MessageInfo &aMessageInfo)
+{
+    uint16_t  bucket = BucketFor(aMessageInfo.GetSockPort(), aMessageInfo.GetPeerPort(), aMessageInfo.GetPeerAddr());
+    Endpoint *endpoint;
+
+    for (endpoint = mEndpointBuckets[bucket]; endpoint != nullptr; endpoint = endpoint->GetNextInBucket())
+    {
+        if (endpoint->Matches(aMessageInfo))
+        {
+            break;
+        }
+    }
+
+    return endpoint;
+}
+
+void Tcp::UpdateBucket(Endpoint &aEndpoint)
+{
+    const struct tcpcb &tp = aEndpoint.GetTcb();
+    uint16_t            bucket;
+
+    if (tp.t_state == TCP6S_CLOSED)
+    {
+        RemoveFromBucket(aEndpoint);
+        ExitNow();
+    }
+
+    bucket = BucketFor(BigEndian::HostSwap16(tp.lport), BigEndian::HostSwap16(tp.fport),
+                       aEndpoint.GetForeignIp6Address());
+    VerifyOrExit(bucket != aEndpoint.GetBucket());
+
+    RemoveFromBucket(aEndpoint);
+    aEndpoint.SetNextInBucket(mEndpointBuckets[bucket]);
+    aEndpoint.SetBucket(bucket);
+    mEndpointBuckets[bucket] = &aEndpoint;
+
+exit:
+    return;
+}
+
+void Tcp::RemoveFromBucket(Endpoint &aEndpoint)
+{
+    Endpoint *prev = nullptr;
+    Endpoint *endpoint;
+
+    VerifyOrExit(aEndpoint.GetBucket() != kNoBucket);
+
+    endpoint = mEndpointBuckets[aEndpoint.GetBucket()];
+
+    while (endpoint != &aEndpoint)
+    {
+        OT_ASSERT(endpoint != nullptr);
+        prev     = endpoint;
+        endpoint = endpoint->GetNextInBucket();
+    }
+
+    if (prev == nullptr)
+    {
+        mEndpointBuckets[aEndpoint.GetBucket()] = aEndpoint.GetNextInBucket();
+    }
+    else
+    {
+        prev->SetNextInBucket(aEndpoint.GetNextInBucket());
+    }
+
+    aEndpoint.SetNextInBucket(nullptr);
+    aEndpoint.SetBucket(kNoBucket);
+
+exit:
+    return;
+}
+
 void Tcp::ProcessSignals(Endpoint             &aEndpoint,
                          otLinkedBuffer       *aPriorHead,
                          size_t                aPriorBacklog,
@@ -1100,9 +1201,12 @@ void tcplp_sys_connection_lost(struct tcpcb *aTcb, uint8_t aErrNum)
 
 void tcplp_sys_on_state_change(struct tcpcb *aTcb, int aNewState)
 {
-    OT_UNUSED_VARIABLE(aTcb);
+    Tcp::Endpoint &endpoint = Tcp::Endpoint::FromTcb(*aTcb);
+
     OT_UNUSED_VARIABLE(aNewState);
 
+    endpoint.Get<Tcp>().UpdateBucket(endpoint);
+
     /* Any adaptive changes to the sleep interval would go here. */
 }
 
@@ -1149,6 +1253,18 @@ uint32_t tcplp_sys_generate_isn()
     return isn;
 }
 
+bool tcplp_sys_sack_enabled(otInstance *aInstance) { return AsCoreType(aInstance).Get<Tcp>().IsSackEnabled(); }
+
+uint32_t tcplp_sys_get_delack_time(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Tcp>().GetDelayedAckTimeout();
+}
+
+uint8_t tcplp_sys_get_ack_thinning(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Tcp>().GetAckThinningSegments();
+}
+
 uint16_t tcplp_sys_hostswap16(uint16_t aHostPort) { return BigEndian::HostSwap16(aHostPort); }
 
 uint32_t tcplp_sys_hostswap32(uint32_t aHostPort) { return BigEndian::HostSwap32(aHostPort); }
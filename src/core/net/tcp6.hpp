@@ -45,6 +45,7 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/num_utils.hpp"
 #include "common/timer.hpp"
 #include "net/ip6_headers.hpp"
 #include "net/socket.hpp"
@@ -68,6 +69,8 @@ void tcplp_sys_set_timer(struct tcpcb *aTcb, uint8_t aTimerFlag, uint32_t aDelay
 
 // NOLINTNEXTLINE(readability-inconsistent-declaration-parameter-name)
 void tcplp_sys_stop_timer(struct tcpcb *aTcb, uint8_t aTimerFlag);
+
+void tcplp_sys_on_state_change(struct tcpcb *aTcb, int aNewState);
 }
 
 namespace ot {
@@ -160,6 +163,17 @@ public:
          */
         const SockAddr &GetPeerAddress(void) const;
 
+        /**
+         * Gets the maximum segment size (MSS) of this Endpoint's connection.
+         *
+         * A full-sized segment (including the IPv6 and TCP headers but excluding the
+         * TCP options) is sized to fit a whole number of IEEE 802.15.4 frames after
+         * 6LoWPAN compression and fragmentation.
+         *
+         * @returns  The maximum number of payload bytes (including TCP options) per segment.
+         */
+        uint16_t GetMaxSegmentSize(void) const;
+
         /**
          * Binds the TCP endpoint to an IP address and port.
          *
@@ -370,6 +384,12 @@ public:
 
         static uint8_t TimerFlagToIndex(uint8_t aTimerFlag);
 
+        Endpoint       *GetNextInBucket(void) { return static_cast<Endpoint *>(mNextInBucket); }
+        const Endpoint *GetNextInBucket(void) const { return static_cast<const Endpoint *>(mNextInBucket); }
+        void            SetNextInBucket(Endpoint *aEndpoint) { mNextInBucket = aEndpoint; }
+        uint16_t        GetBucket(void) const { return mBucket; }
+        void            SetBucket(uint16_t aBucket) { mBucket = aBucket; }
+
         bool IsTimerActive(uint8_t aTimerIndex);
         void SetTimer(uint8_t aTimerFlag, uint32_t aDelay);
         void CancelTimer(uint8_t aTimerFlag);
@@ -552,18 +572,94 @@ public:
      */
     bool IsInitialized(const Listener &aListener) const { return mListeners.Contains(aListener); }
 
+    /**
+     * Indicates whether selective acknowledgments (SACK) are negotiated on new connections.
+     *
+     * @retval TRUE   SACK is offered and accepted on new connections.
+     * @retval FALSE  SACK is not used on new connections.
+     */
+    bool IsSackEnabled(void) const { return mSackEnabled; }
+
+    /**
+     * Enables or disables selective acknowledgments (SACK) on new connections.
+     *
+     * Connections that are already established are not affected.
+     *
+     * @param[in] aEnabled  TRUE to enable SACK, FALSE to disable it.
+     */
+    void SetSackEnabled(bool aEnabled) { mSackEnabled = aEnabled; }
+
+    /**
+     * Gets the maximum time an ACK for received in-order data is delayed.
+     *
+     * @returns The delayed ACK timeout in milliseconds. Zero indicates delayed ACKs are disabled.
+     */
+    uint16_t GetDelayedAckTimeout(void) const { return mDelayedAckTimeout; }
+
+    /**
+     * Sets the maximum time an ACK for received in-order data is delayed.
+     *
+     * @param[in] aTimeout  The delayed ACK timeout in milliseconds. Zero disables delayed ACKs.
+     */
+    void SetDelayedAckTimeout(uint16_t aTimeout) { mDelayedAckTimeout = aTimeout; }
+
+    /**
+     * Gets the number of in-order segments received before an ACK is sent immediately.
+     *
+     * @returns The ACK thinning number of segments.
+     */
+    uint8_t GetAckThinningSegments(void) const { return mAckThinningSegments; }
+
+    /**
+     * Sets the number of in-order segments received before an ACK is sent immediately.
+     *
+     * A value of 2 acknowledges every second segment (RFC 5681). Larger values send fewer ACKs, which reduces
+     * contention with data segments on half-duplex radio links. Until that many segments are received, the ACK is
+     * still sent when the delayed ACK timeout expires.
+     *
+     * @param[in] aSegments  The number of segments. Zero is treated as one (acknowledge every segment).
+     */
+    void SetAckThinningSegments(uint8_t aSegments) { mAckThinningSegments = Max<uint8_t>(aSegments, 1); }
+
 private:
+    friend void ::tcplp_sys_on_state_change(struct tcpcb *aTcb, int aNewState);
+
     static constexpr uint16_t kDynamicPortMin = 49152;
     static constexpr uint16_t kDynamicPortMax = 65535;
 
+    static_assert(OPENTHREAD_CONFIG_TCP_ACK_THINNING_SEGMENTS >= 1,
+                  "OPENTHREAD_CONFIG_TCP_ACK_THINNING_SEGMENTS MUST be at least 1");
+
     static constexpr uint8_t kEstablishedCallbackFlag      = (1 << 0);
     static constexpr uint8_t kSendDoneCallbackFlag         = (1 << 1);
     static constexpr uint8_t kForwardProgressCallbackFlag  = (1 << 2);
     static constexpr uint8_t kReceiveAvailableCallbackFlag = (1 << 3);
     static constexpr uint8_t kDisconnectedCallbackFlag     = (1 << 4);
 
+    // Endpoints are also kept in a hash table keyed by the connection
+    // 4-tuple, where each bucket is a list (`mNextInBucket`). Only a
+    // non-closed endpoint can match a received segment, and its
+    // 4-tuple does not change until it is closed again. An endpoint
+    // is added to the bucket of its 4-tuple when it leaves the closed
+    // state (on connect or accept) and is removed when it returns to
+    // it. The bucket index is stored in the endpoint (`mBucket`) so it
+    // can be removed without searching other buckets.
+
+    static constexpr uint16_t kNumEndpointBuckets = OPENTHREAD_CONFIG_TCP_ENDPOINT_HASH_TABLE_SIZE;
+
+    static_assert(kNumEndpointBuckets > 0 && (kNumEndpointBuckets & (kNumEndpointBuckets - 1)) == 0,
+                  "OPENTHREAD_CONFIG_TCP_ENDPOINT_HASH_TABLE_SIZE MUST be a power of two");
+
     typedef TcpHeader Header;
 
+    static constexpr uint16_t kNoBucket = kNumEndpointBuckets;
+
+    static uint16_t BucketFor(uint16_t aLocalPort, uint16_t aPeerPort, const Address &aPeerAddress);
+
+    Endpoint *FindEndpoint(const MessageInfo &aMessageInfo);
+    void      UpdateBucket(Endpoint &aEndpoint);
+    void      RemoveFromBucket(Endpoint &aEndpoint);
+
     void ProcessSignals(Endpoint             &aEndpoint,
                         otLinkedBuffer       *aPriorHead,
                         size_t                aPriorBacklog,
@@ -585,6 +681,10 @@ private:
     LinkedList<Endpoint> mEndpoints;
     LinkedList<Listener> mListeners;
     uint16_t             mEphemeralPort;
+    uint16_t             mDelayedAckTimeout;
+    uint8_t              mAckThinningSegments;
+    bool                 mSackEnabled;
+    Endpoint            *mEndpointBuckets[kNumEndpointBuckets];
 };
 
 } // namespace Ip6
@@ -200,6 +200,7 @@ Udp::Udp(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEphemeralPort(kDynamicPortMin)
 {
+    ClearAllBytes(mSocketBuckets);
 }
 
 Error Udp::AddReceiver(Receiver &aReceiver) { return mReceivers.Add(aReceiver); }
@@ -244,6 +245,12 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr)
 {
     Error error = kErrorNone;
 
+    // The socket is re-added to the hash table (under its new port)
+    // on exit, even on failure since the local socket address may
+    // have already been updated.
+
+    RemoveFromBucket(aSocket);
+
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     SuccessOrExit(error = Plat::BindToNetif(aSocket));
 #endif
@@ -272,6 +279,11 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr)
 #endif
 
 exit:
+    if (aSocket.IsBound() && IsOpen(aSocket))
+    {
+        AddToBucket(aSocket);
+    }
+
     return error;
 }
 
@@ -373,6 +385,8 @@ void Udp::RemoveSocket(SocketHandle &aSocket)
 {
     SocketHandle *prev;
 
+    RemoveFromBucket(aSocket);
+
     SuccessOrExit(mSockets.Find(aSocket, prev));
 
     mSockets.PopAfter(prev);
@@ -382,20 +396,130 @@ exit:
     return;
 }
 
-uint16_t Udp::GetEphemeralPort(void)
+uint16_t Udp::BucketFor(uint16_t aPort) { return (aPort ^ (aPort >> 8)) & (kNumSocketBuckets - 1); }
+
+void Udp::AddToBucket(SocketHandle &aSocket)
 {
-    do
+    // Sockets in a bucket are kept in the same relative order as in
+    // `mSockets` (most recently opened first), so the first matching
+    // socket in the bucket is the same one a scan of `mSockets` would
+    // find. The next socket is the first one opened before `aSocket`
+    // (i.e., after it in `mSockets`) which is in the same bucket.
+
+    uint16_t      bucket = BucketFor(aSocket.GetSockName().mPort);
+    SocketHandle *next   = nullptr;
+    SocketHandle *prev   = nullptr;
+
+    for (SocketHandle *socket = aSocket.GetNext(); socket != nullptr; socket = socket->GetNext())
     {
-        if (mEphemeralPort < kDynamicPortMax)
+        if (socket->IsBound() && (BucketFor(socket->GetSockName().mPort) == bucket))
         {
-            mEphemeralPort++;
+            next = socket;
+            break;
         }
-        else
+    }
+
+    for (SocketHandle *socket = mSocketBuckets[bucket]; socket != next; socket = socket->GetNextInBucket())
+    {
+        OT_ASSERT(socket != nullptr);
+        prev = socket;
+    }
+
+    aSocket.SetNextInBucket(next);
+
+    if (prev == nullptr)
+    {
+        mSocketBuckets[bucket] = &aSocket;
+    }
+    else
+    {
+        prev->SetNextInBucket(&aSocket);
+    }
+}
+
+void Udp::RemoveFromBucket(SocketHandle &aSocket)
+{
+    uint16_t      bucket = BucketFor(aSocket.GetSockName().mPort);
+    SocketHandle *prev   = nullptr;
+
+    for (SocketHandle *socket = mSocketBuckets[bucket]; socket != nullptr; socket = socket->GetNextInBucket())
+    {
+        if (socket == &aSocket)
         {
-            mEphemeralPort = kDynamicPortMin;
+            if (prev == nullptr)
+            {
+                mSocketBuckets[bucket] = aSocket.GetNextInBucket();
+            }
+            else
+            {
+                prev->SetNextInBucket(aSocket.GetNextInBucket());
+            }
+
+            aSocket.SetNextInBucket(nullptr);
+            break;
         }
+
+        prev = socket;
+    }
+}
+
+Udp::SocketHandle *Udp::FindSocket(const MessageInfo &aMessageInfo)
+{
+    SocketHandle *socket;
+
+    if (aMessageInfo.GetSockPort() == 0)
+    {
+        // Only unbound sockets, which are not in the hash table,
+        // can match a zero port.
+        ExitNow(socket = mSockets.FindMatching(aMessageInfo));
+    }
+
+    for (socket = mSocketBuckets[BucketFor(aMessageInfo.GetSockPort())]; socket != nullptr;
+         socket = socket->GetNextInBucket())
+    {
+        if (socket->Matches(aMessageInfo))
+        {
+            break;
+        }
+    }
+
+exit:
+    return socket;
+}
+
+void Udp::AdvanceEphemeralPort(void)
+{
+    if (mEphemeralPort < kDynamicPortMax)
+    {
+        mEphemeralPort++;
+    }
+    else
+    {
+        mEphemeralPort = kDynamicPortMin;
+    }
+}
+
+uint16_t Udp::GetEphemeralPort(void)
+{
+    // Skip the ports used by open sockets (checked using the hash
+    // table) unless all ports in the dynamic range are in use.
+
+    for (uint32_t numPorts = kDynamicPortMax - kDynamicPortMin + 1; numPorts > 0; numPorts--)
+    {
+        AdvanceEphemeralPort();
+
+        if (!IsPortReserved(mEphemeralPort) && !IsPortInUse(mEphemeralPort))
+        {
+            ExitNow();
+        }
+    }
+
+    do
+    {
+        AdvanceEphemeralPort();
     } while (IsPortReserved(mEphemeralPort));
 
+exit:
     return mEphemeralPort;
 }
 
@@ -459,7 +583,7 @@ void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
     SocketHandle *socket;
 
-    socket = mSockets.FindMatching(aMessageInfo);
+    socket = FindSocket(aMessageInfo);
     VerifyOrExit(socket != nullptr);
 
     aMessage.RemoveHeader(aMessage.GetOffset());
@@ -470,7 +594,24 @@ exit:
     return;
 }
 
-bool Udp::IsPortInUse(uint16_t aPort) const { return mSockets.ContainsMatching(aPort); }
+bool Udp::IsPortInUse(uint16_t aPort) const
+{
+    bool isInUse = false;
+
+    VerifyOrExit(aPort != 0, isInUse = mSockets.ContainsMatching(aPort));
+
+    for (const SocketHandle *socket = mSocketBuckets[BucketFor(aPort)]; socket != nullptr;
+         socket = socket->GetNextInBucket())
+    {
+        if (socket->Matches(aPort))
+        {
+            ExitNow(isInUse = true);
+        }
+    }
+
+exit:
+    return isInUse;
+}
 
 } // namespace Ip6
 } // namespace ot
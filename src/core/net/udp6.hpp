@@ -166,6 +166,10 @@ public:
         bool Matches(uint16_t aSockPort) const { return GetSockName().GetPort() == aSockPort; }
         bool Matches(const MessageInfo &aMessageInfo) const;
 
+        SocketHandle       *GetNextInBucket(void) { return static_cast<SocketHandle *>(mNextInBucket); }
+        const SocketHandle *GetNextInBucket(void) const { return static_cast<const SocketHandle *>(mNextInBucket); }
+        void                SetNextInBucket(SocketHandle *aSocket) { mNextInBucket = aSocket; }
+
         void HandleUdpReceive(Message &aMessage, const MessageInfo &aMessageInfo)
         {
             mHandler(mContext, &aMessage, &aMessageInfo);
@@ -534,6 +538,14 @@ private:
     static constexpr uint16_t kSrpServerPortMin = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MIN;
     static constexpr uint16_t kSrpServerPortMax = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MAX;
 
+    // Open and bound sockets are also kept in a hash table keyed by
+    // the local port, where each bucket is a list (`mNextInBucket`).
+
+    static constexpr uint16_t kNumSocketBuckets = OPENTHREAD_CONFIG_UDP_SOCKET_HASH_TABLE_SIZE;
+
+    static_assert(kNumSocketBuckets > 0 && (kNumSocketBuckets & (kNumSocketBuckets - 1)) == 0,
+                  "OPENTHREAD_CONFIG_UDP_SOCKET_HASH_TABLE_SIZE MUST be a power of two");
+
     typedef UdpHeader Header;
 
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
@@ -550,14 +562,20 @@ private:
     };
 #endif
 
-    static bool IsPortReserved(uint16_t aPort);
+    static bool     IsPortReserved(uint16_t aPort);
+    static uint16_t BucketFor(uint16_t aPort);
 
-    void AddSocket(SocketHandle &aSocket);
-    void RemoveSocket(SocketHandle &aSocket);
+    void          AddSocket(SocketHandle &aSocket);
+    void          RemoveSocket(SocketHandle &aSocket);
+    void          AddToBucket(SocketHandle &aSocket);
+    void          RemoveFromBucket(SocketHandle &aSocket);
+    SocketHandle *FindSocket(const MessageInfo &aMessageInfo);
+    void          AdvanceEphemeralPort(void);
 
     uint16_t                 mEphemeralPort;
     LinkedList<Receiver>     mReceivers;
     LinkedList<SocketHandle> mSockets;
+    SocketHandle            *mSocketBuckets[kNumSocketBuckets];
 #if OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE
     Callback<otUdpForwarder> mUdpForwarder;
 #endif
@@ -63,6 +63,9 @@ void Context::InitFrom(const NetworkData::PrefixTlv &aPrefixTlv, const NetworkDa
 Lowpan::Lowpan(Instance &aInstance)
     : InstanceLocator(aInstance)
 {
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+    mFlowCache.Clear();
+#endif
 }
 
 void Lowpan::Compressor::FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext) const
@@ -215,12 +218,96 @@ Error Lowpan::Compress(Message &aMessage, const Mac::Addresses &aMacAddrs, Frame
 
 Error Lowpan::Compressor::Compress(void)
 {
-    Error   error       = kErrorNone;
-    uint8_t headerDepth = 0xff;
+    Error error;
 
     mRecursionDepth++;
     VerifyOrExit(mRecursionDepth <= kMaxRecursionDepth, error = kErrorParse);
 
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+    if (mRecursionDepth == 1)
+    {
+        ExitNow(error = CompressUsingFlowCache());
+    }
+#endif
+
+    error = CompressHeaders();
+
+exit:
+    mRecursionDepth--;
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+
+Error Lowpan::Compressor::CompressUsingFlowCache(void)
+{
+    // Compresses the headers using a matching `FlowCache` entry if
+    // the message is a UDP datagram without extension headers.
+    // Otherwise, uses `CompressHeaders()` and adds the result to
+    // `FlowCache` when applicable.
+
+    static constexpr uint16_t kHeadersSize = sizeof(Ip6::Header) + sizeof(Ip6::UdpHeader);
+
+    Error          error;
+    FlowCache     &flowCache   = Get<Lowpan>().mFlowCache;
+    uint16_t       startOffset = mMessage.GetOffset();
+    uint16_t       startLength = mFrameBuilder.GetLength();
+    bool           isUdp;
+    Ip6::Header    ip6Header;
+    Ip6::UdpHeader udpHeader;
+    const uint8_t *header;
+    uint8_t        headerLength;
+
+    isUdp = (mMessage.Read(startOffset, ip6Header) == kErrorNone) && (ip6Header.GetNextHeader() == Ip6::kProtoUdp) &&
+            (mMessage.Read(startOffset + sizeof(Ip6::Header), udpHeader) == kErrorNone);
+
+    if (isUdp && ((header = flowCache.FindCompressed(ip6Header, udpHeader, mMacAddrs, headerLength)) != nullptr))
+    {
+        FrameBuilder frameBuilder = mFrameBuilder;
+
+        error = mFrameBuilder.AppendBytes(header, headerLength);
+
+        if (error == kErrorNone)
+        {
+            error = mFrameBuilder.AppendUint<kBigEndian>(udpHeader.GetChecksum());
+        }
+
+        if (error == kErrorNone)
+        {
+            mMessage.MoveOffset(kHeadersSize);
+            ExitNow();
+        }
+
+        // On failure (not enough space in `mFrameBuilder`), we
+        // restore the `mFrameBuilder` and use `CompressHeaders()`
+        // which can fall back to less compression of headers.
+
+        mFrameBuilder = frameBuilder;
+    }
+
+    SuccessOrExit(error = CompressHeaders());
+
+    // Add the compressed headers (excluding the UDP checksum) to
+    // `FlowCache` only if both the IPv6 and UDP headers were
+    // compressed.
+
+    if (isUdp && (mMessage.GetOffset() == startOffset + kHeadersSize))
+    {
+        flowCache.AddCompressed(ip6Header, udpHeader, mMacAddrs, mFrameBuilder.GetBytes() + startLength,
+                                mFrameBuilder.GetLength() - startLength - sizeof(uint16_t));
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+
+Error Lowpan::Compressor::CompressHeaders(void)
+{
+    Error   error       = kErrorNone;
+    uint8_t headerDepth = 0xff;
+
     while (headerDepth > 0)
     {
         FrameBuilder frameBuilder = mFrameBuilder;
@@ -237,7 +324,6 @@ Error Lowpan::Compressor::Compress(void)
     }
 
 exit:
-    mRecursionDepth--;
     return error;
 }
 
@@ -605,6 +691,47 @@ Error Lowpan::DecompressBaseHeader(Ip6::Header          &aIp6Header,
 }
 
 Error Lowpan::HeaderDecompressor::DecompressBaseHeader(Ip6::Header &aIp6Header, bool &aCompressedNextHeader)
+{
+    Error   error = kErrorParse;
+    uint8_t nextHeader;
+
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+    FlowCache                        &flowCache = Get<Lowpan>().mFlowCache;
+    const FlowCache::DecompressEntry *entry     = flowCache.FindDecompressed(mMacAddrs, mFrameData);
+
+    if (entry != nullptr)
+    {
+        aIp6Header            = entry->mIp6Header;
+        aCompressedNextHeader = entry->mCompressedNextHeader;
+        mFrameData.SkipOver(entry->mLength);
+    }
+    else
+    {
+        const uint8_t *start = mFrameData.GetBytes();
+
+        SuccessOrExit(DecompressBaseHeaderFields(aIp6Header, aCompressedNextHeader));
+
+        flowCache.AddDecompressed(mMacAddrs, start, static_cast<uint16_t>(mFrameData.GetBytes() - start), aIp6Header,
+                                  aCompressedNextHeader);
+    }
+#else
+    SuccessOrExit(DecompressBaseHeaderFields(aIp6Header, aCompressedNextHeader));
+#endif
+
+    if (aCompressedNextHeader)
+    {
+        VerifyOrExit(mFrameData.GetLength() > 0);
+        SuccessOrExit(DispatchToNextHeader(*mFrameData.GetBytes(), nextHeader));
+        aIp6Header.SetNextHeader(nextHeader);
+    }
+
+    error = kErrorNone;
+
+exit:
+    return error;
+}
+
+Error Lowpan::HeaderDecompressor::DecompressBaseHeaderFields(Ip6::Header &aIp6Header, bool &aCompressedNextHeader)
 {
     Error    error = kErrorParse;
     uint16_t hcCtl;
@@ -613,7 +740,6 @@ Error Lowpan::HeaderDecompressor::DecompressBaseHeader(Ip6::Header &aIp6Header,
     uint8_t  dstContextId = 0;
     Context  srcContext;
     Context  dstContext;
-    uint8_t  nextHeader;
 
     SuccessOrExit(mFrameData.ReadUint<kBigEndian>(hcCtl));
 
@@ -821,13 +947,6 @@ Error Lowpan::HeaderDecompressor::DecompressBaseHeader(Ip6::Header &aIp6Header,
         }
     }
 
-    if ((hcCtl & kHcNextHeader) != 0)
-    {
-        VerifyOrExit(mFrameData.GetLength() > 0);
-        SuccessOrExit(DispatchToNextHeader(*mFrameData.GetBytes(), nextHeader));
-        aIp6Header.SetNextHeader(nextHeader);
-    }
-
     error = kErrorNone;
 
 exit:
@@ -1092,6 +1211,124 @@ void Lowpan::MarkCompressedEcn(Message &aMessage, uint16_t aOffset)
     aMessage.Write(aOffset, byte);
 }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// Lowpan::FlowCache
+
+bool Lowpan::FlowCache::MacAddrsMatch(const Mac::Addresses &aFirst, const Mac::Addresses &aSecond)
+{
+    return (aFirst.mSource == aSecond.mSource) && (aFirst.mDestination == aSecond.mDestination);
+}
+
+bool Lowpan::FlowCache::CompressEntry::Matches(const Ip6::Header    &aIp6Header,
+                                               const Ip6::UdpHeader &aUdpHeader,
+                                               const Mac::Addresses &aMacAddrs) const
+{
+    // The Payload Length field is elided by the compression, so it is
+    // excluded from the comparison. Note that `mIp6Header` is stored
+    // with its Payload Length set to zero.
+
+    Ip6::Header ip6Header = aIp6Header;
+
+    ip6Header.SetPayloadLength(0);
+
+    return (mLength != 0) && (memcmp(&mIp6Header, &ip6Header, sizeof(Ip6::Header)) == 0) &&
+           (mSourcePort == aUdpHeader.GetSourcePort()) && (mDestinationPort == aUdpHeader.GetDestinationPort()) &&
+           MacAddrsMatch(mMacAddrs, aMacAddrs);
+}
+
+const uint8_t *Lowpan::FlowCache::FindCompressed(const Ip6::Header    &aIp6Header,
+                                                 const Ip6::UdpHeader &aUdpHeader,
+                                                 const Mac::Addresses &aMacAddrs,
+                                                 uint8_t              &aLength) const
+{
+    const uint8_t *header = nullptr;
+
+    for (const CompressEntry &entry : mCompressEntries)
+    {
+        if (entry.Matches(aIp6Header, aUdpHeader, aMacAddrs))
+        {
+            header  = entry.mHeader;
+            aLength = entry.mLength;
+            break;
+        }
+    }
+
+    return header;
+}
+
+void Lowpan::FlowCache::AddCompressed(const Ip6::Header    &aIp6Header,
+                                      const Ip6::UdpHeader &aUdpHeader,
+                                      const Mac::Addresses &aMacAddrs,
+                                      const uint8_t        *aHeader,
+                                      uint16_t              aLength)
+{
+    CompressEntry &entry = mCompressEntries[mNextCompressIndex];
+
+    VerifyOrExit((aLength > 0) && (aLength <= kMaxHeaderLength));
+
+    entry.mIp6Header = aIp6Header;
+    entry.mIp6Header.SetPayloadLength(0);
+    entry.mMacAddrs        = aMacAddrs;
+    entry.mSourcePort      = aUdpHeader.GetSourcePort();
+    entry.mDestinationPort = aUdpHeader.GetDestinationPort();
+    entry.mLength          = static_cast<uint8_t>(aLength);
+    memcpy(entry.mHeader, aHeader, aLength);
+
+    mNextCompressIndex = (mNextCompressIndex + 1) % kNumEntries;
+
+exit:
+    return;
+}
+
+const Lowpan::FlowCache::DecompressEntry *Lowpan::FlowCache::FindDecompressed(const Mac::Addresses &aMacAddrs,
+                                                                              const FrameData      &aFrameData) const
+{
+    // The IPHC header is parsed sequentially, so when the frame
+    // starts with the same bytes as a cached entry, it would be
+    // parsed the same way and the same number of bytes is consumed.
+
+    const DecompressEntry *match = nullptr;
+
+    for (const DecompressEntry &entry : mDecompressEntries)
+    {
+        if ((entry.mLength != 0) && aFrameData.CanRead(entry.mLength) &&
+            (memcmp(entry.mHeader, aFrameData.GetBytes(), entry.mLength) == 0) &&
+            MacAddrsMatch(entry.mMacAddrs, aMacAddrs))
+        {
+            match = &entry;
+            break;
+        }
+    }
+
+    return match;
+}
+
+void Lowpan::FlowCache::AddDecompressed(const Mac::Addresses &aMacAddrs,
+                                        const uint8_t        *aHeader,
+                                        uint16_t              aLength,
+                                        const Ip6::Header    &aIp6Header,
+                                        bool                  aCompressedNextHeader)
+{
+    DecompressEntry &entry = mDecompressEntries[mNextDecompressIndex];
+
+    VerifyOrExit((aLength > 0) && (aLength <= kMaxHeaderLength));
+
+    entry.mIp6Header            = aIp6Header;
+    entry.mMacAddrs             = aMacAddrs;
+    entry.mLength               = static_cast<uint8_t>(aLength);
+    entry.mCompressedNextHeader = aCompressedNextHeader;
+    memcpy(entry.mHeader, aHeader, aLength);
+
+    mNextDecompressIndex = (mNextDecompressIndex + 1) % kNumEntries;
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // MeshHeader
 
@@ -255,6 +255,16 @@ public:
      */
     static void MarkCompressedEcn(Message &aMessage, uint16_t aOffset);
 
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+    /**
+     * Invalidates all entries in the 6LoWPAN flow cache.
+     *
+     * MUST be called when any information used for compression/decompression (e.g., contexts from Network Data or
+     * mesh-local prefix) changes.
+     */
+    void InvalidateFlowCache(void) { mFlowCache.Clear(); }
+#endif
+
 private:
     static constexpr uint8_t kMaxRecursionDepth = 5;
 
@@ -308,6 +318,73 @@ private:
     static constexpr uint8_t kUdpChecksum = 1 << 2;
     static constexpr uint8_t kUdpPortMask = 3 << 0;
 
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+    class FlowCache : public Clearable<FlowCache>
+    {
+        // Caches compressed headers of recent flows. A compress entry
+        // maps the IPv6 header (excluding Payload Length), UDP ports
+        // and MAC addresses of a UDP datagram (with no extension
+        // headers) to its compressed IPHC and NHC UDP headers
+        // (excluding the trailing UDP checksum). A decompress entry
+        // maps the compressed IPHC header bytes and MAC addresses to
+        // the decompressed IPv6 header. Entries are replaced in a
+        // round-robin order.
+
+    public:
+        static constexpr uint8_t kMaxHeaderLength = 48;
+
+        struct DecompressEntry
+        {
+            Ip6::Header    mIp6Header;
+            Mac::Addresses mMacAddrs;
+            uint8_t        mLength;
+            bool           mCompressedNextHeader;
+            uint8_t        mHeader[kMaxHeaderLength];
+        };
+
+        const uint8_t *FindCompressed(const Ip6::Header    &aIp6Header,
+                                      const Ip6::UdpHeader &aUdpHeader,
+                                      const Mac::Addresses &aMacAddrs,
+                                      uint8_t              &aLength) const;
+        void           AddCompressed(const Ip6::Header    &aIp6Header,
+                                     const Ip6::UdpHeader &aUdpHeader,
+                                     const Mac::Addresses &aMacAddrs,
+                                     const uint8_t        *aHeader,
+                                     uint16_t              aLength);
+
+        const DecompressEntry *FindDecompressed(const Mac::Addresses &aMacAddrs, const FrameData &aFrameData) const;
+        void                   AddDecompressed(const Mac::Addresses &aMacAddrs,
+                                               const uint8_t        *aHeader,
+                                               uint16_t              aLength,
+                                               const Ip6::Header    &aIp6Header,
+                                               bool                  aCompressedNextHeader);
+
+    private:
+        static constexpr uint8_t kNumEntries = OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_SIZE;
+
+        struct CompressEntry
+        {
+            bool Matches(const Ip6::Header    &aIp6Header,
+                         const Ip6::UdpHeader &aUdpHeader,
+                         const Mac::Addresses &aMacAddrs) const;
+
+            Ip6::Header    mIp6Header;
+            Mac::Addresses mMacAddrs;
+            uint16_t       mSourcePort;
+            uint16_t       mDestinationPort;
+            uint8_t        mLength;
+            uint8_t        mHeader[kMaxHeaderLength];
+        };
+
+        static bool MacAddrsMatch(const Mac::Addresses &aFirst, const Mac::Addresses &aSecond);
+
+        CompressEntry   mCompressEntries[kNumEntries];
+        DecompressEntry mDecompressEntries[kNumEntries];
+        uint8_t         mNextCompressIndex;
+        uint8_t         mNextDecompressIndex;
+    };
+#endif
+
     class Compressor : public InstanceLocator, private NonCopyable
     {
     public:
@@ -324,6 +401,10 @@ private:
 
     private:
         void  FindContextToCompressAddress(const Ip6::Address &aIp6Address, Context &aContext) const;
+        Error CompressHeaders(void);
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+        Error CompressUsingFlowCache(void);
+#endif
         Error Compress(uint8_t &aHeaderDepth);
         Error CompressExtensionHeader(uint8_t &aNextHeader);
         Error CompressSourceIid(const Ip6::Address &aIpAddr, const Context &aContext, uint16_t &aHcCtl);
@@ -352,6 +433,8 @@ private:
     protected:
         static Error DispatchToNextHeader(uint8_t aDispatch, uint8_t &aNextHeader);
 
+        Error DecompressBaseHeaderFields(Ip6::Header &aIp6Header, bool &aCompressedNextHeader);
+
         const Mac::Addresses &mMacAddrs;
         FrameData            &mFrameData;
     };
@@ -383,6 +466,10 @@ private:
     };
 
     static Error ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::InterfaceIdentifier &aIid);
+
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+    FlowCache mFlowCache;
+#endif
 };
 
 /**
@@ -542,6 +629,8 @@ private:
 class FragmentHeader
 {
 public:
+    static constexpr uint16_t kMaxDatagramSize = 0x7ff; ///< Max Datagram Size value (11-bit field).
+
     OT_TOOL_PACKED_BEGIN
     class FirstFrag
     {
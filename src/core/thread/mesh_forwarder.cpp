@@ -66,6 +66,7 @@ void MeshForwarder::Counters::UpdateOnDrop(const Message &aMessage)
 
 MeshForwarder::MeshForwarder(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mReassemblyTimer(aInstance)
     , mMessageNextOffset(0)
     , mSendMessage(nullptr)
     , mMeshSource()
@@ -110,12 +111,29 @@ void MeshForwarder::Stop(void)
     Get<TimeTicker>().UnregisterReceiver(TimeTicker::kMeshForwarder);
     Get<Mle::DiscoverScanner>().Stop();
 
+    for (Message &message : mSendQueue)
+    {
+        Get<MessageFramer>().HandleMessageRemoved(message);
+    }
+
     mSendQueue.DequeueAndFreeAll();
-    mReassemblyList.DequeueAndFreeAll();
+
+    for (ReassemblyTable::Entry &entry : mReassemblyTable)
+    {
+        if (entry.IsInUse())
+        {
+            RemoveReassemblyEntry(entry);
+        }
+    }
+
+    mReassemblyTimer.Stop();
 
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
     mFwdFrameInfoArray.Clear();
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+    mRouteCache.Invalidate();
+#endif
 #endif
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
@@ -986,6 +1004,7 @@ bool MeshForwarder::RemoveMessageIfNoPendingTx(Message &aMessage)
         mMessageNextOffset = 0;
     }
 
+    Get<MessageFramer>().HandleMessageRemoved(aMessage);
     mSendQueue.DequeueAndFree(aMessage);
     didRemove = true;
 
@@ -1065,12 +1084,19 @@ exit:
 
 void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
 {
-    Error                  error = kErrorNone;
-    Lowpan::FragmentHeader fragmentHeader;
-    Message               *message = nullptr;
+    Error                   error = kErrorNone;
+    Lowpan::FragmentHeader  fragmentHeader;
+    Message                *message = nullptr;
+    ReassemblyTable::Entry *entry   = nullptr;
+    uint16_t                datagramSize;
+    uint16_t                datagramTag;
+    uint16_t                receivedLength;
 
     SuccessOrExit(error = fragmentHeader.ParseFrom(aRxInfo.mFrameData));
 
+    datagramSize = fragmentHeader.GetDatagramSize();
+    datagramTag  = fragmentHeader.GetDatagramTag();
+
 #if OPENTHREAD_CONFIG_MULTI_RADIO
 
     if (aRxInfo.IsLinkSecurityEnabled())
@@ -1080,31 +1106,35 @@ void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
 
         if ((neighbor != nullptr) && (fragmentHeader.GetDatagramOffset() == 0))
         {
-            uint16_t tag = fragmentHeader.GetDatagramTag();
-
             if (neighbor->IsLastRxFragmentTagSet())
             {
-                VerifyOrExit(!neighbor->IsLastRxFragmentTagAfter(tag), error = kErrorDuplicated);
+                VerifyOrExit(!neighbor->IsLastRxFragmentTagAfter(datagramTag), error = kErrorDuplicated);
             }
 
-            neighbor->SetLastRxFragmentTag(tag);
+            neighbor->SetLastRxFragmentTag(datagramTag);
         }
 
         // Duplication suppression for a "next fragment" is handled
-        // by the code below where the datagram offset is
-        // checked against the offset of the corresponding message
-        // (same datagram tag and size) in Reassembly List. Note
-        // that if there is no matching message in the Reassembly
-        // List (e.g., in case the message is already fully
-        // assembled) the received "next fragment" frame would be
-        // dropped.
+        // by the code below where the received units of the
+        // corresponding message (same source, datagram tag and
+        // size) in the reassembly table are checked. Note that if
+        // there is no matching entry (e.g., in case the message is
+        // already fully assembled) the received "next fragment"
+        // frame would be dropped.
     }
 
 #endif // OPENTHREAD_CONFIG_MULTI_RADIO
 
+    entry = mReassemblyTable.Find(aRxInfo.GetSrcAddr(), datagramTag, datagramSize);
+
     if (fragmentHeader.GetDatagramOffset() == 0)
     {
-        uint16_t datagramSize = fragmentHeader.GetDatagramSize();
+        if (entry != nullptr)
+        {
+            entry = nullptr;
+            mReassemblyTable.GetCounters().mDuplicates++;
+            ExitNow(error = kErrorDuplicated);
+        }
 
 #if OPENTHREAD_FTD
         UpdateEidRlocCacheAndStaleChild(aRxInfo);
@@ -1113,9 +1143,8 @@ void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
         SuccessOrExit(error = FrameToMessage(aRxInfo, datagramSize, message));
 
         VerifyOrExit(datagramSize >= message->GetLength(), error = kErrorParse);
-        SuccessOrExit(error = message->SetLength(datagramSize));
 
-        message->SetDatagramTag(fragmentHeader.GetDatagramTag());
+        message->SetDatagramTag(datagramTag);
         message->SetTimestampToNow();
         message->UpdateLinkInfoFrom(aRxInfo.mLinkInfo);
 
@@ -1134,55 +1163,82 @@ void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
             ClearReassemblyList();
         }
 
-        mReassemblyList.Enqueue(*message);
+        receivedLength = message->GetLength();
+        SuccessOrExit(error = message->SetLength(datagramSize));
 
-        Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
+        entry = mReassemblyTable.FindEntryToEvict(aRxInfo.GetSrcAddr());
+
+        if (entry != nullptr)
+        {
+            mReassemblyTable.GetCounters().mEvictions++;
+            DropReassemblyEntry(*entry, kErrorNoBufs);
+        }
+
+        entry = mReassemblyTable.FindFreeEntry(aRxInfo.GetSrcAddr(), datagramTag);
+        OT_ASSERT(entry != nullptr);
+
+        mReassemblyTable.Add(*entry, *message, aRxInfo.GetSrcAddr(), datagramTag, datagramSize);
+        IgnoreError(entry->MarkReceived(0, receivedLength));
+
+        mReassemblyList.Enqueue(*message);
     }
     else // Received frame is a "next fragment".
     {
-        for (Message &msg : mReassemblyList)
+        uint16_t offset = fragmentHeader.GetDatagramOffset();
+        uint16_t length = aRxInfo.mFrameData.GetLength();
+
+        // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+
+        if ((entry != nullptr) && (entry->mMessage->IsLinkSecurityEnabled() != aRxInfo.IsLinkSecurityEnabled()))
         {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (msg.GetLength() == fragmentHeader.GetDatagramSize() &&
-                msg.GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                msg.GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                msg.GetOffset() + aRxInfo.mFrameData.GetLength() <= fragmentHeader.GetDatagramSize() &&
-                msg.IsLinkSecurityEnabled() == aRxInfo.IsLinkSecurityEnabled())
-            {
-                message = &msg;
-                break;
-            }
+            entry = nullptr;
         }
 
-        // For a sleepy-end-device, if we receive a new (secure) next fragment
-        // with a non-matching fragmentation offset or tag, it indicates that
-        // we have either missed a fragment, or the parent has moved to a new
-        // message with a new tag. In either case, we can safely clear any
-        // remaining fragments stored in the reassembly list.
+        // A sleepy-end-device only accepts in-order fragments. If we
+        // receive a new (secure) next fragment with a non-matching
+        // fragmentation offset or tag, it indicates that we have
+        // either missed a fragment, or the parent has moved to a new
+        // message with a new tag. In either case, we can safely clear
+        // any remaining fragments stored in the reassembly list.
 
-        if (!GetRxOnWhenIdle() && (message == nullptr) && aRxInfo.IsLinkSecurityEnabled())
+        if (!GetRxOnWhenIdle() && aRxInfo.IsLinkSecurityEnabled() &&
+            ((entry == nullptr) || (offset != entry->mReceivedLength)))
         {
+            entry = nullptr;
             ClearReassemblyList();
         }
 
-        VerifyOrExit(message != nullptr, error = kErrorDrop);
+        VerifyOrExit(entry != nullptr, error = kErrorDrop);
 
-        message->WriteData(message->GetOffset(), aRxInfo.mFrameData);
-        message->MoveOffset(aRxInfo.mFrameData.GetLength());
+        VerifyOrExit(offset + length <= datagramSize, error = kErrorDrop);
+
+        if (entry->MarkReceived(offset, length) != kErrorNone)
+        {
+            mReassemblyTable.GetCounters().mDuplicates++;
+            ExitNow(error = kErrorDuplicated);
+        }
+
+        message = entry->mMessage;
+        message->WriteData(offset, aRxInfo.mFrameData);
         message->AddRss(aRxInfo.mLinkInfo.GetRss());
         message->AddLqi(aRxInfo.mLinkInfo.GetLqi());
-        message->SetTimestampToNow();
     }
 
+    entry->mExpireTime = TimerMilli::GetNow() + TimeMilli::SecToMsec(kReassemblyTimeout);
+
 exit:
 
     if (error == kErrorNone)
     {
-        if (message->DetermineLengthAfterOffset() == 0)
+        if (entry->IsComplete())
         {
+            mReassemblyTable.GetCounters().mReassembled++;
             mReassemblyList.Dequeue(*message);
+            mReassemblyTable.Remove(*entry);
             IgnoreError(HandleDatagram(*message, aRxInfo.GetSrcAddr()));
         }
+
+        ScheduleReassemblyTimer();
     }
     else
     {
@@ -1191,13 +1247,27 @@ exit:
     }
 }
 
+void MeshForwarder::RemoveReassemblyEntry(ReassemblyTable::Entry &aEntry)
+{
+    mReassemblyList.DequeueAndFree(*aEntry.mMessage);
+    mReassemblyTable.Remove(aEntry);
+}
+
+void MeshForwarder::DropReassemblyEntry(ReassemblyTable::Entry &aEntry, Error aError)
+{
+    LogMessage(kMessageReassemblyDrop, *aEntry.mMessage, aError);
+    mCounters.UpdateOnDrop(*aEntry.mMessage);
+    RemoveReassemblyEntry(aEntry);
+}
+
 void MeshForwarder::ClearReassemblyList(void)
 {
-    for (Message &message : mReassemblyList)
+    for (ReassemblyTable::Entry &entry : mReassemblyTable)
     {
-        LogMessage(kMessageReassemblyDrop, message, kErrorNoFrameReceived);
-        mCounters.UpdateOnDrop(message);
-        mReassemblyList.DequeueAndFree(message);
+        if (entry.IsInUse())
+        {
+            DropReassemblyEntry(entry, kErrorNoFrameReceived);
+        }
     }
 }
 
@@ -1207,13 +1277,12 @@ Error MeshForwarder::RemoveUnsecureReassemblyMessage(EvictReason aEvictReason)
 
     VerifyOrExit(aEvictReason == kEvictReasonNoMessageBuffer);
 
-    for (Message &message : mReassemblyList)
+    for (ReassemblyTable::Entry &entry : mReassemblyTable)
     {
-        if (!message.IsLinkSecurityEnabled())
+        if (entry.IsInUse() && !entry.mMessage->IsLinkSecurityEnabled())
         {
-            LogMessage(kMessageReassemblyDrop, message, kErrorNoBufs);
-            mCounters.UpdateOnDrop(message);
-            mReassemblyList.DequeueAndFree(message);
+            mReassemblyTable.GetCounters().mEvictions++;
+            DropReassemblyEntry(entry, kErrorNoBufs);
             ExitNow(error = kErrorNone);
         }
     }
@@ -1230,29 +1299,215 @@ void MeshForwarder::HandleTimeTick(void)
     continueRxingTicks = UpdateFwdFrameInfoArrayOnTimeTick();
 #endif
 
-    continueRxingTicks = UpdateReassemblyList() || continueRxingTicks;
-
     if (!continueRxingTicks)
     {
         Get<TimeTicker>().UnregisterReceiver(TimeTicker::kMeshForwarder);
     }
 }
 
-bool MeshForwarder::UpdateReassemblyList(void)
+void MeshForwarder::HandleReassemblyTimer(void)
 {
     TimeMilli now = TimerMilli::GetNow();
 
-    for (Message &message : mReassemblyList)
+    for (ReassemblyTable::Entry &entry : mReassemblyTable)
+    {
+        if (entry.IsInUse() && (entry.mExpireTime <= now))
+        {
+            mReassemblyTable.GetCounters().mTimeouts++;
+            DropReassemblyEntry(entry, kErrorReassemblyTimeout);
+        }
+    }
+
+    ScheduleReassemblyTimer();
+}
+
+void MeshForwarder::ScheduleReassemblyTimer(void)
+{
+    NextFireTime nextTime;
+
+    for (const ReassemblyTable::Entry &entry : mReassemblyTable)
+    {
+        if (entry.IsInUse())
+        {
+            nextTime.UpdateIfEarlier(entry.mExpireTime);
+        }
+    }
+
+    mReassemblyTimer.FireAt(nextTime);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// ReassemblyTable
+
+MeshForwarder::ReassemblyTable::ReassemblyTable(void)
+    : mNumEntries(0)
+{
+    ClearAllBytes(mEntries);
+    mCounters.Clear();
+}
+
+uint8_t MeshForwarder::ReassemblyTable::IndexFor(const Mac::Address &aSource, uint16_t aDatagramTag)
+{
+    uint16_t hash = aDatagramTag;
+
+    if (aSource.IsShort())
     {
-        if (now - message.GetTimestamp() >= TimeMilli::SecToMsec(kReassemblyTimeout))
+        hash ^= aSource.GetShort();
+    }
+    else if (aSource.IsExtended())
+    {
+        for (uint8_t byte : aSource.GetExtended().m8)
         {
-            LogMessage(kMessageReassemblyDrop, message, kErrorReassemblyTimeout);
-            mCounters.UpdateOnDrop(message);
-            mReassemblyList.DequeueAndFree(message);
+            hash = static_cast<uint16_t>((hash << 3) ^ (hash >> 13) ^ byte);
         }
     }
 
-    return mReassemblyList.GetHead() != nullptr;
+    return static_cast<uint8_t>(hash % kSize);
+}
+
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::Find(const Mac::Address &aSource,
+                                                                             uint16_t            aDatagramTag,
+                                                                             uint16_t            aDatagramSize)
+{
+    Entry  *match = nullptr;
+    uint8_t index = IndexFor(aSource, aDatagramTag);
+
+    VerifyOrExit(mNumEntries > 0);
+
+    for (uint8_t probe = 0; probe < kSize; probe++)
+    {
+        Entry &entry = mEntries[(index + probe) % kSize];
+
+        if (entry.Matches(aSource, aDatagramTag, aDatagramSize))
+        {
+            ExitNow(match = &entry);
+        }
+    }
+
+exit:
+    return match;
+}
+
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::FindFreeEntry(const Mac::Address &aSource,
+                                                                                      uint16_t            aDatagramTag)
+{
+    Entry  *freeEntry = nullptr;
+    uint8_t index     = IndexFor(aSource, aDatagramTag);
+
+    for (uint8_t probe = 0; probe < kSize; probe++)
+    {
+        Entry &entry = mEntries[(index + probe) % kSize];
+
+        if (!entry.IsInUse())
+        {
+            ExitNow(freeEntry = &entry);
+        }
+    }
+
+exit:
+    return freeEntry;
+}
+
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::FindEntryToEvict(const Mac::Address &aSource)
+{
+    // Returns the entry (closest to expiry) to evict to make room
+    // for a new datagram from `aSource`, or `nullptr` if there is
+    // no need to evict any entry. An entry from the same source is
+    // evicted if `aSource` already has the maximum allowed number
+    // of entries, otherwise any entry is evicted if table is full.
+
+    Entry  *oldest            = nullptr;
+    Entry  *oldestFromSrc     = nullptr;
+    uint8_t numEntriesFromSrc = 0;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsInUse())
+        {
+            continue;
+        }
+
+        if ((oldest == nullptr) || (entry.mExpireTime < oldest->mExpireTime))
+        {
+            oldest = &entry;
+        }
+
+        if (entry.mSource == aSource)
+        {
+            numEntriesFromSrc++;
+
+            if ((oldestFromSrc == nullptr) || (entry.mExpireTime < oldestFromSrc->mExpireTime))
+            {
+                oldestFromSrc = &entry;
+            }
+        }
+    }
+
+    if (numEntriesFromSrc >= kMaxEntriesPerSrc)
+    {
+        oldest = oldestFromSrc;
+    }
+    else if (mNumEntries < kSize)
+    {
+        oldest = nullptr;
+    }
+
+    return oldest;
+}
+
+void MeshForwarder::ReassemblyTable::Add(Entry              &aEntry,
+                                         Message            &aMessage,
+                                         const Mac::Address &aSource,
+                                         uint16_t            aDatagramTag,
+                                         uint16_t            aDatagramSize)
+{
+    OT_ASSERT(!aEntry.IsInUse());
+
+    aEntry.mMessage        = &aMessage;
+    aEntry.mSource         = aSource;
+    aEntry.mDatagramTag    = aDatagramTag;
+    aEntry.mDatagramSize   = aDatagramSize;
+    aEntry.mReceivedLength = 0;
+    aEntry.mReceivedUnits.Clear();
+    mNumEntries++;
+}
+
+void MeshForwarder::ReassemblyTable::Remove(Entry &aEntry)
+{
+    OT_ASSERT(aEntry.IsInUse());
+
+    aEntry.mMessage = nullptr;
+    mNumEntries--;
+}
+
+bool MeshForwarder::ReassemblyTable::Entry::Matches(const Mac::Address &aSource,
+                                                     uint16_t            aDatagramTag,
+                                                     uint16_t            aDatagramSize) const
+{
+    return IsInUse() && (mDatagramTag == aDatagramTag) && (mDatagramSize == aDatagramSize) && (mSource == aSource);
+}
+
+Error MeshForwarder::ReassemblyTable::Entry::MarkReceived(uint16_t aOffset, uint16_t aLength)
+{
+    Error    error   = kErrorNone;
+    uint16_t endUnit = (aOffset + aLength + kUnitSize - 1) / kUnitSize;
+
+    VerifyOrExit(aLength > 0, error = kErrorParse);
+
+    for (uint16_t unit = aOffset / kUnitSize; unit < endUnit; unit++)
+    {
+        VerifyOrExit(!mReceivedUnits.Has(unit), error = kErrorDuplicated);
+    }
+
+    for (uint16_t unit = aOffset / kUnitSize; unit < endUnit; unit++)
+    {
+        mReceivedUnits.Add(unit);
+    }
+
+    mReceivedLength += aLength;
+
+exit:
+    return error;
 }
 
 Error MeshForwarder::FrameToMessage(RxInfo &aRxInfo, uint16_t aDatagramSize, Message *&aMessage)
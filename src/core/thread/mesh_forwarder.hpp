@@ -37,6 +37,7 @@
 #include "openthread-core-config.h"
 
 #include "common/as_core_type.hpp"
+#include "common/bit_set.hpp"
 #include "common/clearable.hpp"
 #include "common/frame_data.hpp"
 #include "common/locator.hpp"
@@ -45,6 +46,7 @@
 #include "common/owned_ptr.hpp"
 #include "common/tasklet.hpp"
 #include "common/time_ticker.hpp"
+#include "common/timer.hpp"
 #include "mac/channel_mask.hpp"
 #include "mac/data_poll_sender.hpp"
 #include "mac/mac.hpp"
@@ -194,6 +196,29 @@ public:
         mSendQueue.GetInfo(aSendQueueInfo), mReassemblyList.GetInfo(aReassemblyQueueInfo);
     }
 
+    /**
+     * Represents the 6LoWPAN reassembly counters.
+     */
+    struct ReassemblyCounters : public Clearable<ReassemblyCounters>
+    {
+        uint32_t mReassembled; ///< Number of datagrams successfully reassembled.
+        uint32_t mTimeouts;    ///< Number of datagrams dropped due to reassembly timeout.
+        uint32_t mEvictions;   ///< Number of datagrams evicted (table full, per-source limit, or no buffers).
+        uint32_t mDuplicates;  ///< Number of duplicate or overlapping fragments dropped.
+    };
+
+    /**
+     * Returns the 6LoWPAN reassembly counters.
+     *
+     * @returns The reassembly counters.
+     */
+    const ReassemblyCounters &GetReassemblyCounters(void) const { return mReassemblyTable.GetCounters(); }
+
+    /**
+     * Resets the 6LoWPAN reassembly counters.
+     */
+    void ResetReassemblyCounters(void) { mReassemblyTable.ResetCounters(); }
+
     /**
      * Returns a reference to the IP level counters.
      *
@@ -252,6 +277,38 @@ public:
     void ResetTimeInQueueStat(void) { mTxQueueStats.Clear(); }
 #endif
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+    /**
+     * Represents the route cache counters.
+     */
+    struct RouteCacheCounters : public Clearable<RouteCacheCounters>
+    {
+        uint32_t mHits;          ///< Number of route lookups served from the cache.
+        uint32_t mMisses;        ///< Number of route lookups that required a Network Data lookup.
+        uint32_t mInvalidations; ///< Number of times the route cache was invalidated.
+    };
+
+    /**
+     * Invalidates all entries in the route cache.
+     *
+     * Is called when any information used in route lookup changes (e.g., the Network Data, the router table, or the
+     * unicast addresses of the Thread interface).
+     */
+    void InvalidateRouteCache(void) { mRouteCache.Invalidate(); }
+
+    /**
+     * Returns the route cache counters.
+     *
+     * @returns The route cache counters.
+     */
+    const RouteCacheCounters &GetRouteCacheCounters(void) const { return mRouteCache.GetCounters(); }
+
+    /**
+     * Resets the route cache counters.
+     */
+    void ResetRouteCacheCounters(void) { mRouteCache.ResetCounters(); }
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     /**
      * Handles a deferred ack.
@@ -401,8 +458,112 @@ private:
 
     using FwdFrameInfoArray = Array<FwdFrameInfo, kFwdInfoEntries>;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+    class RouteCache
+    {
+        // Direct-mapped cache of the mesh destination RLOC16 for
+        // (source, destination) IPv6 address pairs determined from
+        // the Network Data route lookup. All entries are invalidated
+        // at once by incrementing the generation number.
+
+    public:
+        RouteCache(void);
+
+        void                      Invalidate(void);
+        Error                     Lookup(const Ip6::Header &aIp6Header, uint16_t &aMeshDest);
+        void                      Add(const Ip6::Header &aIp6Header, uint16_t aMeshDest);
+        const RouteCacheCounters &GetCounters(void) const { return mCounters; }
+        void                      ResetCounters(void) { mCounters.Clear(); }
+
+    private:
+        static constexpr uint16_t kSize    = OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_SIZE;
+        static constexpr uint32_t kTimeout = OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENTRY_TIMEOUT;
+
+        static_assert(kSize > 0, "OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_SIZE must be non-zero");
+
+        struct Entry
+        {
+            Ip6::Address mSource;
+            Ip6::Address mDestination;
+            TimeMilli    mExpireTime;
+            uint32_t     mGeneration;
+            uint16_t     mMeshDest;
+        };
+
+        static uint16_t IndexFor(const Ip6::Header &aIp6Header);
+
+        uint32_t           mGeneration;
+        RouteCacheCounters mCounters;
+        Entry              mEntries[kSize];
+    };
+#endif
+
 #endif // OPENTHREAD_FTD
 
+    class ReassemblyTable
+    {
+        // Tracks the datagrams being reassembled. Entries are looked
+        // up by (source, datagram tag, datagram size) starting from
+        // an index derived from the source and tag (open addressing
+        // with linear probing). Each entry keeps a bitmap of received
+        // 8-byte units of the datagram to detect duplicate or
+        // overlapping fragments and to allow fragments (other than
+        // the first one) to be received out of order.
+
+    public:
+        static constexpr uint8_t  kUnitSize = 8; // Fragment offsets are in units of 8 bytes.
+        static constexpr uint16_t kNumUnits = (Lowpan::FragmentHeader::kMaxDatagramSize + kUnitSize - 1) / kUnitSize;
+
+        struct Entry
+        {
+            bool  IsInUse(void) const { return mMessage != nullptr; }
+            bool  Matches(const Mac::Address &aSource, uint16_t aDatagramTag, uint16_t aDatagramSize) const;
+            bool  IsComplete(void) const { return mReceivedLength == mDatagramSize; }
+            Error MarkReceived(uint16_t aOffset, uint16_t aLength);
+
+            Message          *mMessage;
+            Mac::Address      mSource;
+            uint16_t          mDatagramTag;
+            uint16_t          mDatagramSize;
+            uint16_t          mReceivedLength;
+            TimeMilli         mExpireTime;
+            BitSet<kNumUnits> mReceivedUnits;
+        };
+
+        ReassemblyTable(void);
+
+        Entry *Find(const Mac::Address &aSource, uint16_t aDatagramTag, uint16_t aDatagramSize);
+        Entry *FindFreeEntry(const Mac::Address &aSource, uint16_t aDatagramTag);
+        Entry *FindEntryToEvict(const Mac::Address &aSource);
+        void   Add(Entry              &aEntry,
+                   Message            &aMessage,
+                   const Mac::Address &aSource,
+                   uint16_t            aDatagramTag,
+                   uint16_t            aDatagramSize);
+        void   Remove(Entry &aEntry);
+
+        ReassemblyCounters       &GetCounters(void) { return mCounters; }
+        const ReassemblyCounters &GetCounters(void) const { return mCounters; }
+        void                      ResetCounters(void) { mCounters.Clear(); }
+
+        // Range-based `for` loop iteration over all entries.
+        Entry *begin(void) { return &mEntries[0]; }
+        Entry *end(void) { return &mEntries[kSize]; }
+
+    private:
+        static constexpr uint8_t kSize             = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TABLE_SIZE;
+        static constexpr uint8_t kMaxEntriesPerSrc = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES_PER_SOURCE;
+
+        static_assert(kSize > 0, "OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TABLE_SIZE must be non-zero");
+        static_assert(kMaxEntriesPerSrc > 0, "OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES_PER_SOURCE is zero");
+
+        static uint8_t IndexFor(const Mac::Address &aSource, uint16_t aDatagramTag);
+
+        Entry              mEntries[kSize];
+        uint8_t            mNumEntries;
+        ReassemblyCounters mCounters;
+    };
+
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
     class TxQueueStats : public Clearable<TxQueueStats>
     {
@@ -446,7 +607,10 @@ private:
     Error UpdateIp6Route(Message &aMessage);
     Error UpdateIp6RouteFtd(const Ip6::Header &aIp6Header, Message &aMessage);
     Error UpdateMeshRoute(Message &aMessage);
-    bool  UpdateReassemblyList(void);
+    void  HandleReassemblyTimer(void);
+    void  ScheduleReassemblyTimer(void);
+    void  RemoveReassemblyEntry(ReassemblyTable::Entry &aEntry);
+    void  DropReassemblyEntry(ReassemblyTable::Entry &aEntry, Error aError);
     void  UpdateFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                  uint16_t                aFragmentLength,
                                  uint16_t                aSrcRloc16,
@@ -539,15 +703,18 @@ private:
     void AppendMacAddrToLogString(StringWriter &aString, MessageAction aAction, const Mac::Address *aMacAddress);
 #endif // #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_NOTE)
 
-    using TxTask = TaskletIn<MeshForwarder, &MeshForwarder::ScheduleTransmissionTask>;
+    using TxTask          = TaskletIn<MeshForwarder, &MeshForwarder::ScheduleTransmissionTask>;
+    using ReassemblyTimer = TimerMilliIn<MeshForwarder, &MeshForwarder::HandleReassemblyTimer>;
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
     using TxDelayTimer = TimerMilliIn<MeshForwarder, &MeshForwarder::HandleTxDelayTimer>;
 #endif
 
-    PriorityQueue mSendQueue;
-    MessageQueue  mReassemblyList;
-    uint16_t      mMessageNextOffset;
+    PriorityQueue   mSendQueue;
+    MessageQueue    mReassemblyList;
+    ReassemblyTable mReassemblyTable;
+    ReassemblyTimer mReassemblyTimer;
+    uint16_t        mMessageNextOffset;
 
     Message *mSendMessage;
 
@@ -573,6 +740,9 @@ private:
 
 #if OPENTHREAD_FTD
     FwdFrameInfoArray mFwdFrameInfoArray;
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+    RouteCache mRouteCache;
+#endif
 #endif
 
     DataPollSender mDataPollSender;
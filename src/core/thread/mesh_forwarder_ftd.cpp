@@ -415,10 +415,20 @@ Error MeshForwarder::UpdateIp6RouteFtd(const Ip6::Header &aIp6Header, Message &a
     {
         SuccessOrExit(error = Get<AddressResolver>().Resolve(aIp6Header.GetDestination(), mMeshDest));
     }
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+    else if (mRouteCache.Lookup(aIp6Header, mMeshDest) == kErrorNone)
+    {
+        // Destination is off-link and `mMeshDest` is determined
+        // from a previously cached Network Data route lookup.
+    }
+#endif
     else
     {
         SuccessOrExit(error = Get<NetworkData::Leader>().RouteLookup(aIp6Header.GetSource(),
                                                                      aIp6Header.GetDestination(), mMeshDest));
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+        mRouteCache.Add(aIp6Header, mMeshDest);
+#endif
     }
 
     VerifyOrExit(mMeshDest != Mle::kInvalidRloc16, error = kErrorDrop);
@@ -762,6 +772,82 @@ bool MeshForwarder::UpdateFwdFrameInfoArrayOnTimeTick(void)
     return !mFwdFrameInfoArray.IsEmpty();
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// RouteCache
+
+MeshForwarder::RouteCache::RouteCache(void)
+    : mGeneration(1)
+{
+    mCounters.Clear();
+    ClearAllBytes(mEntries);
+}
+
+void MeshForwarder::RouteCache::Invalidate(void)
+{
+    mGeneration++;
+    mCounters.mInvalidations++;
+}
+
+uint16_t MeshForwarder::RouteCache::IndexFor(const Ip6::Header &aIp6Header)
+{
+    // Folds the IIDs of the source and destination addresses into
+    // an index. The IIDs are used since the prefixes are commonly
+    // shared by many flows.
+
+    const uint8_t *srcIid = aIp6Header.GetSource().GetIid().GetBytes();
+    const uint8_t *dstIid = aIp6Header.GetDestination().GetIid().GetBytes();
+    uint16_t       hash   = 0;
+
+    for (uint8_t i = 0; i < Ip6::InterfaceIdentifier::kSize; i += sizeof(uint16_t))
+    {
+        hash = static_cast<uint16_t>((hash << 3) | (hash >> 13));
+        hash ^= BigEndian::ReadUint16(&dstIid[i]) ^ BigEndian::ReadUint16(&srcIid[i]);
+    }
+
+    return hash % kSize;
+}
+
+Error MeshForwarder::RouteCache::Lookup(const Ip6::Header &aIp6Header, uint16_t &aMeshDest)
+{
+    Error        error = kErrorNotFound;
+    const Entry &entry = mEntries[IndexFor(aIp6Header)];
+
+    VerifyOrExit(entry.mGeneration == mGeneration);
+    VerifyOrExit(TimerMilli::GetNow() < entry.mExpireTime);
+    VerifyOrExit(entry.mDestination == aIp6Header.GetDestination());
+    VerifyOrExit(entry.mSource == aIp6Header.GetSource());
+
+    aMeshDest = entry.mMeshDest;
+    error     = kErrorNone;
+
+exit:
+    if (error == kErrorNone)
+    {
+        mCounters.mHits++;
+    }
+    else
+    {
+        mCounters.mMisses++;
+    }
+
+    return error;
+}
+
+void MeshForwarder::RouteCache::Add(const Ip6::Header &aIp6Header, uint16_t aMeshDest)
+{
+    Entry &entry = mEntries[IndexFor(aIp6Header)];
+
+    entry.mSource      = aIp6Header.GetSource();
+    entry.mDestination = aIp6Header.GetDestination();
+    entry.mExpireTime  = TimerMilli::GetNow() + kTimeout;
+    entry.mGeneration  = mGeneration;
+    entry.mMeshDest    = aMeshDest;
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+
 Error MeshForwarder::GetFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                          uint16_t                aSrcRloc16,
                                          Message::Priority      &aPriority)
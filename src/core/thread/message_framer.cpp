@@ -142,42 +142,29 @@ void MessageFramer::PrepareEmptyFrame(Mac::TxFrame &aFrame, const Mac::Address &
     aFrame.SetPayloadLength(0);
 }
 
-uint16_t MessageFramer::PrepareFrame(Mac::TxFrame         &aFrame,
-                                     Message              &aMessage,
-                                     const Mac::Addresses &aMacAddrs,
-                                     bool                  aAddMeshHeader,
-                                     uint16_t              aMeshSource,
-                                     uint16_t              aMeshDest,
-                                     bool                  aAddFragHeader)
+void MessageFramer::PrepareBuildInfo(Mac::TxFrame            &aFrame,
+                                     const Message           &aMessage,
+                                     Mac::TxFrame::BuildInfo &aBuildInfo)
 {
-    Mac::TxFrame::BuildInfo buildInfo;
-    uint16_t                payloadLength;
-    uint16_t                origMsgOffset;
-    uint16_t                nextOffset;
-    FrameBuilder            frameBuilder;
-
-start:
-    buildInfo.Clear();
-
     if (aMessage.IsLinkSecurityEnabled())
     {
-        buildInfo.mSecurityLevel = Mac::Frame::kSecurityEncMic32;
+        aBuildInfo.mSecurityLevel = Mac::Frame::kSecurityEncMic32;
 
         if (aMessage.GetSubType() == Message::kSubTypeJoinerEntrust)
         {
-            buildInfo.mKeyIdMode = Mac::Frame::kKeyIdMode0;
+            aBuildInfo.mKeyIdMode = Mac::Frame::kKeyIdMode0;
         }
         else if (aMessage.IsMleCommand(Mle::kCommandAnnounce))
         {
-            buildInfo.mKeyIdMode = Mac::Frame::kKeyIdMode2;
+            aBuildInfo.mKeyIdMode = Mac::Frame::kKeyIdMode2;
         }
         else
         {
-            buildInfo.mKeyIdMode = Mac::Frame::kKeyIdMode1;
+            aBuildInfo.mKeyIdMode = Mac::Frame::kKeyIdMode1;
         }
     }
 
-    buildInfo.mPanIds.SetBothSourceDestination(Get<Mac::Mac>().GetPanId());
+    aBuildInfo.mPanIds.SetBothSourceDestination(Get<Mac::Mac>().GetPanId());
 
     if (aMessage.IsSubTypeMle())
     {
@@ -186,12 +173,12 @@ start:
         case Mle::kCommandAnnounce:
             aFrame.SetChannel(aMessage.GetChannel());
             aFrame.SetRxChannelAfterTxDone(Get<Mac::Mac>().GetPanChannel());
-            buildInfo.mPanIds.SetDestination(Mac::kPanIdBroadcast);
+            aBuildInfo.mPanIds.SetDestination(Mac::kPanIdBroadcast);
             break;
 
         case Mle::kCommandDiscoveryRequest:
         case Mle::kCommandDiscoveryResponse:
-            buildInfo.mPanIds.SetDestination(aMessage.GetPanId());
+            aBuildInfo.mPanIds.SetDestination(aMessage.GetPanId());
             break;
 
         default:
@@ -199,9 +186,28 @@ start:
         }
     }
 
-    buildInfo.mType  = Mac::Frame::kTypeData;
-    buildInfo.mAddrs = aMacAddrs;
+    aBuildInfo.mType = Mac::Frame::kTypeData;
+}
+
+uint16_t MessageFramer::PrepareFrame(Mac::TxFrame         &aFrame,
+                                     Message              &aMessage,
+                                     const Mac::Addresses &aMacAddrs,
+                                     bool                  aAddMeshHeader,
+                                     uint16_t              aMeshSource,
+                                     uint16_t              aMeshDest,
+                                     bool                  aAddFragHeader)
+{
+    Mac::TxFrame::BuildInfo buildInfo;
+    uint16_t                payloadLength;
+    uint16_t                origMsgOffset;
+    uint16_t                nextOffset;
+    FrameBuilder            frameBuilder;
+    uint8_t                *payload;
 
+start:
+    buildInfo.Clear();
+    buildInfo.mAddrs = aMacAddrs;
+    PrepareBuildInfo(aFrame, aMessage, buildInfo);
     PrepareMacHeaders(aFrame, buildInfo, &aMessage);
 
     frameBuilder.Init(aFrame.GetPayload(), aFrame.GetMaxPayloadLength());
@@ -255,6 +261,8 @@ start:
         uint16_t       maxFrameLength;
         Mac::Addresses macAddrs;
 
+        mFragmentTxState.Clear();
+
         // Before performing lowpan header compression, we reduce the
         // max length on `frameBuilder` to reserve bytes for first
         // fragment header. This ensures that lowpan compression will
@@ -317,6 +325,11 @@ start:
     {
         Lowpan::FragmentHeader::NextFrag nextFragHeader;
 
+        if (!mFragmentTxState.Matches(aMessage))
+        {
+            mFragmentTxState.Clear();
+        }
+
         nextFragHeader.Init(aMessage.GetLength(), static_cast<uint16_t>(aMessage.GetDatagramTag()),
                             aMessage.GetOffset());
         SuccessOrAssert(frameBuilder.Append(nextFragHeader));
@@ -330,7 +343,9 @@ start:
     }
 
     // Copy IPv6 Payload
-    SuccessOrAssert(frameBuilder.AppendBytesFromMessage(aMessage, aMessage.GetOffset(), payloadLength));
+    payload = static_cast<uint8_t *>(frameBuilder.AppendLength(payloadLength));
+    OT_ASSERT(payload != nullptr);
+    aMessage.ReadBytes(aMessage.GetOffset(), payload, payloadLength, mFragmentTxState.GetReadCursor());
     aFrame.SetPayloadLength(frameBuilder.GetLength());
 
     nextOffset = aMessage.GetOffset() + payloadLength;
@@ -341,6 +356,11 @@ start:
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         aMessage.SetTimeSync(false);
 #endif
+        mFragmentTxState.Save(aMessage, nextOffset);
+    }
+    else
+    {
+        mFragmentTxState.Clear();
     }
 
     aMessage.SetOffset(origMsgOffset);
@@ -372,4 +392,33 @@ uint16_t MessageFramer::PrepareMeshFrame(Mac::TxFrame &aFrame, Message &aMessage
 
 #endif // OPENTHREAD_FTD
 
+void MessageFramer::HandleMessageRemoved(const Message &aMessage)
+{
+    if (mFragmentTxState.IsFor(aMessage))
+    {
+        mFragmentTxState.Clear();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// MessageFramer::FragmentTxState
+
+void MessageFramer::FragmentTxState::Clear(void)
+{
+    mMessage    = nullptr;
+    mNextOffset = 0;
+    mReadCursor.Clear();
+}
+
+bool MessageFramer::FragmentTxState::Matches(const Message &aMessage) const
+{
+    return (mMessage == &aMessage) && (mNextOffset == aMessage.GetOffset());
+}
+
+void MessageFramer::FragmentTxState::Save(const Message &aMessage, uint16_t aNextOffset)
+{
+    mMessage    = &aMessage;
+    mNextOffset = aNextOffset;
+}
+
 } // namespace ot
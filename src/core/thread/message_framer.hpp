@@ -107,6 +107,16 @@ public:
                           uint16_t              aMeshDest      = 0,
                           bool                  aAddFragHeader = false);
 
+    /**
+     * Handles the removal of a message which may have been (partially) framed.
+     *
+     * Clears any state kept for preparing the next fragment of @p aMessage. MUST be called before @p aMessage is
+     * freed.
+     *
+     * @param[in] aMessage   The message being removed.
+     */
+    void HandleMessageRemoved(const Message &aMessage);
+
 #if OPENTHREAD_FTD
     /**
      * Prepares a MAC data frame from a given 6LoWPAN Mesh message.
@@ -131,9 +141,37 @@ private:
     // (requiring one hop) and one as additional guard increment.
     static constexpr uint8_t kMeshHeaderHopsLeft = Mle::kMaxRouteCost + 3;
 
+    class FragmentTxState
+    {
+        // Tracks the message whose fragments are being prepared with
+        // a read cursor into the message, so that the payload of the
+        // next fragment is copied continuing from the message buffer
+        // where the previous fragment ended. The MAC headers are
+        // determined again for every fragment. The state is cleared
+        // when the message is removed (see `HandleMessageRemoved()`)
+        // and is only used if the message offset matches the offset
+        // where the previous fragment ended.
+
+    public:
+        FragmentTxState(void) { Clear(); }
+
+        void                 Clear(void);
+        bool                 IsFor(const Message &aMessage) const { return mMessage == &aMessage; }
+        bool                 Matches(const Message &aMessage) const;
+        void                 Save(const Message &aMessage, uint16_t aNextOffset);
+        Message::ReadCursor &GetReadCursor(void) { return mReadCursor; }
+
+    private:
+        const Message      *mMessage;
+        uint16_t            mNextOffset;
+        Message::ReadCursor mReadCursor;
+    };
+
+    void PrepareBuildInfo(Mac::TxFrame &aFrame, const Message &aMessage, Mac::TxFrame::BuildInfo &aBuildInfo);
     void PrepareMacHeaders(Mac::TxFrame &aTxFrame, Mac::TxFrame::BuildInfo &aBuildInfo, const Message *aMessage);
 
-    uint16_t mFragTag;
+    uint16_t        mFragTag;
+    FragmentTxState mFragmentTxState;
 };
 
 } // namespace ot
@@ -775,6 +775,10 @@ void Mle::SetMeshLocalPrefix(const Ip6::NetworkPrefix &aMeshLocalPrefix)
 
     mMeshLocalPrefix = aMeshLocalPrefix;
 
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+    Get<Lowpan::Lowpan>().InvalidateFlowCache();
+#endif
+
     // We ask `ThreadNetif` to apply the new mesh-local prefix which
     // will then update all of its assigned unicast addresses that are
     // marked as mesh-local, as well as all of the subscribed mesh-local
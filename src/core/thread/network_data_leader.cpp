@@ -119,49 +119,44 @@ Error Leader::FindPreferredNat64Prefix(ExternalRouteConfig &aConfig) const
 
 bool Leader::IsNat64(const Ip6::Address &aAddress) const
 {
-    bool                isNat64  = false;
-    Iterator            iterator = kIteratorInit;
-    ExternalRouteConfig routeConfig;
+    uint8_t index = 0;
 
-    while (GetNext(iterator, routeConfig) == kErrorNone)
+    return (FindNextMatchingPrefixTlv(aAddress, PrefixIndex::kFlagNat64, index) != nullptr);
+}
+
+const Leader::PrefixIndex &Leader::GetPrefixIndex(void) const
+{
+    // The index is rebuilt from `SignalNetDataChanged()`. We also
+    // rebuild it here if the Network Data versions or length no
+    // longer match the ones it was built for, e.g., when the Network
+    // Data was updated without being signaled.
+
+    if (!mPrefixIndex.IsBuiltFor(*this))
     {
-        if (routeConfig.mNat64 && routeConfig.GetPrefix().IsValidNat64() &&
-            aAddress.MatchesPrefix(routeConfig.GetPrefix()))
-        {
-            isNat64 = true;
-            break;
-        }
+        AsNonConst(this)->mPrefixIndex.Build(*this);
     }
 
-    return isNat64;
+    return mPrefixIndex;
 }
 
-const PrefixTlv *Leader::FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const
+const PrefixTlv *Leader::FindNextMatchingPrefixTlv(const Ip6::Address &aAddress,
+                                                   PrefixIndex::Flags  aFlags,
+                                                   uint8_t            &aIndex) const
 {
     // This method iterates over Prefix TLVs which match a given IPv6
-    // `aAddress`. If `aPrevTlv` is `nullptr` we start from the
-    // beginning. Otherwise, we search for a match after `aPrevTlv`.
-    // This method returns a pointer to the next matching Prefix TLV
-    // when found, or `nullptr` if no match is found.
-
-    const PrefixTlv *prefixTlv;
-    TlvIterator      tlvIterator((aPrevTlv == nullptr) ? GetTlvsStart() : aPrevTlv->GetNext(), GetTlvsEnd());
-
-    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
-    {
-        if (aAddress.MatchesPrefix(prefixTlv->GetPrefix(), prefixTlv->GetPrefixLength()))
-        {
-            break;
-        }
-    }
+    // `aAddress` and have all the given `aFlags`. `aIndex` tracks
+    // the iteration and must be set to zero to start from the
+    // beginning. This method returns a pointer to the next matching
+    // Prefix TLV when found, or `nullptr` if no match is found.
 
-    return prefixTlv;
+    return GetPrefixIndex().FindNextMatching(*this, aAddress, aFlags, aIndex);
 }
 
 void Leader::FindContextForAddress(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
 {
-    const PrefixTlv  *prefixTlv = nullptr;
+    const PrefixTlv  *prefixTlv;
     const ContextTlv *contextTlv;
+    uint8_t           index = 0;
 
     aContext.Clear();
 
@@ -170,36 +165,28 @@ void Leader::FindContextForAddress(const Ip6::Address &aAddress, Lowpan::Context
         aContext.InitForMeshLocalPrefix(GetInstance());
     }
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
+    while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, PrefixIndex::kFlagContext, index)) != nullptr)
     {
-        contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
-
-        if (contextTlv == nullptr)
+        if (prefixTlv->GetPrefixLength() <= aContext.mPrefix.GetLength())
         {
             continue;
         }
 
-        if (prefixTlv->GetPrefixLength() > aContext.mPrefix.GetLength())
-        {
-            aContext.InitFrom(*prefixTlv, *contextTlv);
-        }
+        contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+        OT_ASSERT(contextTlv != nullptr);
+
+        aContext.InitFrom(*prefixTlv, *contextTlv);
     }
 }
 
 const PrefixTlv *Leader::FindPrefixTlvForContextId(uint8_t aContextId, const ContextTlv *&aContextTlv) const
 {
-    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
-    const PrefixTlv *prefixTlv;
+    const PrefixTlv *prefixTlv = GetPrefixIndex().FindForContextId(*this, aContextId);
 
-    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    if (prefixTlv != nullptr)
     {
-        const ContextTlv *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
-
-        if ((contextTlv != nullptr) && (contextTlv->GetContextId() == aContextId))
-        {
-            aContextTlv = contextTlv;
-            break;
-        }
+        aContextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+        OT_ASSERT(aContextTlv != nullptr);
     }
 
     return prefixTlv;
@@ -229,28 +216,12 @@ exit:
 
 bool Leader::IsOnMesh(const Ip6::Address &aAddress) const
 {
-    const PrefixTlv *prefixTlv = nullptr;
-    bool             isOnMesh  = false;
+    bool    isOnMesh = false;
+    uint8_t index    = 0;
 
     VerifyOrExit(!Get<Mle::Mle>().IsMeshLocalAddress(aAddress), isOnMesh = true);
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
-    {
-        TlvIterator            subTlvIterator(*prefixTlv);
-        const BorderRouterTlv *brTlv;
-
-        while ((brTlv = subTlvIterator.Iterate<BorderRouterTlv>()) != nullptr)
-        {
-            for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
-                 entry                          = entry->GetNext())
-            {
-                if (entry->IsOnMesh())
-                {
-                    ExitNow(isOnMesh = true);
-                }
-            }
-        }
-    }
+    isOnMesh = (FindNextMatchingPrefixTlv(aAddress, PrefixIndex::kFlagOnMesh, index) != nullptr);
 
 exit:
     return isOnMesh;
@@ -258,16 +229,12 @@ exit:
 
 Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
-    Error            error     = kErrorNoRoute;
-    const PrefixTlv *prefixTlv = nullptr;
+    Error            error = kErrorNoRoute;
+    const PrefixTlv *prefixTlv;
+    uint8_t          index = 0;
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
+    while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, PrefixIndex::kFlagBorderRouter, index)) != nullptr)
     {
-        if (prefixTlv->FindSubTlv<BorderRouterTlv>() == nullptr)
-        {
-            continue;
-        }
-
         if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
         {
             ExitNow(error = kErrorNone);
@@ -358,11 +325,12 @@ exit:
 Error Leader::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
     Error                error           = kErrorNoRoute;
-    const PrefixTlv     *prefixTlv       = nullptr;
+    const PrefixTlv     *prefixTlv;
     const HasRouteEntry *bestRouteEntry  = nullptr;
     uint8_t              bestMatchLength = 0;
+    uint8_t              index           = 0;
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aDestination, prefixTlv)) != nullptr)
+    while ((prefixTlv = FindNextMatchingPrefixTlv(aDestination, PrefixIndex::kFlagHasRoute, index)) != nullptr)
     {
         const HasRouteTlv *hasRoute;
         uint8_t            prefixLength = prefixTlv->GetPrefixLength();
@@ -687,7 +655,165 @@ Error Leader::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDiscerner
 void Leader::SignalNetDataChanged(void)
 {
     mMaxLength = Max(mMaxLength, GetLength());
+    mPrefixIndex.Build(*this);
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
+
+#if OPENTHREAD_CONFIG_6LOWPAN_FLOW_CACHE_ENABLE
+    Get<Lowpan::Lowpan>().InvalidateFlowCache();
+#endif
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+    Get<MeshForwarder>().InvalidateRouteCache();
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Leader::PrefixIndex
+
+void Leader::PrefixIndex::Clear(void)
+{
+    mNumEntries    = 0;
+    mLength        = 0;
+    mVersion       = 0;
+    mStableVersion = 0;
+    mIsBuilt       = false;
+    memset(mContextEntries, kNoEntry, sizeof(mContextEntries));
+}
+
+void Leader::PrefixIndex::Build(const Leader &aLeader)
+{
+    TlvIterator      tlvIterator(aLeader.GetTlvsStart(), aLeader.GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+
+    Clear();
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        Entry &entry = mEntries[mNumEntries];
+
+        OT_ASSERT(mNumEntries < kMaxEntries);
+
+        entry.mOffset       = static_cast<uint8_t>(reinterpret_cast<const uint8_t *>(prefixTlv) - aLeader.GetBytes());
+        entry.mPrefixLength = prefixTlv->GetPrefixLength();
+        entry.mFlags        = DetermineFlags(*prefixTlv);
+
+        if (entry.mFlags & kFlagContext)
+        {
+            uint8_t contextId = prefixTlv->FindSubTlv<ContextTlv>()->GetContextId();
+
+            // If multiple Prefix TLVs use the same Context ID, the
+            // first one is used (matching the order of TLVs).
+
+            if (mContextEntries[contextId] == kNoEntry)
+            {
+                mContextEntries[contextId] = mNumEntries;
+            }
+        }
+
+        mNumEntries++;
+    }
+
+    mLength        = aLeader.GetLength();
+    mVersion       = aLeader.mVersion;
+    mStableVersion = aLeader.mStableVersion;
+    mIsBuilt       = true;
+}
+
+bool Leader::PrefixIndex::IsBuiltFor(const Leader &aLeader) const
+{
+    return mIsBuilt && (mVersion == aLeader.mVersion) && (mStableVersion == aLeader.mStableVersion) &&
+           (mLength == aLeader.GetLength());
+}
+
+Leader::PrefixIndex::Flags Leader::PrefixIndex::DetermineFlags(const PrefixTlv &aPrefixTlv)
+{
+    Flags                  flags = 0;
+    TlvIterator            brIterator(aPrefixTlv);
+    TlvIterator            hasRouteIterator(aPrefixTlv);
+    const BorderRouterTlv *brTlv;
+    const HasRouteTlv     *hasRouteTlv;
+
+    if (aPrefixTlv.FindSubTlv<ContextTlv>() != nullptr)
+    {
+        flags |= kFlagContext;
+    }
+
+    while ((brTlv = brIterator.Iterate<BorderRouterTlv>()) != nullptr)
+    {
+        flags |= kFlagBorderRouter;
+
+        for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
+             entry                          = entry->GetNext())
+        {
+            if (entry->IsOnMesh())
+            {
+                flags |= kFlagOnMesh;
+            }
+        }
+    }
+
+    while ((hasRouteTlv = hasRouteIterator.Iterate<HasRouteTlv>()) != nullptr)
+    {
+        flags |= kFlagHasRoute;
+
+        for (const HasRouteEntry *entry = hasRouteTlv->GetFirstEntry(); entry <= hasRouteTlv->GetLastEntry();
+             entry                      = entry->GetNext())
+        {
+            if (entry->IsNat64() && Ip6::Prefix::IsValidNat64PrefixLength(aPrefixTlv.GetPrefixLength()))
+            {
+                flags |= kFlagNat64;
+            }
+        }
+    }
+
+    return flags;
+}
+
+const PrefixTlv *Leader::PrefixIndex::GetPrefixTlv(const NetworkData &aNetworkData, const Entry &aEntry) const
+{
+    return reinterpret_cast<const PrefixTlv *>(aNetworkData.GetBytes() + aEntry.mOffset);
+}
+
+const PrefixTlv *Leader::PrefixIndex::FindNextMatching(const NetworkData  &aNetworkData,
+                                                       const Ip6::Address &aAddress,
+                                                       Flags               aFlags,
+                                                       uint8_t            &aIndex) const
+{
+    const PrefixTlv *prefixTlv = nullptr;
+
+    while (aIndex < mNumEntries)
+    {
+        const Entry     &entry = mEntries[aIndex++];
+        const PrefixTlv *candidate;
+
+        if ((entry.mFlags & aFlags) != aFlags)
+        {
+            continue;
+        }
+
+        candidate = GetPrefixTlv(aNetworkData, entry);
+
+        if (aAddress.MatchesPrefix(candidate->GetPrefix(), entry.mPrefixLength))
+        {
+            prefixTlv = candidate;
+            break;
+        }
+    }
+
+    return prefixTlv;
+}
+
+const PrefixTlv *Leader::PrefixIndex::FindForContextId(const NetworkData &aNetworkData, uint8_t aContextId) const
+{
+    const PrefixTlv *prefixTlv = nullptr;
+
+    VerifyOrExit(aContextId < kNumContextIds);
+    VerifyOrExit(mContextEntries[aContextId] != kNoEntry);
+
+    prefixTlv = GetPrefixTlv(aNetworkData, mEntries[mContextEntries[aContextId]]);
+
+exit:
+    return prefixTlv;
 }
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
@@ -50,6 +50,8 @@
 
 namespace ot {
 
+class UnitTester;
+
 namespace NetworkData {
 
 /**
@@ -68,6 +70,7 @@ class Leader : public MutableNetworkData, private NonCopyable
 {
     friend class Tmf::Agent;
     friend class Notifier;
+    friend class ot::UnitTester;
 
 public:
     /**
@@ -432,8 +435,73 @@ private:
 
     typedef bool (&EntryChecker)(const BorderRouterEntry &aEntry);
 
-    const PrefixTlv *FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
-    const PrefixTlv *FindPrefixTlvForContextId(uint8_t aContextId, const ContextTlv *&aContextTlv) const;
+    class PrefixIndex
+    {
+        // Derived index of the Prefix TLVs in the Network Data. It
+        // tracks the offset and prefix length of each Prefix TLV (in
+        // the same order as in the Network Data) along with flags
+        // summarizing its sub-TLVs, and a map from Context ID to the
+        // Prefix TLV. It is rebuilt whenever the Network Data changes
+        // and allows lookups to skip over non-relevant Prefix TLVs
+        // without parsing their sub-TLVs. The index is keyed on the
+        // Network Data version, stable version, and length it was
+        // built for.
+
+    public:
+        enum Flag : uint8_t
+        {
+            kFlagContext      = 1 << 0, // Has a Context sub-TLV.
+            kFlagBorderRouter = 1 << 1, // Has a Border Router sub-TLV.
+            kFlagOnMesh       = 1 << 2, // Has a Border Router entry with on-mesh flag.
+            kFlagHasRoute     = 1 << 3, // Has a Has Route sub-TLV.
+            kFlagNat64        = 1 << 4, // Has a Has Route entry with NAT64 flag and a valid NAT64 prefix.
+        };
+
+        typedef uint8_t Flags; // Bit-field of `Flag` values.
+
+        PrefixIndex(void) { Clear(); }
+
+        void             Clear(void);
+        void             Build(const Leader &aLeader);
+        bool             IsBuiltFor(const Leader &aLeader) const;
+        const PrefixTlv *FindNextMatching(const NetworkData  &aNetworkData,
+                                          const Ip6::Address &aAddress,
+                                          Flags               aFlags,
+                                          uint8_t            &aIndex) const;
+        const PrefixTlv *FindForContextId(const NetworkData &aNetworkData, uint8_t aContextId) const;
+
+    private:
+        // A Prefix TLV is at least 4 bytes (TLV header, Domain ID and
+        // Prefix Length fields).
+        static constexpr uint8_t kMaxEntries    = kMaxSize / (sizeof(NetworkDataTlv) + 2);
+        static constexpr uint8_t kNumContextIds = 16;
+        static constexpr uint8_t kNoEntry       = NumericLimits<uint8_t>::kMax;
+
+        struct Entry
+        {
+            uint8_t mOffset;
+            uint8_t mPrefixLength;
+            Flags   mFlags;
+        };
+
+        static Flags DetermineFlags(const PrefixTlv &aPrefixTlv);
+
+        const PrefixTlv *GetPrefixTlv(const NetworkData &aNetworkData, const Entry &aEntry) const;
+
+        Entry   mEntries[kMaxEntries];
+        uint8_t mContextEntries[kNumContextIds];
+        uint8_t mNumEntries;
+        uint8_t mLength;
+        uint8_t mVersion;
+        uint8_t mStableVersion;
+        bool    mIsBuilt;
+    };
+
+    const PrefixIndex &GetPrefixIndex(void) const;
+    const PrefixTlv   *FindNextMatchingPrefixTlv(const Ip6::Address &aAddress,
+                                                 PrefixIndex::Flags  aFlags,
+                                                 uint8_t            &aIndex) const;
+    const PrefixTlv   *FindPrefixTlvForContextId(uint8_t aContextId, const ContextTlv *&aContextTlv) const;
 
     int CompareRouteEntries(const BorderRouterEntry &aFirst, const BorderRouterEntry &aSecond) const;
     int CompareRouteEntries(const HasRouteEntry &aFirst, const HasRouteEntry &aSecond) const;
@@ -629,10 +697,11 @@ private:
     using UpdateTimer = TimerMilliIn<Leader, &Leader::HandleTimer>;
 #endif // OPENTHREAD_FTD
 
-    uint8_t mStableVersion;
-    uint8_t mVersion;
-    uint8_t mTlvBuffer[kMaxSize];
-    uint8_t mMaxLength;
+    uint8_t     mStableVersion;
+    uint8_t     mVersion;
+    uint8_t     mTlvBuffer[kMaxSize];
+    uint8_t     mMaxLength;
+    PrefixIndex mPrefixIndex;
 
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
@@ -83,7 +83,14 @@ void Leader::IncrementVersions(const ChangedFlags &aFlags)
 void Leader::IncrementVersions(bool aIncludeStable)
 {
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
-    VerifyOrExit(!mIsClone);
+    if (mIsClone)
+    {
+        // The clone keeps its versions unchanged, so we clear the
+        // prefix index to ensure it is rebuilt on next use.
+
+        mPrefixIndex.Clear();
+        ExitNow();
+    }
 #endif
 
     if (aIncludeStable)
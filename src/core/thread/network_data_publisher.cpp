@@ -962,13 +962,27 @@ void Publisher::PrefixEntry::Publish(const Ip6::Prefix &aPrefix,
 
         VerifyOrExit((mType != aNewType) || (mFlags != aNewFlags) || (mPrefix != aPrefix));
 
-        Remove(/* aNextState */ kNoEntry);
-
         if ((mType == aNewType) && ((oldState == kAdded) || (oldState == kRemoving)))
         {
+            // Replacing the entry is counted as a single Network
+            // Data update by `Add()`. If adding fails, count the
+            // removal on its own.
+
+            RemoveFromNetData();
+            SetState(kNoEntry);
+
             mPrefix = aPrefix;
             mFlags  = aNewFlags;
             Add();
+
+            if (GetState() != kAdded)
+            {
+                CountNetDataUpdate();
+            }
+        }
+        else
+        {
+            Remove(/* aNextState */ kNoEntry);
         }
     }
 
@@ -1015,6 +1029,7 @@ void Publisher::PrefixEntry::Add(void)
     }
 
     Get<Notifier>().HandleServerDataUpdated();
+    CountNetDataUpdate();
     SetState(kAdded);
     Get<Publisher>().NotifyPrefixEntryChange(kEventEntryAdded, mPrefix);
 
@@ -1050,6 +1065,15 @@ void Publisher::PrefixEntry::Remove(State aNextState)
 
     VerifyOrExit((GetState() == kAdded) || (GetState() == kRemoving));
 
+    RemoveFromNetData();
+    CountNetDataUpdate();
+
+exit:
+    SetState(aNextState);
+}
+
+void Publisher::PrefixEntry::RemoveFromNetData(void)
+{
     switch (mType)
     {
     case kTypeOnMeshPrefix:
@@ -1063,9 +1087,16 @@ void Publisher::PrefixEntry::Remove(State aNextState)
 
     Get<Notifier>().HandleServerDataUpdated();
     Get<Publisher>().NotifyPrefixEntryChange(kEventEntryRemoved, mPrefix);
+}
 
-exit:
-    SetState(aNextState);
+void Publisher::PrefixEntry::CountNetDataUpdate(void) const
+{
+#if OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE
+    if (mRequester == kFromRoutingManager)
+    {
+        Get<Ip6::Ip6>().GetBorderRoutingCounters().mNetDataUpdates++;
+    }
+#endif
 }
 
 void Publisher::PrefixEntry::Process(void)
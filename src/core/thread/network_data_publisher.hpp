@@ -530,7 +530,9 @@ private:
         Error AddOnMeshPrefix(void);
         Error AddExternalRoute(void);
         void  Remove(State aNextState);
+        void  RemoveFromNetData(void);
         void  Process(void);
+        void  CountNetDataUpdate(void) const;
         void  CountOnMeshPrefixEntries(uint8_t &aNumEntries, uint8_t &aNumPreferredEntries) const;
         void  CountExternalRouteEntries(uint8_t &aNumEntries, uint8_t &aNumPreferredEntries) const;
 
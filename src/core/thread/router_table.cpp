@@ -916,6 +916,10 @@ void RouterTable::SignalTableChanged(Events aEvents)
 {
     mEvents |= aEvents;
     mChangedTask.Post();
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+    Get<MeshForwarder>().InvalidateRouteCache();
+#endif
 }
 
 void RouterTable::HandleTableChanged(void)
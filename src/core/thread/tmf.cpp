@@ -46,6 +46,9 @@ Agent::Agent(Instance &aInstance)
 {
     SetInterceptor(&Filter, this);
     SetResourceHandler(&HandleResource);
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    SetCongestionControl(mCongestionControl);
+#endif
 }
 
 Error Agent::Start(void) { return Coap::Start(kUdpPort, Ip6::kNetifThreadInternal); }
@@ -62,17 +65,16 @@ template <> void Agent::HandleTmf<kUriRelayRx>(Msg &aMsg)
 #endif
 }
 
-bool Agent::HandleResource(CoapBase &aCoapBase, const char *aUriPath, Msg &aMsg)
+bool Agent::HandleResource(CoapBase &aCoapBase, Uri aUri, Msg &aMsg)
 {
-    return static_cast<Agent &>(aCoapBase).HandleResource(aUriPath, aMsg);
+    return static_cast<Agent &>(aCoapBase).HandleResource(aUri, aMsg);
 }
 
-bool Agent::HandleResource(const char *aUriPath, Msg &aMsg)
+bool Agent::HandleResource(Uri aUri, Msg &aMsg)
 {
     bool didHandle = true;
-    Uri  uri       = UriFromPath(aUriPath);
 
-    if ((uri != kUriUnknown) && !aMsg.IsPostRequest())
+    if ((aUri != kUriUnknown) && !aMsg.IsPostRequest())
     {
         IgnoreError(SendAckResponse(aMsg, ot::Coap::kCodeMethodNotAllowed));
         ExitNow();
@@ -83,7 +85,7 @@ bool Agent::HandleResource(const char *aUriPath, Msg &aMsg)
         Get<Type>().HandleTmf<kUri>(aMsg); \
         break
 
-    switch (uri)
+    switch (aUri)
     {
         Case(kUriAddressError, AddressResolver);
         Case(kUriEnergyScan, EnergyScanServer);
@@ -365,18 +367,17 @@ Coap::SecureSession *SecureAgent::HandleDtlsAccept(void)
 
 #if (OPENTHREAD_FTD && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE) || OPENTHREAD_PLATFORM_NEXUS
 
-bool SecureAgent::HandleResource(CoapBase &aCoapBase, const char *aUriPath, Msg &aMsg)
+bool SecureAgent::HandleResource(CoapBase &aCoapBase, Uri aUri, Msg &aMsg)
 {
-    return static_cast<SecureAgent &>(aCoapBase).HandleResource(aUriPath, aMsg);
+    return static_cast<SecureAgent &>(aCoapBase).HandleResource(aUri, aMsg);
 }
 
-bool SecureAgent::HandleResource(const char *aUriPath, Msg &aMsg)
+bool SecureAgent::HandleResource(Uri aUri, Msg &aMsg)
 {
     bool didHandle = false;
-    Uri  uri       = UriFromPath(aUriPath);
 
 #if (OPENTHREAD_FTD && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE)
-    if (uri == kUriJoinerFinalize)
+    if (aUri == kUriJoinerFinalize)
     {
         Get<MeshCoP::Commissioner>().HandleTmf<kUriJoinerFinalize>(aMsg);
         didHandle = true;
@@ -386,7 +387,7 @@ bool SecureAgent::HandleResource(const char *aUriPath, Msg &aMsg)
 #if OPENTHREAD_PLATFORM_NEXUS
     if (mResourceHandler.IsSet())
     {
-        didHandle = mResourceHandler.Invoke(uri, aMsg);
+        didHandle = mResourceHandler.Invoke(aUri, aMsg);
     }
 #endif
 
@@ -252,6 +252,15 @@ public:
      */
     static Message::Priority DscpToPriority(uint8_t aDscp);
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    /**
+     * Gets the congestion control (per-peer RTO estimation) used by the TMF agent.
+     *
+     * @returns A reference to the congestion control.
+     */
+    const ot::Coap::CongestionControl &GetCongestionControl(void) const { return mCongestionControl; }
+#endif
+
 private:
     template <Uri kUri> void HandleTmf(Msg &aMsg);
 
@@ -261,10 +270,14 @@ private:
                       bool                aAllowMulticastLoop,
                       ResponseHandler     aHandler,
                       void               *aContext);
-    static bool  HandleResource(CoapBase &aCoapBase, const char *aUriPath, Msg &aMsg);
-    bool         HandleResource(const char *aUriPath, Msg &aMsg);
+    static bool  HandleResource(CoapBase &aCoapBase, Uri aUri, Msg &aMsg);
+    bool         HandleResource(Uri aUri, Msg &aMsg);
     static Error Filter(void *aContext, const Msg &aRxMsg);
     Error        Filter(const Msg &aRxMsg) const;
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    ot::Coap::CongestionControl mCongestionControl;
+#endif
 };
 
 #if OPENTHREAD_CONFIG_SECURE_TRANSPORT_ENABLE
@@ -309,8 +322,8 @@ private:
     Coap::SecureSession           *HandleDtlsAccept(void);
 
 #if (OPENTHREAD_FTD && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE) || OPENTHREAD_PLATFORM_NEXUS
-    static bool HandleResource(CoapBase &aCoapBase, const char *aUriPath, Msg &aMsg);
-    bool        HandleResource(const char *aUriPath, Msg &aMsg);
+    static bool HandleResource(CoapBase &aCoapBase, Uri aUri, Msg &aMsg);
+    bool        HandleResource(Uri aUri, Msg &aMsg);
 #endif
 
 #if OPENTHREAD_PLATFORM_NEXUS
@@ -47,8 +47,6 @@ struct Entry
     {
         return AreStringsInOrder(aFirst.mPath, aSecond.mPath);
     }
-
-    int Compare(const char *aPath) const { return strcmp(aPath, mPath); }
 };
 
 #define UriEntryMapList(_)                                        \
@@ -105,8 +103,8 @@ struct Entry
 // macro (`_`). The visitor macro is called for each entry in the list. We define
 // different visitor macros: one to define the `kEntries[]` array, another to
 // validate the entries in the array (ensuring the URI paths match the enum
-// values and are sorted properly), and a third to define the `UriToString()`
-// template specializations.
+// values, are sorted properly and have distinct hash slots), and a third to
+// define the `UriToString()` template specializations.
 
 #define _EntryArrayElement(kPathString, kUri, kName) {kPathString},
 
@@ -115,9 +113,72 @@ static constexpr const Entry kEntries[] = {UriEntryMapList(_EntryArrayElement)};
 // The URI entries MUST be sorted based on their path string (e.g. `c/ut`)
 static_assert(BinarySearch::IsSorted(kEntries), "kEntries is not sorted");
 
-#define _ValidateEntryElement(kPathString, kUri, kName)                    \
-    static_assert(AreConstStringsEqual(kEntries[kUri].mPath, kPathString), \
-                  #kUri " value is incorrect. list is not sorted");
+// `UriFromPath()` uses a perfect hash over the URI path strings. The
+// hash is an xor-multiply over the path characters and its top
+// `kSlotBits` bits select a slot in `SlotTable::kUris[]`, which maps
+// each slot to the `Uri` whose path hashes to it (or `kUriUnknown`).
+// The table is generated at compile time from `kEntries[]`.
+//
+// `kHashMultiplier` is chosen such that no two URI paths map to the
+// same slot. This is verified by `static_assert` for every entry, so
+// if a newly added URI collides, a new multiplier must be picked.
+
+static constexpr uint16_t kHashMultiplier = 4825;
+static constexpr uint8_t  kSlotBits       = 7;
+static constexpr uint16_t kNumSlots       = (1U << kSlotBits);
+
+constexpr uint16_t UpdateHash(uint16_t aHash, char aChar)
+{
+    return static_cast<uint16_t>((aHash ^ static_cast<uint8_t>(aChar)) * kHashMultiplier);
+}
+
+constexpr uint16_t CalculateHash(const char *aPath, uint16_t aHash = 0)
+{
+    return (*aPath == kNullChar) ? aHash : CalculateHash(aPath + 1, UpdateHash(aHash, *aPath));
+}
+
+constexpr uint8_t SlotForHash(uint16_t aHash) { return static_cast<uint8_t>(aHash >> (16 - kSlotBits)); }
+
+constexpr uint8_t SlotForPath(const char *aPath) { return SlotForHash(CalculateHash(aPath)); }
+
+constexpr Uri UriForSlot(uint8_t aSlot, uint8_t aIndex = 0)
+{
+    return (aIndex >= kUriUnknown) ? kUriUnknown
+                                   : ((SlotForPath(kEntries[aIndex].mPath) == aSlot)
+                                          ? static_cast<Uri>(aIndex)
+                                          : UriForSlot(aSlot, static_cast<uint8_t>(aIndex + 1)));
+}
+
+constexpr uint8_t PathLength(const char *aPath)
+{
+    return (*aPath == kNullChar) ? 0 : static_cast<uint8_t>(1 + PathLength(aPath + 1));
+}
+
+template <uint8_t... kSlots> struct SlotTable
+{
+    static constexpr Uri kUris[] = {UriForSlot(kSlots)...};
+};
+
+template <uint8_t... kSlots> constexpr Uri SlotTable<kSlots...>::kUris[];
+
+// `MakeSlotTable<N>` expands to `SlotTable<0, 1, ..., N - 1>`.
+
+template <uint16_t kCount, uint8_t... kSlots>
+struct MakeSlotTable : public MakeSlotTable<kCount - 1, kCount - 1, kSlots...>
+{
+};
+
+template <uint8_t... kSlots> struct MakeSlotTable<0, kSlots...> : public SlotTable<kSlots...>
+{
+};
+
+typedef MakeSlotTable<kNumSlots> UriSlotTable;
+
+#define _ValidateEntryElement(kPathString, kUri, kName)                                                   \
+    static_assert(AreConstStringsEqual(kEntries[kUri].mPath, kPathString),                                \
+                  #kUri " value is incorrect. list is not sorted");                                       \
+    static_assert(UriForSlot(SlotForPath(kPathString)) == kUri, #kUri " path hash collides, update hash"); \
+    static_assert(PathLength(kPathString) <= kMaxUriPathLength, #kUri " path is longer than max");
 
 UriEntryMapList(_ValidateEntryElement)
 
@@ -132,13 +193,21 @@ const char *PathForUri(Uri aUri)
 
 Uri UriFromPath(const char *aPath)
 {
-    Uri                   uri   = kUriUnknown;
-    const UriList::Entry *entry = BinarySearch::Find(aPath, UriList::kEntries);
+    uint16_t hash = 0;
+    Uri      uri;
 
-    VerifyOrExit(entry != nullptr);
-    uri = static_cast<Uri>(entry - UriList::kEntries);
+    for (const char *cur = aPath; *cur != kNullChar; cur++)
+    {
+        hash = UriList::UpdateHash(hash, *cur);
+    }
+
+    uri = UriList::UriSlotTable::kUris[UriList::SlotForHash(hash)];
+
+    if ((uri != kUriUnknown) && !StringMatch(UriList::kEntries[uri].mPath, aPath))
+    {
+        uri = kUriUnknown;
+    }
 
-exit:
     return uri;
 }
 
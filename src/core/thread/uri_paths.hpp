@@ -92,6 +92,8 @@ enum Uri : uint8_t
     kUriUnknown,               ///< Unknown URI
 };
 
+constexpr uint8_t kMaxUriPathLength = 5; ///< Max length of a Thread URI path string (e.g. "b/bmr").
+
 /**
  * Returns URI path string for a given URI.
  *
@@ -104,6 +106,9 @@ const char *PathForUri(Uri aUri);
 /**
  * Looks up the URI from a given path string.
  *
+ * Uses a perfect hash over all Thread URI paths (generated at compile time), so the lookup cost does not depend on
+ * the number of URIs.
+ *
  * @param[in] aPath    A path string.
  *
  * @returns The URI associated with @p aPath or `kUriUnknown` if no match is found.
@@ -162,6 +162,14 @@
 #define OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS 2
 #endif
 
+#ifndef OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS
+#define OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS 1024
+#endif
+
+#ifndef OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE
+#define OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE 1024
+#endif
+
 #ifndef OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
 #define OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_ENABLE
 #endif
@@ -810,6 +810,12 @@ void Core::ProcessRadio(Node &aNode)
                 continue;
             }
 
+            // Randomly drop frames to emulate a lossy link (if configured on `rxNode`)
+            if (rxNode.mRadio.ShouldDropRxFrame())
+            {
+                continue;
+            }
+
             rxFrame.mInfo.mRxInfo.mRssi = ClampToInt8(localRssi);
 
             rxFrame.mInfo.mRxInfo.mLqi = kDefaultRxLqi;
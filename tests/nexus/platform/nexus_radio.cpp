@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstdlib>
+
 #include <openthread/platform/radio.h>
 
 #include "nexus_core.hpp"
@@ -368,6 +370,7 @@ Radio::Radio(void)
     , mSrcMatchEnabled(false)
     , mMacFrameCounterReset(false)
     , mChannel(0)
+    , mRxLossPercent(0)
     , mPanId(0)
     , mShortAddress(Mac::kShortAddrInvalid)
 {
@@ -383,6 +386,7 @@ void Radio::Reset(void)
     mSrcMatchEnabled      = false;
     mMacFrameCounterReset = false;
     mChannel              = 0;
+    mRxLossPercent        = 0;
     mPanId                = 0;
     mShortAddress         = Mac::kShortAddrInvalid;
     mExtAddress.Clear();
@@ -548,6 +552,11 @@ exit:
     return hasPending;
 }
 
+bool Radio::ShouldDropRxFrame(void) const
+{
+    return (mRxLossPercent > 0) && ((static_cast<uint32_t>(rand()) % 100) < mRxLossPercent);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // Radio::Frame
 
@@ -84,6 +84,7 @@ struct Radio
     bool CanReceiveOnChannel(uint8_t aChannel) const;
     bool Matches(const Mac::Address &aAddress, Mac::PanId aPanId) const;
     bool HasFramePendingFor(const Mac::Address &aAddress) const;
+    bool ShouldDropRxFrame(void) const;
 
     Error   ConfigureEnhAckProbing(Mac::ShortAddress      aShortAddress,
                                    const Mac::ExtAddress *aExtAddress,
@@ -95,6 +96,7 @@ struct Radio
     bool                                    mSrcMatchEnabled : 1;
     bool                                    mMacFrameCounterReset : 1;
     uint8_t                                 mChannel;
+    uint8_t                                 mRxLossPercent; // Percentage of received frames randomly dropped.
     Mac::PanId                              mPanId;
     Mac::ShortAddress                       mShortAddress;
     Mac::ExtAddress                         mExtAddress;
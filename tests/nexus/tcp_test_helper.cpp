@@ -0,0 +1,225 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "tcp_test_helper.hpp"
+
+namespace ot {
+namespace Nexus {
+
+// All streams are taken from the same pattern, starting at an offset
+// given by their stream identifier.
+
+static constexpr uint32_t kPatternSize = TcpTestEndpoint::kMaxStreamSize + NumericLimits<uint8_t>::kMax;
+
+static uint8_t sPattern[kPatternSize];
+static bool    sPatternInitialized = false;
+
+static const uint8_t *GetPattern(void)
+{
+    if (!sPatternInitialized)
+    {
+        for (uint32_t i = 0; i < kPatternSize; i++)
+        {
+            sPattern[i] = static_cast<uint8_t>((i * 7) ^ (i >> 8));
+        }
+
+        sPatternInitialized = true;
+    }
+
+    return sPattern;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// TcpTestEndpoint
+
+void TcpTestEndpoint::Setup(Node &aNode, uint8_t aStreamId)
+{
+    otTcpEndpointInitializeArgs args;
+
+    ClearAllBytes(args);
+    args.mEstablishedCallback      = HandleEstablished;
+    args.mSendDoneCallback         = HandleSendDone;
+    args.mReceiveAvailableCallback = HandleReceiveAvailable;
+    args.mDisconnectedCallback     = HandleDisconnected;
+    args.mReceiveBuffer            = mReceiveBuffer;
+    args.mReceiveBufferSize        = sizeof(mReceiveBuffer);
+
+    SuccessOrQuit(Initialize(aNode, args));
+
+    mStreamId     = aStreamId;
+    mNumSendLinks = 0;
+    mNumSent      = 0;
+    mNumReceived  = 0;
+    mNumSendDone  = 0;
+    mEstablished  = false;
+    mAccepted     = false;
+    mEndOfStream  = false;
+    mDataMismatch = false;
+}
+
+void TcpTestEndpoint::SendStream(uint32_t aLength)
+{
+    while (aLength > 0)
+    {
+        uint16_t length = static_cast<uint16_t>(Min<uint32_t>(aLength, kChunkSize));
+
+        VerifyOrQuit(mNumSendLinks < kMaxChunks);
+        VerifyOrQuit(mNumSent + length <= kMaxStreamSize);
+
+        otLinkedBuffer &link = mSendLinks[mNumSendLinks];
+
+        link.mNext   = nullptr;
+        link.mData   = &GetPattern()[mStreamId + mNumSent];
+        link.mLength = length;
+
+        SuccessOrQuit(SendByReference(link, 0));
+
+        mNumSendLinks++;
+        mNumSent += length;
+        aLength -= length;
+    }
+}
+
+void TcpTestEndpoint::HandleEstablished(otTcpEndpoint *aEndpoint) { From(aEndpoint).mEstablished = true; }
+
+void TcpTestEndpoint::HandleSendDone(otTcpEndpoint *aEndpoint, otLinkedBuffer *aData)
+{
+    OT_UNUSED_VARIABLE(aData);
+
+    From(aEndpoint).mNumSendDone++;
+}
+
+void TcpTestEndpoint::HandleReceiveAvailable(otTcpEndpoint *aEndpoint,
+                                             size_t         aBytesAvailable,
+                                             bool           aEndOfStream,
+                                             size_t         aBytesRemaining)
+{
+    TcpTestEndpoint      &endpoint = From(aEndpoint);
+    const uint8_t        *expected = &GetPattern()[endpoint.mStreamId];
+    const otLinkedBuffer *data;
+    size_t                consumed = 0;
+
+    OT_UNUSED_VARIABLE(aBytesAvailable);
+    OT_UNUSED_VARIABLE(aBytesRemaining);
+
+    // Verify the in-order data in place using the references into
+    // the receive buffer, without copying it out first.
+
+    SuccessOrQuit(endpoint.ReceiveByReference(data));
+
+    for (; data != nullptr; data = data->mNext)
+    {
+        for (size_t i = 0; i < data->mLength; i++)
+        {
+            if (endpoint.mNumReceived >= kMaxStreamSize || data->mData[i] != expected[endpoint.mNumReceived])
+            {
+                endpoint.mDataMismatch = true;
+            }
+
+            endpoint.mNumReceived++;
+        }
+
+        consumed += data->mLength;
+    }
+
+    SuccessOrQuit(endpoint.CommitReceive(consumed, 0));
+
+    if (aEndOfStream)
+    {
+        endpoint.mEndOfStream = true;
+    }
+}
+
+void TcpTestEndpoint::HandleDisconnected(otTcpEndpoint *aEndpoint, otTcpDisconnectedReason aReason)
+{
+    OT_UNUSED_VARIABLE(aEndpoint);
+    OT_UNUSED_VARIABLE(aReason);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// TcpTestListener
+
+void TcpTestListener::Setup(Node &aNode, uint16_t aPort)
+{
+    otTcpListenerInitializeArgs args;
+    Ip6::SockAddr               sockAddr;
+
+    ClearAllBytes(args);
+    args.mAcceptReadyCallback = HandleAcceptReady;
+    args.mAcceptDoneCallback  = HandleAcceptDone;
+
+    SuccessOrQuit(Initialize(aNode, args));
+
+    sockAddr.Clear();
+    sockAddr.SetPort(aPort);
+    SuccessOrQuit(Listen(sockAddr));
+
+    mNumAcceptEntries = 0;
+}
+
+void TcpTestListener::AcceptInto(TcpTestEndpoint &aEndpoint, uint16_t aPeerPort)
+{
+    VerifyOrQuit(mNumAcceptEntries < kMaxAcceptEndpoints);
+
+    mAcceptEntries[mNumAcceptEntries].mEndpoint = &aEndpoint;
+    mAcceptEntries[mNumAcceptEntries].mPeerPort = aPeerPort;
+    mNumAcceptEntries++;
+}
+
+otTcpIncomingConnectionAction TcpTestListener::HandleAcceptReady(otTcpListener    *aListener,
+                                                                 const otSockAddr *aPeer,
+                                                                 otTcpEndpoint   **aAcceptInto)
+{
+    TcpTestListener              &listener = From(aListener);
+    otTcpIncomingConnectionAction action   = OT_TCP_INCOMING_CONNECTION_ACTION_REFUSE;
+
+    for (uint8_t i = 0; i < listener.mNumAcceptEntries; i++)
+    {
+        const AcceptEntry &entry = listener.mAcceptEntries[i];
+
+        if ((entry.mPeerPort == 0 || entry.mPeerPort == aPeer->mPort) && entry.mEndpoint->IsClosed())
+        {
+            *aAcceptInto = entry.mEndpoint;
+            action       = OT_TCP_INCOMING_CONNECTION_ACTION_ACCEPT;
+            break;
+        }
+    }
+
+    return action;
+}
+
+void TcpTestListener::HandleAcceptDone(otTcpListener *aListener, otTcpEndpoint *aEndpoint, const otSockAddr *aPeer)
+{
+    OT_UNUSED_VARIABLE(aListener);
+    OT_UNUSED_VARIABLE(aPeer);
+
+    TcpTestEndpoint::From(aEndpoint).mAccepted = true;
+}
+
+} // namespace Nexus
+} // namespace ot
@@ -0,0 +1,155 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OT_NEXUS_TCP_TEST_HELPER_HPP_
+#define OT_NEXUS_TCP_TEST_HELPER_HPP_
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Represents a TCP endpoint used by the nexus TCP tests.
+ *
+ * The endpoint sends a byte stream by reference and validates, in place, that the data it receives matches the
+ * stream of its peer. Each connection uses a stream identifier which offsets the pattern, so data delivered to the
+ * endpoint of another connection is detected.
+ */
+class TcpTestEndpoint : public Ip6::Tcp::Endpoint
+{
+public:
+    static constexpr uint16_t kChunkSize     = 1024;
+    static constexpr uint16_t kMaxChunks     = 32;
+    static constexpr uint32_t kMaxStreamSize = static_cast<uint32_t>(kChunkSize) * kMaxChunks;
+
+    /**
+     * Initializes the endpoint on a given node and clears its counters.
+     *
+     * @param[in] aNode      The node.
+     * @param[in] aStreamId  The stream identifier, which MUST be the same on both ends of a connection.
+     */
+    void Setup(Node &aNode, uint8_t aStreamId);
+
+    /**
+     * Queues the next bytes of the stream, split into send links of up to `kChunkSize` bytes.
+     *
+     * @param[in] aLength  The number of bytes to send.
+     */
+    void SendStream(uint32_t aLength);
+
+    uint32_t GetNumSent(void) const { return mNumSent; }
+    uint32_t GetNumReceived(void) const { return mNumReceived; }
+    uint16_t GetNumSendDone(void) const { return mNumSendDone; }
+    bool     IsEstablished(void) const { return mEstablished; }
+    bool     IsAccepted(void) const { return mAccepted; }
+    bool     IsEndOfStream(void) const { return mEndOfStream; }
+    bool     HasDataMismatch(void) const { return mDataMismatch; }
+
+private:
+    friend class TcpTestListener;
+
+    static TcpTestEndpoint &From(otTcpEndpoint *aEndpoint)
+    {
+        return static_cast<TcpTestEndpoint &>(AsCoreType(aEndpoint));
+    }
+
+    static void HandleEstablished(otTcpEndpoint *aEndpoint);
+    static void HandleSendDone(otTcpEndpoint *aEndpoint, otLinkedBuffer *aData);
+    static void HandleReceiveAvailable(otTcpEndpoint *aEndpoint,
+                                       size_t         aBytesAvailable,
+                                       bool           aEndOfStream,
+                                       size_t         aBytesRemaining);
+    static void HandleDisconnected(otTcpEndpoint *aEndpoint, otTcpDisconnectedReason aReason);
+
+    uint8_t        mReceiveBuffer[OT_TCP_RECEIVE_BUFFER_SIZE_MANY_HOPS];
+    otLinkedBuffer mSendLinks[kMaxChunks];
+    uint8_t        mStreamId;
+    uint8_t        mNumSendLinks;
+    uint32_t       mNumSent;
+    uint32_t       mNumReceived;
+    uint16_t       mNumSendDone;
+    bool           mEstablished;
+    bool           mAccepted;
+    bool           mEndOfStream;
+    bool           mDataMismatch;
+};
+
+/**
+ * Represents a TCP listener used by the nexus TCP tests.
+ *
+ * An incoming connection is accepted into the first registered endpoint that is closed and whose expected peer port
+ * matches, and is refused if there is none.
+ */
+class TcpTestListener : public Ip6::Tcp::Listener
+{
+public:
+    /**
+     * Initializes the listener on a given node and starts listening on a given port.
+     *
+     * @param[in] aNode  The node.
+     * @param[in] aPort  The port to listen on.
+     */
+    void Setup(Node &aNode, uint16_t aPort);
+
+    /**
+     * Registers an endpoint to accept incoming connections into.
+     *
+     * @param[in] aEndpoint  The endpoint.
+     * @param[in] aPeerPort  The expected peer port, or zero to accept from any port.
+     */
+    void AcceptInto(TcpTestEndpoint &aEndpoint, uint16_t aPeerPort = 0);
+
+private:
+    static constexpr uint8_t kMaxAcceptEndpoints = 8;
+
+    struct AcceptEntry
+    {
+        TcpTestEndpoint *mEndpoint;
+        uint16_t         mPeerPort;
+    };
+
+    static TcpTestListener &From(otTcpListener *aListener)
+    {
+        return static_cast<TcpTestListener &>(AsCoreType(aListener));
+    }
+
+    static otTcpIncomingConnectionAction HandleAcceptReady(otTcpListener    *aListener,
+                                                           const otSockAddr *aPeer,
+                                                           otTcpEndpoint   **aAcceptInto);
+    static void HandleAcceptDone(otTcpListener *aListener, otTcpEndpoint *aEndpoint, const otSockAddr *aPeer);
+
+    AcceptEntry mAcceptEntries[kMaxAcceptEndpoints];
+    uint8_t     mNumAcceptEntries;
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // OT_NEXUS_TCP_TEST_HELPER_HPP_
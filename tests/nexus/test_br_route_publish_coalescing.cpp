@@ -0,0 +1,262 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Time to advance for a node to form a network and become leader, in milliseconds.
+ */
+static constexpr uint32_t kFormNetworkTime = 13 * 1000;
+
+/**
+ * Time to advance for the BR to perform automatic actions (RA, Network Data), in milliseconds.
+ */
+static constexpr uint32_t kBrActionTime = 30 * 1000;
+
+/**
+ * Time to advance for a change to be registered with the leader, in milliseconds.
+ */
+static constexpr uint32_t kRegisterTime = 200;
+
+/**
+ * Minimum interval between updates of the published route, in milliseconds.
+ */
+static constexpr uint32_t kMinUpdateInterval = OPENTHREAD_CONFIG_BORDER_ROUTING_ROUTE_PUBLISH_MIN_INTERVAL;
+
+/**
+ * Time between changes while flapping inside the update interval, in milliseconds.
+ */
+static constexpr uint32_t kFlapTime = kMinUpdateInterval / 4;
+
+static_assert(kRegisterTime + 3 * kFlapTime < kMinUpdateInterval, "Flap does not fit in the update interval");
+
+/**
+ * Infrastructure interface index.
+ */
+static constexpr uint32_t kInfraIfIndex = 1;
+
+static const char kGuaPrefix[]     = "2001:db8:1::/64";
+static const char kEthGuaAddress[] = "2001:db8:1::1";
+static const char kDefaultRoute[]  = "::/0";
+static const char kUlaRoute[]      = "fc00::/7";
+
+static bool FindNetDataRoute(Node &aNode, const char *aPrefixStr, NetworkData::ExternalRouteConfig &aConfig)
+{
+    bool                  found    = false;
+    NetworkData::Iterator iterator = NetworkData::kIteratorInit;
+    Ip6::Prefix           prefix;
+
+    SuccessOrQuit(prefix.FromString(aPrefixStr));
+
+    while (aNode.Get<NetworkData::Leader>().GetNext(iterator, aConfig) == kErrorNone)
+    {
+        if (aConfig.GetPrefix() == prefix)
+        {
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+static void VerifyPublishedRoute(Node &aNode, const char *aPrefixStr, NetworkData::RoutePreference aPreference)
+{
+    NetworkData::ExternalRouteConfig config;
+
+    VerifyOrQuit(FindNetDataRoute(aNode, aPrefixStr, config));
+    VerifyOrQuit(config.mPreference == aPreference);
+}
+
+static void VerifyNoPublishedRoute(Node &aNode, const char *aPrefixStr)
+{
+    NetworkData::ExternalRouteConfig config;
+
+    VerifyOrQuit(!FindNetDataRoute(aNode, aPrefixStr, config));
+}
+
+static uint32_t GetNetDataUpdates(Node &aNode)
+{
+    return aNode.Get<Ip6::Ip6>().GetBorderRoutingCounters().mNetDataUpdates;
+}
+
+static uint8_t GetNetDataVersion(Node &aNode)
+{
+    return aNode.Get<NetworkData::Leader>().GetVersion(NetworkData::kFullSet);
+}
+
+void TestBrRoutePublishCoalescing(void)
+{
+    // This test verifies that changes to the route published by the
+    // BR in Network Data are rate limited and coalesced: a change
+    // which is reverted within the minimum update interval does not
+    // change Network Data, and the last of several changes within
+    // the interval is published once the interval passes. It also
+    // checks the `mNetDataUpdates` counter of these changes.
+
+    Core     nexus;
+    uint32_t netDataUpdates;
+    uint8_t  netDataVersion;
+
+    Node &br  = nexus.CreateNode();
+    Node &eth = nexus.CreateNode();
+
+    br.SetName("BR");
+    eth.SetName("Eth");
+
+    nexus.AdvanceTime(0);
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelNote));
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form the network on BR and start the routing manager, BR publishes the ULA route");
+
+    br.Get<BorderRouter::InfraIf>().Init(kInfraIfIndex, true);
+    br.Get<BorderRouter::RoutingManager>().Init();
+    SuccessOrQuit(br.Get<BorderRouter::RoutingManager>().SetEnabled(true));
+
+    br.Form();
+    nexus.AdvanceTime(kFormNetworkTime);
+    VerifyOrQuit(br.Get<Mle::Mle>().IsLeader());
+
+    nexus.AdvanceTime(kBrActionTime);
+
+    VerifyPublishedRoute(br, kUlaRoute, NetworkData::kRoutePreferenceMedium);
+    VerifyNoPublishedRoute(br, kDefaultRoute);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Eth advertises a GUA on-link prefix, BR replaces the ULA route with the default route");
+
+    {
+        Ip6::Address ethGua;
+        Ip6::Prefix  guaPrefix;
+
+        SuccessOrQuit(ethGua.FromString(kEthGuaAddress));
+        SuccessOrQuit(guaPrefix.FromString(kGuaPrefix));
+
+        eth.mInfraIf.AddAddress(ethGua);
+
+        netDataUpdates = GetNetDataUpdates(br);
+        eth.mInfraIf.SendRouterAdvertisement(Ip6::Address::GetLinkLocalAllNodesMulticast(), &guaPrefix, nullptr);
+    }
+
+    nexus.AdvanceTime(kRegisterTime);
+
+    VerifyPublishedRoute(br, kDefaultRoute, NetworkData::kRoutePreferenceMedium);
+    VerifyNoPublishedRoute(br, kUlaRoute);
+
+    // Replacing the route is a single update, the other one sets
+    // the default route flag on the local OMR prefix.
+
+    VerifyOrQuit(GetNetDataUpdates(br) == netDataUpdates + 2);
+
+    nexus.AdvanceTime(kBrActionTime);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Change the route preference to high, which is published immediately");
+
+    netDataUpdates = GetNetDataUpdates(br);
+
+    br.Get<BorderRouter::RoutingManager>().SetRoutePreference(NetworkData::kRoutePreferenceHigh);
+    nexus.AdvanceTime(kRegisterTime);
+
+    VerifyPublishedRoute(br, kDefaultRoute, NetworkData::kRoutePreferenceHigh);
+    VerifyOrQuit(GetNetDataUpdates(br) == netDataUpdates + 1);
+
+    netDataUpdates = GetNetDataUpdates(br);
+    netDataVersion = GetNetDataVersion(br);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Flap the route preference (high -> low -> high) within the update interval");
+
+    nexus.AdvanceTime(kFlapTime);
+    br.Get<BorderRouter::RoutingManager>().SetRoutePreference(NetworkData::kRoutePreferenceLow);
+
+    nexus.AdvanceTime(kFlapTime);
+    VerifyPublishedRoute(br, kDefaultRoute, NetworkData::kRoutePreferenceHigh);
+
+    br.Get<BorderRouter::RoutingManager>().SetRoutePreference(NetworkData::kRoutePreferenceHigh);
+
+    nexus.AdvanceTime(kMinUpdateInterval);
+
+    VerifyPublishedRoute(br, kDefaultRoute, NetworkData::kRoutePreferenceHigh);
+    VerifyOrQuit(GetNetDataVersion(br) == netDataVersion);
+    VerifyOrQuit(GetNetDataUpdates(br) == netDataUpdates);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Change the route preference to low, which is published immediately");
+
+    nexus.AdvanceTime(kBrActionTime);
+
+    br.Get<BorderRouter::RoutingManager>().SetRoutePreference(NetworkData::kRoutePreferenceLow);
+    nexus.AdvanceTime(kRegisterTime);
+
+    VerifyPublishedRoute(br, kDefaultRoute, NetworkData::kRoutePreferenceLow);
+    VerifyOrQuit(GetNetDataUpdates(br) == netDataUpdates + 1);
+
+    netDataUpdates = GetNetDataUpdates(br);
+    netDataVersion = GetNetDataVersion(br);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Change it to medium and then high within the update interval, only high is published");
+    Log("once the interval passes");
+
+    nexus.AdvanceTime(kFlapTime);
+    br.Get<BorderRouter::RoutingManager>().SetRoutePreference(NetworkData::kRoutePreferenceMedium);
+
+    nexus.AdvanceTime(kFlapTime);
+    br.Get<BorderRouter::RoutingManager>().SetRoutePreference(NetworkData::kRoutePreferenceHigh);
+
+    nexus.AdvanceTime(kFlapTime);
+
+    VerifyPublishedRoute(br, kDefaultRoute, NetworkData::kRoutePreferenceLow);
+    VerifyOrQuit(GetNetDataVersion(br) == netDataVersion);
+    VerifyOrQuit(GetNetDataUpdates(br) == netDataUpdates);
+
+    nexus.AdvanceTime(kMinUpdateInterval);
+
+    VerifyPublishedRoute(br, kDefaultRoute, NetworkData::kRoutePreferenceHigh);
+    VerifyOrQuit(GetNetDataVersion(br) != netDataVersion);
+    VerifyOrQuit(GetNetDataUpdates(br) == netDataUpdates + 1);
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestBrRoutePublishCoalescing();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Time to advance for a node to form a network and become leader, in milliseconds.
+ */
+static constexpr uint32_t kFormNetworkTime = 13 * 1000;
+
+/**
+ * Time to advance for a node to join and upgrade to a router, in milliseconds.
+ */
+static constexpr uint32_t kAttachToRouterTime = 200 * 1000;
+
+/**
+ * Time to advance for a node to join as a child, in milliseconds.
+ */
+static constexpr uint32_t kAttachAsChildTime = 10 * 1000;
+
+/**
+ * Time to wait for ICMPv6 Echo response, in milliseconds.
+ */
+static constexpr uint32_t kEchoResponseWaitTime = 5 * 1000;
+
+/**
+ * Time to advance past the 6LoWPAN reassembly timeout, in milliseconds.
+ */
+static constexpr uint32_t kReassemblyTimeoutWaitTime = 10 * 1000;
+
+void TestLowpanReassembly(void)
+{
+    /**
+     * Topology:
+     *
+     *   LEADER --- ROUTER --- FED
+     *
+     * `FED` and `LEADER` exchange large Echo Request/Response messages (requiring 6LoWPAN fragmentation) with each
+     * other over two hops. Validates that all datagrams are reassembled on each receiver using the reassembly table,
+     * and that no reassembly entry is left behind or timed out.
+     */
+
+    static constexpr uint16_t kNumEchoes      = 20;
+    static constexpr uint16_t kPayloadSizes[] = {200, 500, 1000, 1200};
+
+    Core  nexus;
+    Node *nodes[2];
+
+    Node &leader = nexus.CreateNode();
+    Node &router = nexus.CreateNode();
+    Node &fed    = nexus.CreateNode();
+
+    leader.SetName("LEADER");
+    router.SetName("ROUTER");
+    fed.SetName("FED");
+
+    nexus.AdvanceTime(0);
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelNote));
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form the topology");
+
+    AllowLinkBetween(leader, router);
+    AllowLinkBetween(router, fed);
+
+    leader.Form();
+    nexus.AdvanceTime(kFormNetworkTime);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    router.Join(leader);
+    nexus.AdvanceTime(kAttachToRouterTime);
+    VerifyOrQuit(router.Get<Mle::Mle>().IsRouter());
+
+    fed.Join(router, Node::kAsFed);
+    nexus.AdvanceTime(kAttachAsChildTime);
+    VerifyOrQuit(fed.Get<Mle::Mle>().IsChild());
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Send large Echo Requests from FED to LEADER");
+
+    leader.Get<MeshForwarder>().ResetReassemblyCounters();
+    fed.Get<MeshForwarder>().ResetReassemblyCounters();
+
+    for (uint16_t payloadSize : kPayloadSizes)
+    {
+        for (uint16_t i = 0; i < kNumEchoes; i++)
+        {
+            nexus.SendAndVerifyEchoRequest(fed, leader.Get<Mle::Mle>().GetMeshLocalEid(), payloadSize,
+                                           Ip6::kDefaultHopLimit, kEchoResponseWaitTime);
+        }
+    }
+
+    nexus.AdvanceTime(kReassemblyTimeoutWaitTime);
+
+    nodes[0] = &leader;
+    nodes[1] = &fed;
+
+    for (Node *node : nodes)
+    {
+        const MeshForwarder::ReassemblyCounters &counters = node->Get<MeshForwarder>().GetReassemblyCounters();
+
+        Log("Reassembly on %s: reassembled:%lu, timeouts:%lu, evictions:%lu, duplicates:%lu", node->GetName(),
+            ToUlong(counters.mReassembled), ToUlong(counters.mTimeouts), ToUlong(counters.mEvictions),
+            ToUlong(counters.mDuplicates));
+
+        VerifyOrQuit(counters.mReassembled >= GetArrayLength(kPayloadSizes) * kNumEchoes);
+        VerifyOrQuit(counters.mTimeouts == 0);
+        VerifyOrQuit(counters.mEvictions == 0);
+    }
+
+    Log("All tests passed");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestLowpanReassembly();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,237 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "thread/network_data_local.hpp"
+#include "thread/network_data_notifier.hpp"
+
+namespace ot {
+namespace Nexus {
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+
+/**
+ * Time to advance for a node to form a network and become leader, in milliseconds.
+ */
+static constexpr uint32_t kFormNetworkTime = 13 * 1000;
+
+/**
+ * Time to advance for a node to join and upgrade to a router, in milliseconds.
+ */
+static constexpr uint32_t kAttachToRouterTime = 200 * 1000;
+
+/**
+ * Time to advance for the network to stabilize after Network Data changes, in milliseconds.
+ */
+static constexpr uint32_t kStabilizationTime = 20 * 1000;
+
+/**
+ * Time to wait for ICMPv6 Echo response, in milliseconds.
+ */
+static constexpr uint32_t kEchoResponseWaitTime = 2 * 1000;
+
+static void AddPrefix(Node &aNode, const char *aPrefixString)
+{
+    NetworkData::OnMeshPrefixConfig config;
+
+    config.Clear();
+    SuccessOrQuit(config.GetPrefix().FromString(aPrefixString));
+    config.mOnMesh    = true;
+    config.mStable    = true;
+    config.mPreferred = true;
+    config.mSlaac     = true;
+
+    SuccessOrQuit(aNode.Get<NetworkData::Local>().AddOnMeshPrefix(config));
+    aNode.Get<NetworkData::Notifier>().HandleServerDataUpdated();
+}
+
+static void AddExternalRoute(Node &aNode, const char *aPrefixString)
+{
+    NetworkData::ExternalRouteConfig config;
+
+    config.Clear();
+    SuccessOrQuit(config.GetPrefix().FromString(aPrefixString));
+    config.mStable     = true;
+    config.mPreference = NetworkData::kRoutePreferenceMedium;
+
+    SuccessOrQuit(aNode.Get<NetworkData::Local>().AddHasRoutePrefix(config));
+    aNode.Get<NetworkData::Notifier>().HandleServerDataUpdated();
+}
+
+void TestMeshRouteCache(void)
+{
+    /**
+     * Topology (line, 5 hops from `ROUTER_5` to `LEADER`):
+     *
+     *   LEADER --- ROUTER_1 --- ROUTER_2 --- ROUTER_3 --- ROUTER_4 --- ROUTER_5
+     *
+     * `LEADER` acts as a BR, adding an on-mesh SLAAC prefix and an external route, and an address matching the
+     * external route. `ROUTER_5` sends Echo Requests to this off-mesh address, which requires a Network Data route
+     * lookup on `ROUTER_5`. Validates that the route cache serves repeated lookups, that it is invalidated on Network
+     * Data changes, and reports the forwarding throughput.
+     */
+
+    static constexpr uint16_t kNumRouters = 5;
+    static constexpr uint16_t kNumEchoes  = 200;
+
+    Core           nexus;
+    Node          *routers[kNumRouters];
+    otNetifAddress leaderAddr;
+    Ip6::Address   destAddress;
+    uint32_t       numInvalidations;
+
+    Node &leader = nexus.CreateNode();
+
+    leader.SetName("LEADER");
+
+    for (uint16_t i = 0; i < kNumRouters; i++)
+    {
+        routers[i] = &nexus.CreateNode();
+        routers[i]->SetName("ROUTER", i + 1);
+    }
+
+    nexus.AdvanceTime(0);
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelNote));
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form the line topology");
+
+    AllowLinkBetween(leader, *routers[0]);
+
+    for (uint16_t i = 1; i < kNumRouters; i++)
+    {
+        AllowLinkBetween(*routers[i - 1], *routers[i]);
+    }
+
+    leader.Form();
+    nexus.AdvanceTime(kFormNetworkTime);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    routers[0]->Join(leader);
+    nexus.AdvanceTime(kAttachToRouterTime);
+    VerifyOrQuit(routers[0]->Get<Mle::Mle>().IsRouter());
+
+    for (uint16_t i = 1; i < kNumRouters; i++)
+    {
+        routers[i]->Join(*routers[i - 1]);
+        nexus.AdvanceTime(kAttachToRouterTime);
+        VerifyOrQuit(routers[i]->Get<Mle::Mle>().IsRouter());
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Add on-mesh prefix, external route and off-mesh address on LEADER");
+
+    AddPrefix(leader, "fd00:1234::/64");
+    AddExternalRoute(leader, "fd00:abcd::/64");
+
+    ClearAllBytes(leaderAddr);
+    SuccessOrQuit(AsCoreType(&leaderAddr.mAddress).FromString("fd00:abcd::1"));
+    leaderAddr.mPrefixLength  = 64;
+    leaderAddr.mAddressOrigin = OT_ADDRESS_ORIGIN_MANUAL;
+    leaderAddr.mPreferred     = true;
+    leaderAddr.mValid         = true;
+    SuccessOrQuit(otIp6AddUnicastAddress(&leader.GetInstance(), &leaderAddr));
+
+    nexus.AdvanceTime(kStabilizationTime);
+
+    destAddress = AsCoreType(&leaderAddr.mAddress);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Send Echo Requests from ROUTER_5 to the off-mesh address over 5 hops");
+
+    routers[kNumRouters - 1]->Get<MeshForwarder>().ResetRouteCacheCounters();
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t i = 0; i < kNumEchoes; i++)
+        {
+            nexus.SendAndVerifyEchoRequest(*routers[kNumRouters - 1], destAddress, /* aPayloadSize */ 64,
+                                           Ip6::kDefaultHopLimit, kEchoResponseWaitTime);
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        Log("Sent %u echo requests over %u hops in %lu usec (%lu usec per request)", kNumEchoes, kNumRouters,
+            ToUlong(static_cast<uint32_t>(us)), ToUlong(static_cast<uint32_t>(us / kNumEchoes)));
+    }
+
+    {
+        const MeshForwarder::RouteCacheCounters &counters =
+            routers[kNumRouters - 1]->Get<MeshForwarder>().GetRouteCacheCounters();
+
+        Log("Route cache on ROUTER_5: hits:%lu, misses:%lu, invalidations:%lu", ToUlong(counters.mHits),
+            ToUlong(counters.mMisses), ToUlong(counters.mInvalidations));
+
+        // Each Echo Request is routed using the Network Data route
+        // lookup. Allow some misses due to cache invalidation or
+        // entry timeout during the test.
+
+        VerifyOrQuit(counters.mHits > 0);
+        VerifyOrQuit(counters.mHits + counters.mMisses >= kNumEchoes);
+        VerifyOrQuit(counters.mHits >= counters.mMisses);
+
+        numInvalidations = counters.mInvalidations;
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Change Network Data and validate the route cache is invalidated");
+
+    AddExternalRoute(leader, "fd00:beef::/64");
+    nexus.AdvanceTime(kStabilizationTime);
+
+    VerifyOrQuit(routers[kNumRouters - 1]->Get<MeshForwarder>().GetRouteCacheCounters().mInvalidations >
+                 numInvalidations);
+
+    nexus.SendAndVerifyEchoRequest(*routers[kNumRouters - 1], destAddress, /* aPayloadSize */ 64,
+                                   Ip6::kDefaultHopLimit, kEchoResponseWaitTime);
+
+    Log("All tests passed");
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE
+    ot::Nexus::TestMeshRouteCache();
+    printf("All tests passed\n");
+#else
+    printf("OPENTHREAD_CONFIG_MESH_FORWARDER_ROUTE_CACHE_ENABLE is not enabled, test is skipped\n");
+#endif
+    return 0;
+}
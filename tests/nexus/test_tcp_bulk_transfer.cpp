@@ -0,0 +1,180 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "tcp_test_helper.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Time to advance for a node to form a network and become leader, in milliseconds.
+ */
+static constexpr uint32_t kFormNetworkTime = 13 * 1000;
+
+/**
+ * Time to advance for a node to join and upgrade to a router, in milliseconds.
+ */
+static constexpr uint32_t kAttachToRouterTime = 200 * 1000;
+
+/**
+ * Time to advance for the TCP handshake to complete, in milliseconds.
+ */
+static constexpr uint32_t kConnectTime = 5 * 1000;
+
+/**
+ * Time step used while waiting for the bulk transfer to complete, in milliseconds.
+ */
+static constexpr uint32_t kTransferStepTime = 100;
+
+/**
+ * Maximum time to wait for the bulk transfer to complete, in milliseconds.
+ */
+static constexpr uint32_t kMaxTransferTime = 300 * 1000;
+
+static constexpr uint16_t kServerPort      = 5001;
+static constexpr uint32_t kTotalSize       = TcpTestEndpoint::kMaxStreamSize;
+static constexpr uint16_t kNumChunks       = TcpTestEndpoint::kMaxChunks;
+static constexpr uint8_t  kMaxFramesPerSeg = 5;
+static constexpr uint16_t kTimestampOptLen = 12;
+
+static TcpTestEndpoint sClient;
+static TcpTestEndpoint sServer;
+static TcpTestListener sListener;
+
+void TestTcpBulkTransfer(void)
+{
+    /**
+     * Topology:
+     *
+     *   LEADER --- ROUTER
+     *
+     * `LEADER` sends a large amount of data over a TCP connection to `ROUTER`, passing it to the stack as a sequence
+     * of linked buffers. Validates that all data is received intact and in order, and that full-sized segments are
+     * sized to fit within `kMaxFramesPerSeg` 802.15.4 frames after 6LoWPAN compression and fragmentation. Logs the
+     * achieved throughput in simulated time.
+     */
+
+    Core          nexus;
+    Ip6::SockAddr sockAddr;
+    uint32_t      txFramesBefore;
+    uint32_t      txFrames;
+    uint32_t      maxSegments;
+    uint64_t      startTime;
+    uint64_t      duration;
+
+    Node &leader = nexus.CreateNode();
+    Node &router = nexus.CreateNode();
+
+    leader.SetName("LEADER");
+    router.SetName("ROUTER");
+
+    nexus.AdvanceTime(0);
+
+    AllowLinkBetween(leader, router);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form network");
+
+    leader.Form();
+    nexus.AdvanceTime(kFormNetworkTime);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    router.Join(leader);
+    nexus.AdvanceTime(kAttachToRouterTime);
+    VerifyOrQuit(router.Get<Mle::Mle>().IsRouter());
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Open TCP connection from LEADER to ROUTER");
+
+    sListener.Setup(router, kServerPort);
+    sListener.AcceptInto(sServer);
+
+    sServer.Setup(router, 0);
+    sClient.Setup(leader, 0);
+
+    sockAddr.SetAddress(router.Get<Mle::Mle>().GetMeshLocalEid());
+    sockAddr.SetPort(kServerPort);
+    SuccessOrQuit(sClient.Connect(sockAddr, 0));
+    nexus.AdvanceTime(kConnectTime);
+
+    VerifyOrQuit(sClient.IsEstablished());
+    VerifyOrQuit(sServer.IsAccepted());
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Send %lu bytes as %u linked buffers", ToUlong(kTotalSize), kNumChunks);
+
+    txFramesBefore = leader.Get<Mac::Mac>().GetCounters().mTxUnicast;
+    startTime      = nexus.GetNowMicro64();
+
+    sClient.SendStream(kTotalSize);
+    SuccessOrQuit(sClient.SendEndOfStream());
+
+    for (uint32_t elapsed = 0; !sServer.IsEndOfStream(); elapsed += kTransferStepTime)
+    {
+        VerifyOrQuit(elapsed < kMaxTransferTime);
+        nexus.AdvanceTime(kTransferStepTime);
+    }
+
+    duration = nexus.GetNowMicro64() - startTime;
+    txFrames = leader.Get<Mac::Mac>().GetCounters().mTxUnicast - txFramesBefore;
+
+    VerifyOrQuit(!sServer.HasDataMismatch());
+    VerifyOrQuit(sServer.GetNumReceived() == kTotalSize);
+    VerifyOrQuit(sClient.GetNumSendDone() == kNumChunks);
+
+    // Each segment carries at least MSS minus the timestamp option
+    // bytes of data, plus one for the last partial segment and one
+    // for the FIN.
+
+    maxSegments = kTotalSize / (sClient.GetMaxSegmentSize() - kTimestampOptLen) + 2;
+
+    Log("Transferred %lu bytes in %lu ms, throughput %lu bytes/s", ToUlong(kTotalSize),
+        ToUlong(static_cast<uint32_t>(duration / 1000)),
+        ToUlong(static_cast<uint32_t>(kTotalSize * 1000000ull / duration)));
+    Log("MSS %u, LEADER sent %lu frames", sClient.GetMaxSegmentSize(), ToUlong(txFrames));
+
+    VerifyOrQuit(txFrames <= maxSegments * kMaxFramesPerSeg);
+
+    SuccessOrQuit(sClient.Deinitialize());
+    SuccessOrQuit(sServer.Deinitialize());
+    SuccessOrQuit(sListener.Deinitialize());
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestTcpBulkTransfer();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,230 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "tcp_test_helper.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Time to advance for a node to form a network and become leader, in milliseconds.
+ */
+static constexpr uint32_t kFormNetworkTime = 13 * 1000;
+
+/**
+ * Time to advance for a node to join and upgrade to a router, in milliseconds.
+ */
+static constexpr uint32_t kAttachToRouterTime = 200 * 1000;
+
+/**
+ * Time to advance for the TCP handshakes to complete, in milliseconds.
+ */
+static constexpr uint32_t kConnectTime = 5 * 1000;
+
+/**
+ * Time to advance for the data to be exchanged on all connections, in milliseconds.
+ */
+static constexpr uint32_t kExchangeTime = 10 * 1000;
+
+static constexpr uint16_t kServerPort = 5001;
+static constexpr uint16_t kBasePort   = 10000;
+static constexpr uint16_t kDataSize   = 16;
+static constexpr uint8_t  kNumRounds  = 2;
+
+// The endpoint hash combines the two ports and the peer address, and
+// folds the high byte onto the low byte. Client ports which differ
+// only in bits 11-15 therefore map to the same bucket on both nodes,
+// while ports which differ in the low bits map to different ones.
+
+static constexpr uint16_t kNumCollidingConnections = 4;
+static constexpr uint16_t kNumConnections          = kNumCollidingConnections + 3;
+static constexpr uint16_t kCollidingPortStep       = 0x800;
+static constexpr uint16_t kClosedConnection        = 1;
+
+struct Connection
+{
+    TcpTestEndpoint mClient;
+    TcpTestEndpoint mServer;
+    uint16_t        mClientPort;
+};
+
+static Connection      sConnections[kNumConnections];
+static TcpTestListener sListener;
+
+static uint16_t ClientPortFor(uint16_t aIndex)
+{
+    return (aIndex < kNumCollidingConnections) ? (kBasePort + aIndex * kCollidingPortStep)
+                                               : (kBasePort + aIndex - kNumCollidingConnections + 1);
+}
+
+static void SendOnAllConnections(uint8_t aRound)
+{
+    for (uint16_t index = 0; index < kNumConnections; index++)
+    {
+        Connection &connection = sConnections[index];
+
+        if (index == kClosedConnection && aRound > 0)
+        {
+            continue;
+        }
+
+        connection.mClient.SendStream(kDataSize);
+        connection.mServer.SendStream(kDataSize);
+    }
+}
+
+void TestTcpEndpointDemux(void)
+{
+    /**
+     * Topology:
+     *
+     *   LEADER --- ROUTER
+     *
+     * `LEADER` opens several TCP connections to the same port on `ROUTER`. The client ports are chosen so that some
+     * connections fall in the same endpoint hash bucket on both nodes and others do not. Data is exchanged in both
+     * directions and each endpoint validates that it only receives the data of its own connection. One of the
+     * colliding connections is then closed and the exchange is repeated on the remaining ones.
+     */
+
+    Core          nexus;
+    Ip6::SockAddr sockAddr;
+
+    Node &leader = nexus.CreateNode();
+    Node &router = nexus.CreateNode();
+
+    leader.SetName("LEADER");
+    router.SetName("ROUTER");
+
+    nexus.AdvanceTime(0);
+
+    AllowLinkBetween(leader, router);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form network");
+
+    leader.Form();
+    nexus.AdvanceTime(kFormNetworkTime);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    router.Join(leader);
+    nexus.AdvanceTime(kAttachToRouterTime);
+    VerifyOrQuit(router.Get<Mle::Mle>().IsRouter());
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Open %u TCP connections from LEADER to ROUTER", kNumConnections);
+
+    sListener.Setup(router, kServerPort);
+
+    for (uint16_t index = 0; index < kNumConnections; index++)
+    {
+        Connection &connection = sConnections[index];
+
+        // Each connection uses its index as stream identifier so data
+        // delivered to the endpoint of another connection is detected.
+
+        connection.mClientPort = ClientPortFor(index);
+        connection.mServer.Setup(router, static_cast<uint8_t>(index));
+        connection.mClient.Setup(leader, static_cast<uint8_t>(index));
+        sListener.AcceptInto(connection.mServer, connection.mClientPort);
+
+        sockAddr.SetAddress(leader.Get<Mle::Mle>().GetMeshLocalEid());
+        sockAddr.SetPort(connection.mClientPort);
+        SuccessOrQuit(connection.mClient.Bind(sockAddr));
+
+        sockAddr.SetAddress(router.Get<Mle::Mle>().GetMeshLocalEid());
+        sockAddr.SetPort(kServerPort);
+        SuccessOrQuit(connection.mClient.Connect(sockAddr, 0));
+    }
+
+    nexus.AdvanceTime(kConnectTime);
+
+    for (const Connection &connection : sConnections)
+    {
+        VerifyOrQuit(connection.mClient.IsEstablished());
+        VerifyOrQuit(connection.mServer.IsAccepted());
+        VerifyOrQuit(connection.mServer.GetPeerAddress().GetPort() == connection.mClientPort);
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Exchange data on all connections");
+
+    SendOnAllConnections(0);
+    nexus.AdvanceTime(kExchangeTime);
+
+    for (const Connection &connection : sConnections)
+    {
+        VerifyOrQuit(!connection.mClient.HasDataMismatch() && !connection.mServer.HasDataMismatch());
+        VerifyOrQuit(connection.mClient.GetNumReceived() == kDataSize);
+        VerifyOrQuit(connection.mServer.GetNumReceived() == kDataSize);
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Close a colliding connection and exchange data on the others");
+
+    SuccessOrQuit(sConnections[kClosedConnection].mClient.Deinitialize());
+    SuccessOrQuit(sConnections[kClosedConnection].mServer.Deinitialize());
+
+    SendOnAllConnections(1);
+    nexus.AdvanceTime(kExchangeTime);
+
+    for (uint16_t index = 0; index < kNumConnections; index++)
+    {
+        const Connection &connection = sConnections[index];
+        uint32_t          expected   = (index == kClosedConnection) ? kDataSize : kNumRounds * kDataSize;
+
+        VerifyOrQuit(!connection.mClient.HasDataMismatch() && !connection.mServer.HasDataMismatch());
+        VerifyOrQuit(connection.mClient.GetNumReceived() == expected);
+        VerifyOrQuit(connection.mServer.GetNumReceived() == expected);
+    }
+
+    for (uint16_t index = 0; index < kNumConnections; index++)
+    {
+        if (index != kClosedConnection)
+        {
+            SuccessOrQuit(sConnections[index].mClient.Deinitialize());
+            SuccessOrQuit(sConnections[index].mServer.Deinitialize());
+        }
+    }
+
+    SuccessOrQuit(sListener.Deinitialize());
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestTcpEndpointDemux();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,228 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "tcp_test_helper.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Time to advance for a node to form a network and become leader, in milliseconds.
+ */
+static constexpr uint32_t kFormNetworkTime = 13 * 1000;
+
+/**
+ * Time to advance for a node to join and upgrade to a router, in milliseconds.
+ */
+static constexpr uint32_t kAttachToRouterTime = 200 * 1000;
+
+/**
+ * Time to advance for the TCP handshake to complete, in milliseconds.
+ */
+static constexpr uint32_t kConnectTime = 10 * 1000;
+
+/**
+ * Time step used while waiting for a transfer to complete, in milliseconds.
+ */
+static constexpr uint32_t kTransferStepTime = 100;
+
+/**
+ * Maximum time to wait for a transfer to complete, in milliseconds.
+ */
+static constexpr uint32_t kMaxTransferTime = 600 * 1000;
+
+static constexpr uint16_t kServerPort = 5001;
+static constexpr uint32_t kTotalSize  = 16 * 1024;
+
+struct TcpMode
+{
+    const char *mName;
+    bool        mSackEnabled;
+    uint16_t    mDelayedAckTimeout;
+    uint8_t     mAckThinningSegments;
+};
+
+static TcpTestEndpoint sClient;
+static TcpTestEndpoint sServer;
+static TcpTestListener sListener;
+
+static void ApplyTcpMode(Node &aNode, const TcpMode &aMode)
+{
+    Ip6::Tcp &tcp = aNode.Get<Ip6::Tcp>();
+
+    tcp.SetSackEnabled(aMode.mSackEnabled);
+    tcp.SetDelayedAckTimeout(aMode.mDelayedAckTimeout);
+    tcp.SetAckThinningSegments(aMode.mAckThinningSegments);
+}
+
+static void SetLinkLoss(Node **aNodes, uint8_t aNumNodes, uint8_t aLossPercent)
+{
+    for (uint8_t i = 0; i < aNumNodes; i++)
+    {
+        aNodes[i]->mRadio.mRxLossPercent = aLossPercent;
+    }
+}
+
+static void RunTransfer(Core &aNexus, Node &aSender, Node &aReceiver, const TcpMode &aMode, uint8_t aLossPercent)
+{
+    Ip6::SockAddr sockAddr;
+    uint64_t      startTime;
+    uint64_t      duration;
+
+    ApplyTcpMode(aSender, aMode);
+    ApplyTcpMode(aReceiver, aMode);
+
+    sServer.Setup(aReceiver, 0);
+    sClient.Setup(aSender, 0);
+
+    sockAddr.SetAddress(aReceiver.Get<Mle::Mle>().GetMeshLocalEid());
+    sockAddr.SetPort(kServerPort);
+    SuccessOrQuit(sClient.Connect(sockAddr, 0));
+    aNexus.AdvanceTime(kConnectTime);
+
+    VerifyOrQuit(sClient.IsEstablished());
+    VerifyOrQuit(sServer.IsAccepted());
+
+    startTime = aNexus.GetNowMicro64();
+
+    sClient.SendStream(kTotalSize);
+    SuccessOrQuit(sClient.SendEndOfStream());
+
+    for (uint32_t elapsed = 0; !sServer.IsEndOfStream(); elapsed += kTransferStepTime)
+    {
+        VerifyOrQuit(elapsed < kMaxTransferTime);
+        aNexus.AdvanceTime(kTransferStepTime);
+    }
+
+    duration = aNexus.GetNowMicro64() - startTime;
+
+    VerifyOrQuit(!sServer.HasDataMismatch());
+    VerifyOrQuit(sServer.GetNumReceived() == kTotalSize);
+
+    Log("%-16s loss %2u%%: %lu bytes in %6lu ms, goodput %5lu bytes/s", aMode.mName, aLossPercent,
+        ToUlong(kTotalSize), ToUlong(static_cast<uint32_t>(duration / 1000)),
+        ToUlong(static_cast<uint32_t>(kTotalSize * 1000000ull / duration)));
+
+    SuccessOrQuit(sClient.Deinitialize());
+    SuccessOrQuit(sServer.Deinitialize());
+}
+
+void TestTcpLossyLink(void)
+{
+    /**
+     * Topology:
+     *
+     *   LEADER --- ROUTER_1 --- ROUTER_2
+     *
+     * `LEADER` sends a stream of data over TCP to `ROUTER_2` (two hops away) while every node randomly drops a
+     * configurable percentage of the frames it receives (on top of which MAC retransmissions apply). The transfer is
+     * repeated with SACK disabled and enabled, and with different delayed ACK and ACK thinning settings. Validates
+     * that all data is received intact and in order, and logs the achieved goodput for each combination.
+     */
+
+    static constexpr uint8_t kLossPercents[] = {0, 10, 25};
+
+    static const TcpMode kModes[] = {
+        {"no-sack", false, 100, 2},
+        {"sack", true, 100, 2},
+        {"sack+no-delack", true, 0, 1},
+        {"sack+thin-4", true, 200, 4},
+    };
+
+    Core  nexus;
+    Node *nodes[3];
+
+    Node &leader  = nexus.CreateNode();
+    Node &router1 = nexus.CreateNode();
+    Node &router2 = nexus.CreateNode();
+
+    leader.SetName("LEADER");
+    router1.SetName("ROUTER_1");
+    router2.SetName("ROUTER_2");
+
+    nodes[0] = &leader;
+    nodes[1] = &router1;
+    nodes[2] = &router2;
+
+    nexus.AdvanceTime(0);
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelNote));
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form the topology");
+
+    AllowLinkBetween(leader, router1);
+    AllowLinkBetween(router1, router2);
+
+    leader.Form();
+    nexus.AdvanceTime(kFormNetworkTime);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    router1.Join(leader);
+    nexus.AdvanceTime(kAttachToRouterTime);
+    VerifyOrQuit(router1.Get<Mle::Mle>().IsRouter());
+
+    router2.Join(router1);
+    nexus.AdvanceTime(kAttachToRouterTime);
+    VerifyOrQuit(router2.Get<Mle::Mle>().IsRouter());
+
+    sListener.Setup(router2, kServerPort);
+    sListener.AcceptInto(sServer);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Send %lu bytes from LEADER to ROUTER_2 over lossy links", ToUlong(kTotalSize));
+
+    for (uint8_t lossPercent : kLossPercents)
+    {
+        for (const TcpMode &mode : kModes)
+        {
+            SetLinkLoss(nodes, GetArrayLength(nodes), lossPercent);
+            RunTransfer(nexus, leader, router2, mode, lossPercent);
+
+            // Let the network settle without loss before the next run.
+            SetLinkLoss(nodes, GetArrayLength(nodes), 0);
+            nexus.AdvanceTime(kConnectTime);
+        }
+    }
+
+    SuccessOrQuit(sListener.Deinitialize());
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestTcpLossyLink();
+    printf("All tests passed\n");
+    return 0;
+}
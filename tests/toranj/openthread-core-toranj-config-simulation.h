@@ -51,10 +51,14 @@
 
 #define OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE 1
 
+#define OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE 1
+
 #define OPENTHREAD_CONFIG_COAP_API_ENABLE 1
 
 #define OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE 1
 
+#define OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE 1
+
 #define OPENTHREAD_CONFIG_DNS_CLIENT_BIND_UDP_TO_THREAD_NETIF 1
 
 #define OPENTHREAD_CONFIG_JOINER_MAX_CANDIDATES 8
@@ -101,6 +105,16 @@
 
 #define OPENTHREAD_CONFIG_DNSSD_DISCOVERY_PROXY_ENABLE OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE 1
+
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 1
+
+#define OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE 1
+
+#define OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE 1
+
+#define OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE 1
+
 #define OPENTHREAD_CONFIG_PLATFORM_TCP_ENABLE 1
 
 #define OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE 1
@@ -418,6 +418,85 @@ void TestUdp4MessageChecksum(void)
     }
 }
 
+void TestChecksumDelta(void)
+{
+    // Verifies that updating a UDP checksum incrementally using
+    // `Checksum::Delta` (pseudo-header changed from IPv6 to IPv4
+    // addresses and a new source port) gives the same result as a
+    // full calculation over the translated message.
+
+    constexpr uint16_t kMinSize = sizeof(Ip4::UdpHeader);
+    constexpr uint16_t kMaxSize = 1000;
+
+    Ip6::Address ip6Source;
+    Ip6::Address ip6Dest;
+    Ip4::Address ip4Source;
+    Ip4::Address ip4Dest;
+
+    Instance *instance = static_cast<Instance *>(testInitInstance());
+
+    VerifyOrQuit(instance != nullptr);
+
+    SuccessOrQuit(ip6Source.FromString("fd00:1234::abcd"));
+    SuccessOrQuit(ip6Dest.FromString("64:ff9b::5741:2b15"));
+    SuccessOrQuit(ip4Source.FromString("12.34.56.78"));
+    SuccessOrQuit(ip4Dest.FromString("87.65.43.21"));
+
+    for (uint16_t size = kMinSize; size <= kMaxSize; size++)
+    {
+        Message        *message = instance->Get<Ip6::Ip6>().NewMessage();
+        Ip4::UdpHeader  udpHeader;
+        Checksum::Delta delta;
+        uint16_t        ip6Checksum;
+        uint16_t        oldPort;
+        uint16_t        newPort;
+
+        VerifyOrQuit(message != nullptr, "Ip6::NewMesssage() failed");
+        SuccessOrQuit(message->SetLength(size));
+
+        Random::NonCrypto::Fill(udpHeader);
+        udpHeader.SetChecksum(0);
+        message->Write(0, udpHeader);
+
+        if (size > sizeof(udpHeader))
+        {
+            uint8_t  buffer[kMaxSize];
+            uint16_t payloadSize = size - sizeof(udpHeader);
+
+            Random::NonCrypto::FillBuffer(buffer, payloadSize);
+            message->WriteBytes(sizeof(udpHeader), &buffer[0], payloadSize);
+        }
+
+        Checksum::UpdateMessageChecksum(*message, ip6Source, ip6Dest, Ip6::kProtoUdp);
+        SuccessOrQuit(message->Read(0, udpHeader));
+        ip6Checksum = udpHeader.GetChecksum();
+        oldPort     = udpHeader.GetSourcePort();
+
+        // Translate the message and calculate its checksum fully.
+
+        newPort = Random::NonCrypto::Generate<uint16_t>();
+        udpHeader.SetSourcePort(newPort);
+        udpHeader.SetChecksum(0);
+        message->Write(0, udpHeader);
+
+        Checksum::UpdateMessageChecksum(*message, ip4Source, ip4Dest, Ip4::kProtoUdp);
+        SuccessOrQuit(message->Read(0, udpHeader));
+        VerifyOrQuit(CalculateChecksum(ip4Source, ip4Dest, Ip4::kProtoUdp, *message) == 0xffff);
+
+        // Verify the incrementally updated checksum.
+
+        delta.Remove(ip6Source);
+        delta.Remove(ip6Dest);
+        delta.Add(ip4Source);
+        delta.Add(ip4Dest);
+        delta.ReplaceUint16(oldPort, newPort);
+
+        VerifyOrQuit(delta.ApplyTo(ip6Checksum) == udpHeader.GetChecksum());
+
+        message->Free();
+    }
+}
+
 void TestIcmp4MessageChecksum(void)
 {
     // A captured ICMP echo request (ping) message. Checksum field is set to zero.
@@ -535,6 +614,7 @@ int main(void)
     ot::TestTcp4MessageChecksum();
     ot::TestUdp4MessageChecksum();
     ot::TestIcmp4MessageChecksum();
+    ot::TestChecksumDelta();
 #if OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE
     ot::TestVerhoeffChecksum();
 #endif
@@ -0,0 +1,962 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+
+#include "coap/coap.hpp"
+#include "common/message.hpp"
+#include "instance/instance.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static uint32_t sNow = 0;
+static uint32_t sAlarmTime;
+static bool     sAlarmOn = false;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+static void AdvanceTime(Instance &aInstance, uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        sNow     = sAlarmTime;
+        sAlarmOn = false;
+        otPlatAlarmMilliFired(&aInstance);
+    }
+
+    sNow = time;
+}
+
+static constexpr uint16_t kNumRequests = 120; // More than the pending requests index can hold.
+static constexpr uint16_t kNumPeers    = 7;
+static constexpr uint16_t kPeerPort    = 5683;
+
+// Number of pending requests the index can hold (three quarters of its slots).
+static constexpr uint16_t kNumIndexedRequests = OPENTHREAD_CONFIG_COAP_PENDING_REQUESTS_INDEX_SIZE * 3 / 4;
+
+static_assert(kNumIndexedRequests < kNumRequests, "kNumRequests must exceed the pending requests index capacity");
+
+struct TxInfo
+{
+    uint16_t    mNumTx;
+    Coap::Type  mType;
+    uint8_t     mCode;
+    uint16_t    mMessageId;
+    Coap::Token mToken;
+};
+
+struct RequestContext
+{
+    Ip6::MessageInfo mMessageInfo;
+    uint16_t         mMessageId;
+    Coap::Token      mToken;
+    uint16_t         mNumResponses;
+    Error            mResult;
+};
+
+static TxInfo         sTxInfo;
+static RequestContext sRequests[kNumRequests];
+static uint16_t       sNumHandledRequests;
+
+class TestCoap : public Coap::CoapBase
+{
+public:
+    explicit TestCoap(Instance &aInstance)
+        : CoapBase(aInstance, Transmit)
+    {
+    }
+
+    using CoapBase::Receive;
+    using CoapBase::SetResourceHandler;
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    using CoapBase::SetCongestionControl;
+#endif
+
+private:
+    static Error Transmit(CoapBase &aCoapBase, ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        Coap::HeaderInfo headerInfo;
+
+        OT_UNUSED_VARIABLE(aCoapBase);
+        OT_UNUSED_VARIABLE(aMessageInfo);
+
+        SuccessOrQuit(AsCoapMessage(&aMessage).ParseHeaderInfo(headerInfo));
+
+        sTxInfo.mNumTx++;
+        sTxInfo.mType      = headerInfo.GetType();
+        sTxInfo.mCode      = headerInfo.GetCode();
+        sTxInfo.mMessageId = headerInfo.GetMessageId();
+        sTxInfo.mToken     = headerInfo.GetToken();
+
+        aMessage.Free();
+
+        return kErrorNone;
+    }
+};
+
+static void HandleResponse(void *aContext, Coap::Msg *aMsg, Error aResult)
+{
+    RequestContext &request = *static_cast<RequestContext *>(aContext);
+
+    request.mNumResponses++;
+    request.mResult = aResult;
+
+    if (aMsg != nullptr)
+    {
+        VerifyOrQuit(aMsg->GetToken() == request.mToken);
+    }
+}
+
+static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    TestCoap      &coap = *static_cast<TestCoap *>(aContext);
+    Coap::Message *response;
+
+    sNumHandledRequests++;
+
+    response = coap.NewMessage();
+    VerifyOrQuit(response != nullptr);
+
+    SuccessOrQuit(response->InitAsResponse(Coap::kTypeAck, Coap::kCodeChanged, AsCoapMessage(aMessage)));
+    SuccessOrQuit(coap.SendMessage(*response, AsCoreType(aMessageInfo)));
+}
+
+static void PreparePeerMessageInfo(Ip6::MessageInfo &aMessageInfo, uint16_t aPeerIndex)
+{
+    aMessageInfo.Clear();
+    SuccessOrQuit(aMessageInfo.GetPeerAddr().FromString("fd00::1"));
+    aMessageInfo.GetPeerAddr().mFields.m8[15] = static_cast<uint8_t>(aPeerIndex + 1);
+    aMessageInfo.SetPeerPort(kPeerPort);
+    SuccessOrQuit(aMessageInfo.GetSockAddr().FromString("fd00::abcd"));
+    aMessageInfo.SetSockPort(kPeerPort);
+}
+
+static void ReceiveMessage(Instance          &aInstance,
+                           TestCoap          &aCoap,
+                           Coap::Type         aType,
+                           Coap::Code         aCode,
+                           uint16_t           aMessageId,
+                           const Coap::Token &aToken,
+                           const Ip6::MessageInfo &aMessageInfo)
+{
+    Coap::Message *message = AsCoapMessagePtr(aInstance.Get<MessagePool>().Allocate(Message::kTypeOther));
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->Init(aType, aCode, aMessageId));
+    SuccessOrQuit(message->WriteToken(aToken));
+
+    if (aCode == Coap::kCodePost)
+    {
+        SuccessOrQuit(message->AppendUriPathOptions("t"));
+    }
+
+    aCoap.Receive(*message, aMessageInfo);
+    message->Free();
+}
+
+static void SendRequest(TestCoap &aCoap, RequestContext &aRequest, uint16_t aPeerIndex)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->Init(Coap::kTypeConfirmable, Coap::kCodePost));
+    SuccessOrQuit(message->WriteRandomToken(Coap::Token::kDefaultLength));
+    SuccessOrQuit(message->AppendUriPathOptions("t"));
+
+    PreparePeerMessageInfo(aRequest.mMessageInfo, aPeerIndex);
+    aRequest.mNumResponses = 0;
+
+    SuccessOrQuit(aCoap.SendMessage(*message, aRequest.mMessageInfo, HandleResponse, &aRequest));
+}
+
+static void SaveTxInfo(RequestContext &aRequest)
+{
+    VerifyOrQuit(sTxInfo.mType == Coap::kTypeConfirmable);
+    aRequest.mMessageId = sTxInfo.mMessageId;
+    aRequest.mToken     = sTxInfo.mToken;
+}
+
+static void SendRequests(TestCoap &aCoap, uint16_t aNumRequests = kNumRequests)
+{
+    for (uint16_t index = 0; index < aNumRequests; index++)
+    {
+        SendRequest(aCoap, sRequests[index], index % kNumPeers);
+        SaveTxInfo(sRequests[index]);
+    }
+}
+
+void TestCoapPendingRequests(void)
+{
+    Instance        *instance;
+    TestCoap        *coap;
+    Ip6::MessageInfo otherPeer;
+    uint16_t         numTx;
+
+    printf("TestCoapPendingRequests()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    coap = new TestCoap(*instance);
+
+    sTxInfo.mNumTx = 0;
+    SendRequests(*coap);
+    VerifyOrQuit(sTxInfo.mNumTx == kNumRequests);
+
+    // Acks matching the message ID but from a different peer or with
+    // an unknown message ID must not match any request.
+
+    PreparePeerMessageInfo(otherPeer, kNumPeers);
+    ReceiveMessage(*instance, *coap, Coap::kTypeAck, Coap::kCodeChanged, sRequests[0].mMessageId, sRequests[0].mToken,
+                   otherPeer);
+    ReceiveMessage(*instance, *coap, Coap::kTypeAck, Coap::kCodeChanged, sRequests[0].mMessageId + kNumRequests,
+                   sRequests[0].mToken, sRequests[0].mMessageInfo);
+    VerifyOrQuit(sRequests[0].mNumResponses == 0);
+
+    // First half: piggybacked responses (matched by message ID),
+    // received in reverse order.
+
+    for (uint16_t index = kNumRequests / 2; index > 0; index--)
+    {
+        RequestContext &request = sRequests[index - 1];
+
+        ReceiveMessage(*instance, *coap, Coap::kTypeAck, Coap::kCodeChanged, request.mMessageId, request.mToken,
+                       request.mMessageInfo);
+        VerifyOrQuit(request.mNumResponses == 1);
+        VerifyOrQuit(request.mResult == kErrorNone);
+    }
+
+    // Second half: empty ack (matched by message ID) followed by a
+    // separate confirmable response (matched by token).
+
+    for (uint16_t index = kNumRequests / 2; index < kNumRequests; index++)
+    {
+        RequestContext &request = sRequests[index];
+        Coap::Token     emptyToken;
+
+        emptyToken.Clear();
+
+        ReceiveMessage(*instance, *coap, Coap::kTypeAck, Coap::kCodeEmpty, request.mMessageId, emptyToken,
+                       request.mMessageInfo);
+        VerifyOrQuit(request.mNumResponses == 0);
+    }
+
+    for (uint16_t index = kNumRequests; index > kNumRequests / 2; index--)
+    {
+        RequestContext &request = sRequests[index - 1];
+
+        numTx = sTxInfo.mNumTx;
+        ReceiveMessage(*instance, *coap, Coap::kTypeConfirmable, Coap::kCodeChanged, 0x7000 + index, request.mToken,
+                       request.mMessageInfo);
+        VerifyOrQuit(request.mNumResponses == 1);
+        VerifyOrQuit(request.mResult == kErrorNone);
+
+        // The separate response is acked.
+        VerifyOrQuit(sTxInfo.mNumTx == numTx + 1);
+        VerifyOrQuit(sTxInfo.mType == Coap::kTypeAck);
+    }
+
+    for (const RequestContext &request : sRequests)
+    {
+        VerifyOrQuit(request.mNumResponses == 1);
+    }
+
+    // Send again and abort all, to check all pending requests are
+    // finalized and removed.
+
+    SendRequests(*coap);
+    coap->ClearAllRequestsAndResponses();
+
+    for (const RequestContext &request : sRequests)
+    {
+        VerifyOrQuit(request.mNumResponses == 1);
+        VerifyOrQuit(request.mResult == kErrorAbort);
+    }
+
+    delete coap;
+    testFreeInstance(instance);
+}
+
+void TestCoapResponseCache(void)
+{
+    static constexpr uint16_t kNumPeerRequests = 3;
+
+    Instance        *instance;
+    TestCoap        *coap;
+    Ip6::MessageInfo messageInfo;
+    Coap::Token      token;
+    uint16_t         numTx;
+    const uint8_t    kTokenBytes[] = {0x12, 0x34, 0x56, 0x78};
+
+    printf("TestCoapResponseCache()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    coap = new TestCoap(*instance);
+    coap->SetDefaultHandler(HandleRequest, coap);
+
+    SuccessOrQuit(token.SetToken(kTokenBytes, sizeof(kTokenBytes)));
+
+    // Receive requests from different peers all using the same
+    // message IDs.
+
+    sTxInfo.mNumTx      = 0;
+    sNumHandledRequests = 0;
+
+    for (uint16_t peer = 0; peer < kNumPeers; peer++)
+    {
+        PreparePeerMessageInfo(messageInfo, peer);
+
+        for (uint16_t id = 1; id <= kNumPeerRequests; id++)
+        {
+            ReceiveMessage(*instance, *coap, Coap::kTypeConfirmable, Coap::kCodePost, id, token, messageInfo);
+        }
+    }
+
+    VerifyOrQuit(sNumHandledRequests == kNumPeers * kNumPeerRequests);
+    VerifyOrQuit(sTxInfo.mNumTx == kNumPeers * kNumPeerRequests);
+
+    // Retransmitted requests from the last peers (still in the cache)
+    // are answered from the cache without invoking the handler.
+
+    for (uint16_t peer = kNumPeers - 2; peer < kNumPeers; peer++)
+    {
+        PreparePeerMessageInfo(messageInfo, peer);
+
+        for (uint16_t id = 1; id <= kNumPeerRequests; id++)
+        {
+            numTx = sTxInfo.mNumTx;
+            ReceiveMessage(*instance, *coap, Coap::kTypeConfirmable, Coap::kCodePost, id, token, messageInfo);
+            VerifyOrQuit(sTxInfo.mNumTx == numTx + 1);
+            VerifyOrQuit(sTxInfo.mType == Coap::kTypeAck);
+            VerifyOrQuit(sTxInfo.mMessageId == id);
+        }
+    }
+
+    VerifyOrQuit(sNumHandledRequests == kNumPeers * kNumPeerRequests);
+
+    coap->ClearAllRequestsAndResponses();
+
+    delete coap;
+    testFreeInstance(instance);
+}
+
+static void RunMatchingBenchmark(Instance &aInstance, uint16_t aNumRequests, uint16_t aNumRounds)
+{
+    TestCoap *coap    = new TestCoap(aInstance);
+    uint64_t  totalUs = 0;
+
+    for (uint16_t round = 0; round < aNumRounds; round++)
+    {
+        SendRequests(*coap, aNumRequests);
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t index = aNumRequests; index > 0; index--)
+        {
+            RequestContext &request = sRequests[index - 1];
+
+            ReceiveMessage(aInstance, *coap, Coap::kTypeAck, Coap::kCodeChanged, request.mMessageId, request.mToken,
+                           request.mMessageInfo);
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        totalUs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+        for (uint16_t index = 0; index < aNumRequests; index++)
+        {
+            VerifyOrQuit(sRequests[index].mNumResponses == 1);
+        }
+    }
+
+    printf("  Matched %u responses against %u pending requests in %llu usec\n", aNumRounds * aNumRequests,
+           aNumRequests, static_cast<unsigned long long>(totalUs));
+
+    delete coap;
+}
+
+void TestCoapMatchingBenchmark(void)
+{
+    // The first run keeps all pending requests in the index, the
+    // second one overflows it so that part of the requests are
+    // matched by scanning the queue.
+
+    static constexpr uint16_t kNumRounds = 20;
+
+    Instance *instance;
+
+    printf("TestCoapMatchingBenchmark()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    RunMatchingBenchmark(*instance, kNumIndexedRequests, kNumRounds * kNumRequests / kNumIndexedRequests);
+    RunMatchingBenchmark(*instance, kNumRequests, kNumRounds);
+
+    testFreeInstance(instance);
+}
+
+static const char *const kUnknownPaths[] = {
+    "", "a", "a/", "/a/ae", "a/a", "a/aex", "A/AE", "a/ea", "b/bm", "b/bmr/x", "c/zz", "z/ae", "coap/resource",
+};
+
+static void AppendUriPath(Coap::Message &aMessage, const char *aUriPath)
+{
+    if (aUriPath[0] != kNullChar)
+    {
+        SuccessOrQuit(aMessage.AppendUriPathOptions(aUriPath));
+    }
+}
+
+static Coap::Message *NewRequestWithPath(Instance &aInstance, uint16_t aMessageId, const char *aUriPath)
+{
+    Coap::Message *message = AsCoapMessagePtr(aInstance.Get<MessagePool>().Allocate(Message::kTypeOther));
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->Init(Coap::kTypeConfirmable, Coap::kCodePost, aMessageId));
+    AppendUriPath(*message, aUriPath);
+
+    return message;
+}
+
+void TestUriPaths(void)
+{
+    Instance      *instance;
+    Coap::Message *message;
+    Uri            uri;
+
+    printf("TestUriPaths()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    for (uint8_t index = 0; index < kUriUnknown; index++)
+    {
+        Uri expectedUri = static_cast<Uri>(index);
+
+        VerifyOrQuit(UriFromPath(PathForUri(expectedUri)) == expectedUri);
+
+        message = NewRequestWithPath(*instance, index, PathForUri(expectedUri));
+        SuccessOrQuit(message->ReadUri(uri));
+        VerifyOrQuit(uri == expectedUri);
+        message->Free();
+    }
+
+    for (const char *path : kUnknownPaths)
+    {
+        VerifyOrQuit(UriFromPath(path) == kUriUnknown);
+
+        message = NewRequestWithPath(*instance, 0, path);
+        SuccessOrQuit(message->ReadUri(uri));
+        VerifyOrQuit(uri == kUriUnknown);
+        message->Free();
+    }
+
+    // A path longer than `kMaxReceivedUriPath` fails to parse.
+
+    message = NewRequestWithPath(*instance, 0, "this/uri/path/is/longer/than/max/allowed");
+    VerifyOrQuit(message->ReadUri(uri) == kErrorParse);
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
+static constexpr uint16_t kNumResources = 24;
+
+static char           sResourcePaths[kNumResources][8];
+static uint16_t       sResourceRxCounts[kNumResources];
+static Uri            sLastHandledUri;
+static uint16_t       sNumResourceHandlerCalls;
+static Coap::Resource sAnotherResource("r/x", nullptr, nullptr);
+
+static void HandleResourceRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    (*static_cast<uint16_t *>(aContext))++;
+}
+
+static bool HandleTmfResource(Coap::CoapBase &aCoapBase, Uri aUri, Coap::Msg &aRxMsg)
+{
+    OT_UNUSED_VARIABLE(aCoapBase);
+    OT_UNUSED_VARIABLE(aRxMsg);
+
+    sNumResourceHandlerCalls++;
+    sLastHandledUri = aUri;
+
+    return (aUri != kUriUnknown);
+}
+
+static void ReceiveRequest(Instance &aInstance, TestCoap &aCoap, uint16_t aMessageId, const char *aUriPath)
+{
+    Coap::Message   *message = NewRequestWithPath(aInstance, aMessageId, aUriPath);
+    Ip6::MessageInfo messageInfo;
+
+    PreparePeerMessageInfo(messageInfo, 0);
+    aCoap.Receive(*message, messageInfo);
+    message->Free();
+}
+
+void TestCoapResourceDispatch(void)
+{
+    Instance       *instance;
+    TestCoap       *coap;
+    Coap::Resource *resources[kNumResources];
+    uint16_t        messageId = 0;
+    uint16_t        numTx;
+
+    printf("TestCoapResourceDispatch()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    coap = new TestCoap(*instance);
+
+    for (uint16_t index = 0; index < kNumResources; index++)
+    {
+        snprintf(sResourcePaths[index], sizeof(sResourcePaths[index]), "r/%u", index);
+        sResourceRxCounts[index] = 0;
+
+        resources[index] = new Coap::Resource(sResourcePaths[index], HandleResourceRequest, &sResourceRxCounts[index]);
+        coap->AddResource(*resources[index]);
+    }
+
+    // Adding a resource twice must be ignored.
+    coap->AddResource(*resources[0]);
+
+    for (uint16_t index = 0; index < kNumResources; index++)
+    {
+        ReceiveRequest(*instance, *coap, ++messageId, sResourcePaths[index]);
+    }
+
+    for (uint16_t count : sResourceRxCounts)
+    {
+        VerifyOrQuit(count == 1);
+    }
+
+    // Unknown path gets a "Not Found" response.
+
+    numTx = sTxInfo.mNumTx;
+    ReceiveRequest(*instance, *coap, ++messageId, "r/unknown");
+    VerifyOrQuit(sTxInfo.mNumTx == numTx + 1);
+    VerifyOrQuit(sTxInfo.mCode == Coap::kCodeNotFound);
+
+    // With a resource handler set, it is given the URI decoded from the
+    // message. Unhandled URIs fall back to the added resources.
+
+    coap->SetResourceHandler(HandleTmfResource);
+    sNumResourceHandlerCalls = 0;
+
+    for (uint8_t index = 0; index < kUriUnknown; index++)
+    {
+        ReceiveRequest(*instance, *coap, ++messageId, PathForUri(static_cast<Uri>(index)));
+        VerifyOrQuit(sNumResourceHandlerCalls == index + 1);
+        VerifyOrQuit(sLastHandledUri == static_cast<Uri>(index));
+    }
+
+    sNumResourceHandlerCalls = 0;
+    ReceiveRequest(*instance, *coap, ++messageId, sResourcePaths[5]);
+    VerifyOrQuit(sNumResourceHandlerCalls == 1);
+    VerifyOrQuit(sLastHandledUri == kUriUnknown);
+    VerifyOrQuit(sResourceRxCounts[5] == 2);
+
+    // Removed resources are no longer matched.
+
+    coap->RemoveResource(sAnotherResource);
+
+    for (Coap::Resource *resource : resources)
+    {
+        coap->RemoveResource(*resource);
+    }
+
+    numTx = sTxInfo.mNumTx;
+    ReceiveRequest(*instance, *coap, ++messageId, sResourcePaths[7]);
+    VerifyOrQuit(sResourceRxCounts[7] == 1);
+    VerifyOrQuit(sTxInfo.mNumTx == numTx + 1);
+    VerifyOrQuit(sTxInfo.mCode == Coap::kCodeNotFound);
+
+    for (Coap::Resource *resource : resources)
+    {
+        delete resource;
+    }
+
+    coap->ClearAllRequestsAndResponses();
+
+    delete coap;
+    testFreeInstance(instance);
+}
+
+void TestUriDispatchBenchmark(void)
+{
+    static constexpr uint16_t kNumRounds = 200;
+
+    Instance      *instance;
+    Coap::Message *messages[kUriUnknown];
+    uint64_t       stringUs = 0;
+    uint64_t       hashUs   = 0;
+    uint32_t       numMatches;
+
+    printf("TestUriDispatchBenchmark()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    for (uint8_t index = 0; index < kUriUnknown; index++)
+    {
+        messages[index] = NewRequestWithPath(*instance, index, PathForUri(static_cast<Uri>(index)));
+    }
+
+    // Reading the URI path string and looking it up (as done before
+    // for TMF messages), versus decoding the URI directly.
+
+    numMatches = 0;
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            for (uint8_t index = 0; index < kUriUnknown; index++)
+            {
+                Coap::Message::UriPathStringBuffer uriPath;
+
+                SuccessOrQuit(messages[index]->ReadUriPathOptions(uriPath));
+                numMatches += (UriFromPath(uriPath) == static_cast<Uri>(index)) ? 1 : 0;
+            }
+        }
+
+        stringUs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    VerifyOrQuit(numMatches == kNumRounds * kUriUnknown);
+
+    numMatches = 0;
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            for (uint8_t index = 0; index < kUriUnknown; index++)
+            {
+                Uri uri;
+
+                SuccessOrQuit(messages[index]->ReadUri(uri));
+                numMatches += (uri == static_cast<Uri>(index)) ? 1 : 0;
+            }
+        }
+
+        hashUs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    VerifyOrQuit(numMatches == kNumRounds * kUriUnknown);
+
+    printf("  %u requests: read path + lookup %llu usec, decode URI %llu usec\n", kNumRounds * kUriUnknown,
+           static_cast<unsigned long long>(stringUs), static_cast<unsigned long long>(hashUs));
+
+    for (Coap::Message *message : messages)
+    {
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
+static const Coap::CongestionControl::PeerInfo &GetPeerInfo(const Coap::CongestionControl &aCongestionControl,
+                                                            const Ip6::Address            &aPeer)
+{
+    static Coap::CongestionControl::PeerInfo sInfo;
+
+    Coap::CongestionControl::Iterator iterator = OT_TMF_PEER_RTT_ITERATOR_INIT;
+
+    while (aCongestionControl.GetNextPeerInfo(iterator, sInfo) == kErrorNone)
+    {
+        if (AsCoreType(&sInfo.mPeerAddress) == aPeer)
+        {
+            ExitNow();
+        }
+    }
+
+    VerifyOrQuit(false, "peer not found");
+
+exit:
+    return sInfo;
+}
+
+void TestCongestionControlEstimator(void)
+{
+    static constexpr uint16_t kMaxPeers = OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_MAX_PEERS;
+
+    Instance                         *instance;
+    Coap::CongestionControl          *congestionControl;
+    Coap::CongestionControl::Iterator iterator;
+    Coap::CongestionControl::PeerInfo info;
+    Ip6::MessageInfo                  messageInfo;
+    Ip6::Address                      peer;
+    uint32_t                          rto;
+    uint8_t                           backoffFactor;
+    uint16_t                          numPeers;
+
+    printf("TestCongestionControlEstimator()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    congestionControl = new Coap::CongestionControl();
+
+    PreparePeerMessageInfo(messageInfo, 0);
+    peer = messageInfo.GetPeerAddr();
+
+    // A new peer starts from the default RTO (ACK_TIMEOUT).
+
+    rto = congestionControl->DetermineInitialRto(peer, backoffFactor);
+    VerifyOrQuit(rto >= 2000 && rto <= 3000);
+    VerifyOrQuit(backoffFactor == 4);
+    VerifyOrQuit(GetPeerInfo(*congestionControl, peer).mRto == 2000);
+
+    // Strong samples on a fast path bring the RTO down to its lower
+    // bound, which then uses a larger backoff factor.
+
+    for (uint16_t count = 0; count < 20; count++)
+    {
+        congestionControl->HandleRttSample(peer, 100, 1);
+    }
+
+    info = GetPeerInfo(*congestionControl, peer);
+    VerifyOrQuit(info.mNumStrongSamples == 20);
+    VerifyOrQuit(info.mNumWeakSamples == 0);
+    VerifyOrQuit(info.mStrongRtt == 100);
+    VerifyOrQuit(info.mRto == 500);
+
+    rto = congestionControl->DetermineInitialRto(peer, backoffFactor);
+    VerifyOrQuit(rto >= 500 && rto <= 750);
+    VerifyOrQuit(backoffFactor == 6);
+    VerifyOrQuit(Coap::CongestionControl::CalculateBackoff(500, backoffFactor) == 1500);
+    VerifyOrQuit(Coap::CongestionControl::CalculateBackoff(20000, 4) == 32000);
+
+    // An RTO not updated for a while is aged back up.
+
+    AdvanceTime(*instance, 16 * 500 + 1);
+    rto = congestionControl->DetermineInitialRto(peer, backoffFactor);
+    VerifyOrQuit(GetPeerInfo(*congestionControl, peer).mRto == 1000);
+
+    // Weak samples (after one or two retransmissions) raise the RTO,
+    // samples after more retransmissions are ignored.
+
+    for (uint16_t count = 0; count < 10; count++)
+    {
+        congestionControl->HandleRttSample(peer, 6000, 2);
+    }
+
+    congestionControl->HandleRttSample(peer, 6000, 4);
+
+    info = GetPeerInfo(*congestionControl, peer);
+    VerifyOrQuit(info.mNumStrongSamples == 20);
+    VerifyOrQuit(info.mNumWeakSamples == 10);
+    VerifyOrQuit(info.mWeakRtt == 6000);
+    VerifyOrQuit(info.mRto > 3000);
+
+    rto = congestionControl->DetermineInitialRto(peer, backoffFactor);
+    VerifyOrQuit(backoffFactor == 3);
+
+    // The least recently used peer is replaced once the table is full.
+
+    for (uint16_t index = 1; index <= kMaxPeers; index++)
+    {
+        AdvanceTime(*instance, 1);
+        PreparePeerMessageInfo(messageInfo, index);
+        rto = congestionControl->DetermineInitialRto(messageInfo.GetPeerAddr(), backoffFactor);
+    }
+
+    numPeers = 0;
+    iterator = OT_TMF_PEER_RTT_ITERATOR_INIT;
+
+    while (congestionControl->GetNextPeerInfo(iterator, info) == kErrorNone)
+    {
+        VerifyOrQuit(AsCoreType(&info.mPeerAddress) != peer);
+        numPeers++;
+    }
+
+    VerifyOrQuit(numPeers == kMaxPeers);
+
+    // A timeout or deferred request to a peer not in the table does
+    // not allocate an entry (nor evict another peer).
+
+    congestionControl->HandleTimeout(peer);
+    congestionControl->HandleDeferred(peer);
+
+    numPeers = 0;
+    iterator = OT_TMF_PEER_RTT_ITERATOR_INIT;
+
+    while (congestionControl->GetNextPeerInfo(iterator, info) == kErrorNone)
+    {
+        VerifyOrQuit(AsCoreType(&info.mPeerAddress) != peer);
+        VerifyOrQuit(info.mNumTimeouts == 0);
+        VerifyOrQuit(info.mNumDeferred == 0);
+        numPeers++;
+    }
+
+    VerifyOrQuit(numPeers == kMaxPeers);
+
+    delete congestionControl;
+    testFreeInstance(instance);
+}
+
+void TestCoapNstart(void)
+{
+    static constexpr uint16_t kNumPeerRequests = Coap::CongestionControl::kNstart + 2;
+
+    Instance                *instance;
+    TestCoap                *coap;
+    Coap::CongestionControl *congestionControl;
+    RequestContext           otherPeerRequest;
+    uint16_t                 numTx;
+
+    printf("TestCoapNstart()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    coap              = new TestCoap(*instance);
+    congestionControl = new Coap::CongestionControl();
+    coap->SetCongestionControl(*congestionControl);
+
+    // Only `kNstart` requests to the same peer are sent, the others
+    // are held back. A request to another peer is not affected.
+
+    sTxInfo.mNumTx = 0;
+
+    for (uint16_t index = 0; index < kNumPeerRequests; index++)
+    {
+        SendRequest(*coap, sRequests[index], 0);
+
+        if (index < Coap::CongestionControl::kNstart)
+        {
+            SaveTxInfo(sRequests[index]);
+        }
+    }
+
+    VerifyOrQuit(sTxInfo.mNumTx == Coap::CongestionControl::kNstart);
+
+    SendRequest(*coap, otherPeerRequest, 1);
+    VerifyOrQuit(sTxInfo.mNumTx == Coap::CongestionControl::kNstart + 1);
+    SaveTxInfo(otherPeerRequest);
+
+    VerifyOrQuit(GetPeerInfo(*congestionControl, sRequests[0].mMessageInfo.GetPeerAddr()).mNumDeferred ==
+                 kNumPeerRequests - Coap::CongestionControl::kNstart);
+
+    // Acknowledging an outstanding exchange gives a strong RTT sample
+    // and starts the next held back request.
+
+    for (uint16_t index = 0; index < kNumPeerRequests; index++)
+    {
+        RequestContext &request = sRequests[index];
+
+        AdvanceTime(*instance, 50);
+
+        numTx = sTxInfo.mNumTx;
+        ReceiveMessage(*instance, *coap, Coap::kTypeAck, Coap::kCodeChanged, request.mMessageId, request.mToken,
+                       request.mMessageInfo);
+        VerifyOrQuit(request.mNumResponses == 1);
+        VerifyOrQuit(request.mResult == kErrorNone);
+
+        AdvanceTime(*instance, 0);
+
+        if (index + Coap::CongestionControl::kNstart < kNumPeerRequests)
+        {
+            VerifyOrQuit(sTxInfo.mNumTx == numTx + 1);
+            SaveTxInfo(sRequests[index + Coap::CongestionControl::kNstart]);
+        }
+    }
+
+    {
+        const Coap::CongestionControl::PeerInfo &info =
+            GetPeerInfo(*congestionControl, sRequests[0].mMessageInfo.GetPeerAddr());
+
+        VerifyOrQuit(info.mNumStrongSamples == kNumPeerRequests);
+        VerifyOrQuit(info.mStrongRtt <= 50 * Coap::CongestionControl::kNstart);
+        VerifyOrQuit(info.mRto < 2000);
+    }
+
+    // The request to the other peer is never acknowledged.
+
+    AdvanceTime(*instance, 5 * 60 * 1000);
+    VerifyOrQuit(otherPeerRequest.mNumResponses == 1);
+    VerifyOrQuit(otherPeerRequest.mResult == kErrorResponseTimeout);
+    VerifyOrQuit(GetPeerInfo(*congestionControl, otherPeerRequest.mMessageInfo.GetPeerAddr()).mNumTimeouts == 1);
+
+    coap->ClearAllRequestsAndResponses();
+
+    delete coap;
+    delete congestionControl;
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestCoapPendingRequests();
+    ot::TestCoapResponseCache();
+    ot::TestCoapMatchingBenchmark();
+    ot::TestUriPaths();
+    ot::TestCoapResourceDispatch();
+    ot::TestUriDispatchBenchmark();
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    ot::TestCongestionControlEstimator();
+    ot::TestCoapNstart();
+#endif
+    printf("All tests passed\n");
+    return 0;
+}
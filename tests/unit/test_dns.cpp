@@ -279,6 +279,19 @@ void TestDnsName(void)
     domain2 = ".example.com.";
     VerifyOrQuit(!Dns::Name::IsSameDomain(domain, domain2));
 
+    printf("----------------------------------------------------------------\n");
+    printf("Calculating name hash:\n");
+
+    VerifyOrQuit(Dns::Name::CalculateHash("host.default.service.arpa.") ==
+                 Dns::Name::CalculateHash("host.default.service.arpa"));
+    VerifyOrQuit(Dns::Name::CalculateHash("host.default.service.arpa.") ==
+                 Dns::Name::CalculateHash("HoSt.DeFault.SerVice.ARPA."));
+    VerifyOrQuit(Dns::Name::CalculateHash("host.default.service.arpa.") !=
+                 Dns::Name::CalculateHash("host2.default.service.arpa."));
+    VerifyOrQuit(Dns::Name::CalculateHash("host.default.service.arpa.") !=
+                 Dns::Name::CalculateHash("host.default.service.arpa.."));
+    VerifyOrQuit(Dns::Name::CalculateHash("_srv._udp") != Dns::Name::CalculateHash("_srv._tcp"));
+
     printf("----------------------------------------------------------------\n");
     printf("Extracting label(s) and removing domains:\n");
 
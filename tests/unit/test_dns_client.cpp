@@ -237,6 +237,16 @@ void FinalizeTest(void)
     testFreeInstance(sInstance);
 }
 
+void ClearDnsClientCache(void)
+{
+    // Ensures that the next query is sent to the server and not
+    // answered from an earlier response.
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    otDnsClientClearCache(sInstance);
+#endif
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 
 static const char kHostName[]        = "elden";
@@ -369,6 +379,7 @@ struct AddressInfo
     Dns::Name::Buffer mHostName;
     Ip6::Address      mHostAddresses[kMaxAddresses];
     uint8_t           mNumHostAddresses;
+    uint32_t          mTtl;
 };
 
 static AddressInfo sAddressInfo;
@@ -407,6 +418,8 @@ void AddressCallback(otError aError, const otDnsAddressResponse *aResponse, void
 
         SuccessOrQuit(error);
 
+        sAddressInfo.mTtl = ttl;
+
         Log("  %2u) %s ttl:%lu", index + 1, sAddressInfo.mHostAddresses[index].ToString().AsCString(), ToUlong(ttl));
     }
 
@@ -883,6 +896,7 @@ void TestDnsClient(void)
 
     sAddressInfo.Reset();
     Log("ResolveAddress(%s)", kHostFullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
@@ -899,6 +913,7 @@ void TestDnsClient(void)
 
     sAddressInfo.Reset();
     Log("ResolveAddress(%s)", kNonExistingName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->ResolveAddress(kNonExistingName, AddressCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
@@ -909,6 +924,7 @@ void TestDnsClient(void)
 
     sAddressInfo.Reset();
     Log("ResolveIp4Address(%s)", kHostFullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->ResolveIp4Address(kHostFullName, AddressCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
@@ -917,6 +933,7 @@ void TestDnsClient(void)
 
     sAddressInfo.Reset();
     Log("ResolveIp4Address(%s)", "badname");
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->ResolveIp4Address("badname", AddressCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
@@ -927,6 +944,7 @@ void TestDnsClient(void)
 
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for KEY RR", kHostFullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeKey, kHostName, "default.service.arpa.",
                                          RecordCallback, sInstance));
     AdvanceTime(100);
@@ -943,6 +961,7 @@ void TestDnsClient(void)
 
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for misc RR", kHostFullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeCname, kHostName, "default.service.arpa.",
                                          RecordCallback, sInstance));
     AdvanceTime(100);
@@ -955,6 +974,7 @@ void TestDnsClient(void)
 
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for ANY RR", kHostFullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeAny, kHostName, "default.service.arpa.",
                                          RecordCallback, sInstance));
     AdvanceTime(100);
@@ -992,6 +1012,7 @@ void TestDnsClient(void)
 
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for KEY RR", kInstance1FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeKey, kInstance1Label, kService1FullName,
                                          RecordCallback, sInstance));
     AdvanceTime(100);
@@ -1008,6 +1029,7 @@ void TestDnsClient(void)
 
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for misc RR", kInstance1FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeCname, kInstance1Label, kService1FullName,
                                          RecordCallback, sInstance));
     AdvanceTime(100);
@@ -1020,6 +1042,7 @@ void TestDnsClient(void)
 
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for SRV record", kInstance1FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeSrv, kInstance1Label, kService1FullName,
                                          RecordCallback, sInstance));
     AdvanceTime(100);
@@ -1067,6 +1090,7 @@ void TestDnsClient(void)
 
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for ANY record", kInstance1FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeAny, kInstance1Label, kService1FullName,
                                          RecordCallback, sInstance));
     AdvanceTime(100);
@@ -1102,6 +1126,7 @@ void TestDnsClient(void)
 
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for PTR record", kService1FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypePtr, "_srv", "_udp.default.service.arpa.",
                                          RecordCallback, sInstance));
     AdvanceTime(100);
@@ -1153,6 +1178,7 @@ void TestDnsClient(void)
 
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for ANY record", kInstance1FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeAny, "_srv", "_udp.default.service.arpa.",
                                          RecordCallback, sInstance));
     AdvanceTime(100);
@@ -1174,6 +1200,7 @@ void TestDnsClient(void)
     sQueryRecordInfo.Reset();
     Log("QueryRecord(%s) for ANY record", kService2SubTypeFullName);
 
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeAny, "_best",
                                          "_sub._game._udp.default.service.arpa.", RecordCallback, sInstance));
     AdvanceTime(100);
@@ -1194,6 +1221,7 @@ void TestDnsClient(void)
 
     sBrowseInfo.Reset();
     Log("Browse(%s)", kService1FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
@@ -1203,6 +1231,7 @@ void TestDnsClient(void)
     sBrowseInfo.Reset();
 
     Log("Browse(%s)", kService2FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
@@ -1212,6 +1241,7 @@ void TestDnsClient(void)
     sBrowseInfo.Reset();
 
     Log("Browse(%s)", kService2SubTypeFullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse(kService2SubTypeFullName, BrowseCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
@@ -1220,6 +1250,7 @@ void TestDnsClient(void)
 
     sBrowseInfo.Reset();
     Log("Browse() for unknown service");
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse("_unknown._udp.default.service.arpa.", BrowseCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sBrowseInfo.mCallbackCount == 1);
@@ -1227,9 +1258,13 @@ void TestDnsClient(void)
 
     Log("Issue four parallel `Browse()` at the same time");
     sBrowseInfo.Reset();
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse("_unknown._udp.default.service.arpa.", BrowseCallback, sInstance));
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse("_unknown2._udp.default.service.arpa.", BrowseCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sBrowseInfo.mCallbackCount == 4);
@@ -1247,6 +1282,7 @@ void TestDnsClient(void)
         queryConfig.mServiceMode = static_cast<otDnsServiceMode>(mode);
 
         sResolveServiceInfo.Reset();
+        ClearDnsClientCache();
         SuccessOrQuit(
             dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
         AdvanceTime(100);
@@ -1289,6 +1325,7 @@ void TestDnsClient(void)
     queryConfig.mServiceMode = static_cast<otDnsServiceMode>(Dns::Client::QueryConfig::kServiceModeSrvTxtOptimize);
 
     sResolveServiceInfo.Reset();
+    ClearDnsClientCache();
     SuccessOrQuit(
         dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
     AdvanceTime(200);
@@ -1305,6 +1342,7 @@ void TestDnsClient(void)
     queryConfig.mServiceMode = static_cast<otDnsServiceMode>(Dns::Client::QueryConfig::kServiceModeSrvTxt);
 
     sResolveServiceInfo.Reset();
+    ClearDnsClientCache();
     SuccessOrQuit(
         dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
     AdvanceTime(200);
@@ -1326,6 +1364,7 @@ void TestDnsClient(void)
     queryConfig.mServiceMode = static_cast<otDnsServiceMode>(Dns::Client::QueryConfig::kServiceModeSrvTxtOptimize);
 
     sResolveServiceInfo.Reset();
+    ClearDnsClientCache();
     SuccessOrQuit(
         dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
 
@@ -1343,6 +1382,7 @@ void TestDnsClient(void)
     queryConfig.mServiceMode = static_cast<otDnsServiceMode>(Dns::Client::QueryConfig::kServiceModeSrvTxt);
 
     sResolveServiceInfo.Reset();
+    ClearDnsClientCache();
     SuccessOrQuit(
         dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
 
@@ -1372,6 +1412,7 @@ void TestDnsClient(void)
         queryConfig.mServiceMode = static_cast<otDnsServiceMode>(mode);
 
         sResolveServiceInfo.Reset();
+        ClearDnsClientCache();
         SuccessOrQuit(
             dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
         AdvanceTime(100);
@@ -1435,6 +1476,7 @@ void TestDnsClient(void)
             queryConfig.mServiceMode = static_cast<otDnsServiceMode>(mode);
 
             sResolveServiceInfo.Reset();
+            ClearDnsClientCache();
             error = dnsClient->ResolveServiceAndHostAddress(kInstance1Label, kService1FullName, ServiceCallback,
                                                             sInstance, &queryConfig);
 
@@ -1493,6 +1535,7 @@ void TestDnsClient(void)
     oldServerCounters = dnsServer->GetCounters();
 
     sResolveServiceInfo.Reset();
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->ResolveServiceAndHostAddress(kInstance1Label, kService1FullName, ServiceCallback,
                                                           sInstance, &queryConfig));
 
@@ -1541,6 +1584,7 @@ void TestDnsClient(void)
     oldServerCounters = dnsServer->GetCounters();
 
     sResolveServiceInfo.Reset();
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, nullptr));
 
     AdvanceTime(100);
@@ -1580,6 +1624,7 @@ void TestDnsClient(void)
     queryConfig.mServiceMode = static_cast<otDnsServiceMode>(Dns::Client::QueryConfig::kServiceModeSrvTxtSeparate);
 
     sResolveServiceInfo.Reset();
+    ClearDnsClientCache();
     SuccessOrQuit(
         dnsClient->ResolveService(kInstance1Label, kService1FullName, ServiceCallback, sInstance, &queryConfig));
     AdvanceTime(25 * 1000);
@@ -1701,6 +1746,7 @@ void TestDnssdServerProxyCallback(void)
 
     sBrowseInfo.Reset();
     Log("Browse(%s)", kService1FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse(kService1FullName, BrowseCallback, sInstance));
     AdvanceTime(10);
 
@@ -1733,6 +1779,7 @@ void TestDnssdServerProxyCallback(void)
 
     sBrowseInfo.Reset();
     Log("Browse(%s)", kService2FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
     AdvanceTime(10);
 
@@ -1774,8 +1821,15 @@ void TestDnssdServerProxyCallback(void)
     sLastSubscribeName[0]   = '\0';
     sLastUnsubscribeName[0] = '\0';
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    // Clear the answer cache so that the query is not answered from
+    // the earlier response.
+    dnsServer->ClearAnswerCache();
+#endif
+
     sBrowseInfo.Reset();
     Log("Browse(%s)", kService2FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
     AdvanceTime(10);
 
@@ -1803,8 +1857,15 @@ void TestDnssdServerProxyCallback(void)
     sLastSubscribeName[0]   = '\0';
     sLastUnsubscribeName[0] = '\0';
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    // Clear the answer cache so that the query is not answered from
+    // the earlier response.
+    dnsServer->ClearAnswerCache();
+#endif
+
     sBrowseInfo.Reset();
     Log("Browse(%s)", kService2FullName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->Browse(kService2FullName, BrowseCallback, sInstance));
     AdvanceTime(10);
 
@@ -1890,12 +1951,14 @@ void TestDnssdSoaNsResponse(void)
         if (iter == 0)
         {
             Log("QueryRecord(%s) for SOA RR", "default.service.arpa.");
+            ClearDnsClientCache();
             SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeSoa, "default", "service.arpa.",
                                                  RecordCallback, sInstance));
         }
         else
         {
             Log("QueryRecord(%s) for SOA RR", "myhost.default.service.arpa.");
+            ClearDnsClientCache();
             SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeSoa, "myhost", "default.service.arpa.",
                                                  RecordCallback, sInstance));
         }
@@ -1937,12 +2000,14 @@ void TestDnssdSoaNsResponse(void)
         if (iter == 0)
         {
             Log("QueryRecord(%s) for NS RR", "default.service.arpa.");
+            ClearDnsClientCache();
             SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeNs, "default", "service.arpa.",
                                                  RecordCallback, sInstance));
         }
         else
         {
             Log("QueryRecord(%s) for NS RR", "myhost.default.service.arpa.");
+            ClearDnsClientCache();
             SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeNs, "myhost", "default.service.arpa.",
                                                  RecordCallback, sInstance));
         }
@@ -1973,6 +2038,7 @@ void TestDnssdSoaNsResponse(void)
     sQueryRecordInfo.Reset();
 
     Log("QueryRecord(%s) for ANY RR", "default.service.arpa.");
+    ClearDnsClientCache();
     SuccessOrQuit(
         dnsClient->QueryRecord(Dns::ResourceRecord::kTypeAny, "default", "service.arpa.", RecordCallback, sInstance));
 
@@ -2009,6 +2075,7 @@ void TestDnssdSoaNsResponse(void)
 
     sAddressInfo.Reset();
     Log("ResolveAddress(%s)", serverName);
+    ClearDnsClientCache();
     SuccessOrQuit(dnsClient->ResolveAddress(serverName, AddressCallback, sInstance));
     AdvanceTime(100);
     VerifyOrQuit(sAddressInfo.mCallbackCount >= 1);
@@ -2026,12 +2093,455 @@ void TestDnssdSoaNsResponse(void)
 
 #endif // ENABLE_DNS_TEST
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE || OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE || \
+    OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+
+void RegisterHostAndService(Srp::Client::Service &aService)
+{
+    // Starts the SRP server and client and registers `kHostName`
+    // with `aService`, so that the DNS-SD server can resolve them.
+
+    Srp::Server *srpServer = &sInstance->Get<Srp::Server>();
+    Srp::Client *srpClient = &sInstance->Get<Srp::Client>();
+
+    PrepareService1(aService);
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    SuccessOrQuit(srpClient->AddService(aService));
+    AdvanceTime(2 * 1000);
+    VerifyOrQuit(aService.GetState() == Srp::Client::kRegistered);
+}
+
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+void TestDnsClientCache(void)
+{
+    static constexpr uint32_t kNegativeTtl = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL;
+
+    Srp::Client::Service           service1;
+    Dns::Client                   *dnsClient;
+    Dns::Client::QueryConfig       queryConfig;
+    Dns::ServiceDiscovery::Server *dnsServer;
+    const otDnsCacheCounters      *counters;
+    uint32_t                       resolvedBySrp;
+    uint32_t                       ttl;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnsClientCache");
+
+    InitTest();
+
+    dnsClient = &sInstance->Get<Dns::Client>();
+    dnsServer = &sInstance->Get<Dns::ServiceDiscovery::Server>();
+
+    RegisterHostAndService(service1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Check that the counters start from zero.
+
+    counters = otDnsClientGetCacheCounters(sInstance);
+
+    otDnsClientClearCache(sInstance);
+    otDnsClientResetCacheCounters(sInstance);
+
+    VerifyOrQuit(counters->mHits == 0);
+    VerifyOrQuit(counters->mMisses == 0);
+    VerifyOrQuit(counters->mInsertions == 0);
+    VerifyOrQuit(counters->mEvictions == 0);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the first query is sent to the server and its response is cached");
+
+    resolvedBySrp = dnsServer->GetCounters().mResolvedBySrp;
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sAddressInfo.mError);
+    VerifyOrQuit(sAddressInfo.mNumHostAddresses > 0);
+
+    ttl = sAddressInfo.mTtl;
+
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedBySrp == resolvedBySrp + 1);
+    VerifyOrQuit(counters->mMisses == 1);
+    VerifyOrQuit(counters->mInsertions == 1);
+    VerifyOrQuit(counters->mHits == 0);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the same query is answered from the cache with decremented TTL");
+
+    AdvanceTime(5000);
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 0);
+    AdvanceTime(1);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sAddressInfo.mError);
+    VerifyOrQuit(sAddressInfo.mNumHostAddresses > 0);
+    VerifyOrQuit(sAddressInfo.mTtl == ttl - 5);
+
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedBySrp == resolvedBySrp + 1);
+    VerifyOrQuit(counters->mHits == 1);
+    VerifyOrQuit(counters->mMisses == 1);
+    VerifyOrQuit(counters->mInsertions == 1);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that a negative response is cached and expires");
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kNonExistingName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kNonExistingName, AddressCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    VerifyOrQuit(sAddressInfo.mError == kErrorNotFound);
+
+    VerifyOrQuit(counters->mMisses == 2);
+    VerifyOrQuit(counters->mInsertions == 2);
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kNonExistingName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kNonExistingName, AddressCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    VerifyOrQuit(sAddressInfo.mError == kErrorNotFound);
+
+    VerifyOrQuit(counters->mHits == 2);
+    VerifyOrQuit(counters->mMisses == 2);
+
+    AdvanceTime(kNegativeTtl * 1000);
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kNonExistingName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kNonExistingName, AddressCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    VerifyOrQuit(sAddressInfo.mError == kErrorNotFound);
+
+    VerifyOrQuit(counters->mHits == 2);
+    VerifyOrQuit(counters->mMisses == 3);
+    VerifyOrQuit(counters->mInsertions == 3);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that resetting the counters keeps the cached responses");
+
+    otDnsClientResetCacheCounters(sInstance);
+
+    VerifyOrQuit(counters->mHits == 0);
+    VerifyOrQuit(counters->mMisses == 0);
+    VerifyOrQuit(counters->mInsertions == 0);
+    VerifyOrQuit(counters->mEvictions == 0);
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sAddressInfo.mError);
+
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedBySrp == resolvedBySrp + 1);
+    VerifyOrQuit(counters->mHits == 1);
+    VerifyOrQuit(counters->mMisses == 0);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that clearing the cache causes the query to be sent to the server");
+
+    otDnsClientClearCache(sInstance);
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sAddressInfo.mError);
+
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedBySrp == resolvedBySrp + 2);
+    VerifyOrQuit(counters->mHits == 1);
+    VerifyOrQuit(counters->mMisses == 1);
+    VerifyOrQuit(counters->mInsertions == 1);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that retransmissions of a query are not counted as cache misses");
+
+    queryConfig.Clear();
+    SuccessOrQuit(AsCoreType(&queryConfig.mServerSockAddr.mAddress).FromString("fd00::dead:beef"));
+    queryConfig.mServerSockAddr.mPort = 53;
+    queryConfig.mResponseTimeout      = 1000;
+    queryConfig.mMaxTxAttempts        = 3;
+
+    otDnsClientResetCacheCounters(sInstance);
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s) from a server that does not respond", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance, &queryConfig));
+    AdvanceTime(5000);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    VerifyOrQuit(sAddressInfo.mError != kErrorNone);
+
+    VerifyOrQuit(counters->mMisses == 1);
+    VerifyOrQuit(counters->mHits == 0);
+    VerifyOrQuit(counters->mInsertions == 0);
+
+    Log("--------------------------------------------------------------------------------------------");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate that the cache is freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    Log("End of TestDnsClientCache");
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+
+void TestDnsClientQueryCoalescing(void)
+{
+    Srp::Client::Service           service1;
+    Dns::Client                   *dnsClient;
+    Dns::ServiceDiscovery::Server *dnsServer;
+    uint32_t                       resolvedBySrp;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnsClientQueryCoalescing");
+
+    InitTest();
+
+    dnsClient = &sInstance->Get<Dns::Client>();
+    dnsServer = &sInstance->Get<Dns::ServiceDiscovery::Server>();
+
+    RegisterHostAndService(service1);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that an identical query joins the pending one and is not sent");
+
+    resolvedBySrp = dnsServer->GetCounters().mResolvedBySrp;
+
+    sAddressInfo.Reset();
+    ClearDnsClientCache();
+    Log("ResolveAddress(%s) twice", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(100);
+
+    // Both callbacks are invoked with the same response, while the
+    // server only received a single query.
+
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 2);
+    SuccessOrQuit(sAddressInfo.mError);
+    VerifyOrQuit(sAddressInfo.mNumHostAddresses > 0);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedBySrp == resolvedBySrp + 1);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that a query for a different name does not join the pending one");
+
+    sAddressInfo.Reset();
+    ClearDnsClientCache();
+    Log("ResolveAddress(%s) and ResolveAddress(%s)", kHostFullName, kNonExistingName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    SuccessOrQuit(dnsClient->ResolveAddress(kNonExistingName, AddressCallback, sInstance));
+    AdvanceTime(100);
+
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 2);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedBySrp == resolvedBySrp + 2);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that a query started after the response is sent again");
+
+    sAddressInfo.Reset();
+    ClearDnsClientCache();
+    Log("ResolveAddress(%s)", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(100);
+
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sAddressInfo.mError);
+    VerifyOrQuit(dnsServer->GetCounters().mResolvedBySrp == resolvedBySrp + 3);
+
+    Log("--------------------------------------------------------------------------------------------");
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    Log("End of TestDnsClientQueryCoalescing");
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+
+void TestDnsClientParallelQuery(void)
+{
+    static constexpr uint8_t kMaxParallelServers = OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_MAX_SERVERS;
+
+    static const char kUnresponsiveServer[] = "fd00::dead:beef";
+
+    Srp::Client::Service     service1;
+    Dns::Client             *dnsClient;
+    Dns::Client::QueryConfig queryConfig;
+    Ip6::SockAddr            parallelServer;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    otDnsServerLatencyStats latencyStats;
+    uint32_t                numResponses;
+#endif
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnsClientParallelQuery");
+
+    InitTest();
+
+    dnsClient = &sInstance->Get<Dns::Client>();
+
+    RegisterHostAndService(service1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Use an unresponsive default server and the local DNS-SD server
+    // as a parallel server. The parallel server has no port, so the
+    // port of the default server is used.
+
+    queryConfig.Clear();
+    SuccessOrQuit(AsCoreType(&queryConfig.mServerSockAddr.mAddress).FromString(kUnresponsiveServer));
+    queryConfig.mServerSockAddr.mPort = Dns::ServiceDiscovery::Server::kPort;
+    queryConfig.mResponseTimeout      = 1000;
+    queryConfig.mMaxTxAttempts        = 2;
+    dnsClient->SetDefaultConfig(queryConfig);
+
+    parallelServer.SetAddress(sInstance->Get<Srp::Client>().GetServerAddress().GetAddress());
+    parallelServer.SetPort(0);
+
+    VerifyOrQuit(otDnsClientSetParallelServers(sInstance, nullptr, kMaxParallelServers + 1) == kErrorInvalidArgs);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    otDnsClientResetServerLatencyStats(sInstance);
+    VerifyOrQuit(otDnsClientGetServerLatencyStats(sInstance, 0, &latencyStats) == kErrorNotFound);
+#endif
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the query is not answered without the parallel server");
+
+    sAddressInfo.Reset();
+    ClearDnsClientCache();
+    Log("ResolveAddress(%s)", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 0);
+    AdvanceTime(3000);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    VerifyOrQuit(sAddressInfo.mError == kErrorResponseTimeout);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the query is also sent to the parallel server, whose response is used");
+
+    SuccessOrQuit(otDnsClientSetParallelServers(sInstance, &parallelServer, 1));
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sAddressInfo.mError);
+    VerifyOrQuit(sAddressInfo.mNumHostAddresses > 0);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    // The latency of the response is recorded for the parallel
+    // server (with the port of the default server).
+
+    SuccessOrQuit(otDnsClientGetServerLatencyStats(sInstance, 0, &latencyStats));
+    VerifyOrQuit(AsCoreType(&latencyStats.mServerSockAddr.mAddress) == parallelServer.GetAddress());
+    VerifyOrQuit(latencyStats.mServerSockAddr.mPort == Dns::ServiceDiscovery::Server::kPort);
+    VerifyOrQuit(latencyStats.mNumResponses == 1);
+    VerifyOrQuit(latencyStats.mMinLatency <= latencyStats.mMaxLatency);
+    VerifyOrQuit(latencyStats.mMaxLatency < 100);
+
+    numResponses = 0;
+
+    for (uint32_t count : latencyStats.mHistogram)
+    {
+        numResponses += count;
+    }
+
+    VerifyOrQuit(numResponses == 1);
+    VerifyOrQuit(otDnsClientGetServerLatencyStats(sInstance, 1, &latencyStats) == kErrorNotFound);
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the response cached from the parallel server is used only while it is a parallel server");
+
+    otDnsClientResetCacheCounters(sInstance);
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(1);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sAddressInfo.mError);
+    VerifyOrQuit(otDnsClientGetCacheCounters(sInstance)->mHits == 1);
+
+    SuccessOrQuit(otDnsClientSetParallelServers(sInstance, nullptr, 0));
+
+    sAddressInfo.Reset();
+    Log("ResolveAddress(%s)", kHostFullName);
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(3000);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    VerifyOrQuit(sAddressInfo.mError == kErrorResponseTimeout);
+    VerifyOrQuit(otDnsClientGetCacheCounters(sInstance)->mMisses == 1);
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_LATENCY_STATS_ENABLE
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the latency stats can be reset");
+
+    otDnsClientResetServerLatencyStats(sInstance);
+    VerifyOrQuit(otDnsClientGetServerLatencyStats(sInstance, 0, &latencyStats) == kErrorNotFound);
+#endif
+
+    SuccessOrQuit(otDnsClientSetParallelServers(sInstance, nullptr, 0));
+    dnsClient->ResetDefaultConfig();
+
+    Log("--------------------------------------------------------------------------------------------");
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    Log("End of TestDnsClientParallelQuery");
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+
 int main(void)
 {
 #if ENABLE_DNS_TEST
     TestDnsClient();
     TestDnssdServerProxyCallback();
     TestDnssdSoaNsResponse();
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    TestDnsClientCache();
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_QUERY_COALESCING_ENABLE
+    TestDnsClientQueryCoalescing();
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_PARALLEL_QUERY_ENABLE
+    TestDnsClientParallelQuery();
+#endif
     printf("All tests passed\n");
 #else
     printf("DNS_CLIENT or DSNSSD_SERVER feature is not enabled\n");
@@ -745,6 +745,15 @@ void ResetPlatDnssdApiInfo(void)
     sStartRecordQuerierInfo.Clear();
     sStopRecordQuerierInfo.Clear();
     sInvokeOnStart.Clear();
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    // Clear the answer cache so that the next query is passed to the
+    // Discovery Proxy and starts the expected browser or resolvers.
+    sInstance->Get<Dns::ServiceDiscovery::Server>().ClearAnswerCache();
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    sInstance->Get<Dns::Client>().ClearCache();
+#endif
 }
 
 const char *StringNullCheck(const char *aString) { return (aString != nullptr) ? aString : "(null)"; }
@@ -3596,6 +3605,240 @@ void TestProxyInvokeCallbackFromStartApi(void)
     Log("End of TestProxyInvokeCallbackFromStartApi");
 }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+
+bool ResolveAddressUsingProxy(const char *aHostLabel, const char *aAddress)
+{
+    // Resolves the address of `aHostLabel` and, if the Discovery
+    // Proxy starts an address resolver, invokes its callback with
+    // `aAddress`. Returns whether the resolver was started, i.e.,
+    // the query was not answered from the answer cache.
+
+    Dnssd::AddressResult result;
+    Dnssd::AddressAndTtl addressAndTtl;
+    Dns::Name::Buffer    hostName;
+    uint16_t             callCount = sStartIp6AddrResolverInfo.mCallCount;
+    bool                 usedProxy;
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    sInstance->Get<Dns::Client>().ClearCache();
+#endif
+
+    snprintf(hostName, sizeof(hostName), "%s.default.service.arpa.", aHostLabel);
+
+    sResolveAddressInfo.Reset();
+    Log("ResolveAddress(%s)", hostName);
+    SuccessOrQuit(sInstance->Get<Dns::Client>().ResolveAddress(hostName, AddressCallback, sInstance));
+    AdvanceTime(10);
+
+    usedProxy = (sStartIp6AddrResolverInfo.mCallCount != callCount);
+
+    if (usedProxy)
+    {
+        VerifyOrQuit(sStartIp6AddrResolverInfo.HostNameMatches(aHostLabel));
+        VerifyOrQuit(sResolveAddressInfo.mCallbackCount == 0);
+
+        SuccessOrQuit(AsCoreType(&addressAndTtl.mAddress).FromString(aAddress));
+        addressAndTtl.mTtl = 300;
+
+        result.mHostName        = aHostLabel;
+        result.mInfraIfIndex    = kInfraIfIndex;
+        result.mAddresses       = &addressAndTtl;
+        result.mAddressesLength = 1;
+
+        InvokeIp6AddrResolverCallback(sStartIp6AddrResolverInfo.mCallback, result);
+        AdvanceTime(10);
+    }
+
+    VerifyOrQuit(sResolveAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sResolveAddressInfo.mError);
+    VerifyOrQuit(sResolveAddressInfo.mNumHostAddresses == 1);
+
+    if (usedProxy)
+    {
+        VerifyOrQuit(sResolveAddressInfo.mHostAddresses[0] == AsCoreType(&addressAndTtl.mAddress));
+    }
+
+    return usedProxy;
+}
+
+void TestProxyAnswerCache(void)
+{
+    static constexpr uint16_t kCacheSize = OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_SIZE;
+
+    Srp::Server                                              *srpServer;
+    Srp::Client                                              *srpClient;
+    Dns::ServiceDiscovery::Server                            *dnsServer;
+    const Dns::ServiceDiscovery::Server::AnswerCacheCounters *counters;
+    Srp::Client::Service                                      service;
+    Dnssd::AddressResult                                      ip6AddrResult;
+    Dnssd::AddressAndTtl                                      addressAndTtl;
+    Ip6::Address                                              address;
+    char                                                      hostLabel[Dns::Name::kMaxLabelSize];
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestProxyAnswerCache");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+    dnsServer = &sInstance->Get<Dns::ServiceDiscovery::Server>();
+    counters  = &dnsServer->GetAnswerCacheCounters();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    SuccessOrQuit(otBorderRoutingInit(sInstance, /* aInfraIfIndex */ kInfraIfIndex, /* aInfraIfIsRunning */ true));
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    ResetPlatDnssdApiInfo();
+    dnsServer->ResetAnswerCacheCounters();
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the first query is passed to the proxy and its response is cached");
+
+    VerifyOrQuit(ResolveAddressUsingProxy("earth", "fd00::1"));
+    VerifyOrQuit(sResolveAddressInfo.mTtl == kCappedTtl);
+
+    VerifyOrQuit(counters->mMisses == 1);
+    VerifyOrQuit(counters->mInsertions == 1);
+    VerifyOrQuit(counters->mHits == 0);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the same query is answered from the cache");
+
+    VerifyOrQuit(!ResolveAddressUsingProxy("earth", "fd00::1"));
+    VerifyOrQuit(sResolveAddressInfo.mTtl == kCappedTtl);
+    SuccessOrQuit(address.FromString("fd00::1"));
+    VerifyOrQuit(sResolveAddressInfo.mHostAddresses[0] == address);
+
+    VerifyOrQuit(counters->mHits == 1);
+    VerifyOrQuit(counters->mMisses == 1);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the TTL in the cached response is decremented");
+
+    AdvanceTime(4000);
+
+    VerifyOrQuit(!ResolveAddressUsingProxy("earth", "fd00::1"));
+    VerifyOrQuit(sResolveAddressInfo.mTtl == kCappedTtl - 4);
+    VerifyOrQuit(counters->mHits == 2);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the cached response expires after its TTL");
+
+    AdvanceTime(6000);
+
+    VerifyOrQuit(ResolveAddressUsingProxy("earth", "fd00::1"));
+    VerifyOrQuit(sResolveAddressInfo.mTtl == kCappedTtl);
+
+    VerifyOrQuit(counters->mHits == 2);
+    VerifyOrQuit(counters->mMisses == 2);
+    VerifyOrQuit(counters->mInsertions == 2);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that a new proxy result for a name invalidates only its cached responses");
+
+    VerifyOrQuit(ResolveAddressUsingProxy("mars", "fd00::2"));
+    VerifyOrQuit(!ResolveAddressUsingProxy("earth", "fd00::1"));
+    VerifyOrQuit(!ResolveAddressUsingProxy("mars", "fd00::2"));
+
+    SuccessOrQuit(AsCoreType(&addressAndTtl.mAddress).FromString("fd00::3"));
+    addressAndTtl.mTtl = 300;
+
+    ip6AddrResult.mHostName        = "earth";
+    ip6AddrResult.mInfraIfIndex    = kInfraIfIndex;
+    ip6AddrResult.mAddresses       = &addressAndTtl;
+    ip6AddrResult.mAddressesLength = 1;
+
+    InvokeIp6AddrResolverCallback(sStartIp6AddrResolverInfo.mCallback, ip6AddrResult);
+    AdvanceTime(10);
+
+    VerifyOrQuit(!ResolveAddressUsingProxy("mars", "fd00::2"));
+    VerifyOrQuit(ResolveAddressUsingProxy("earth", "fd00::3"));
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that a removed proxy result invalidates all cached responses");
+
+    VerifyOrQuit(!ResolveAddressUsingProxy("earth", "fd00::3"));
+
+    addressAndTtl.mTtl = 0;
+    InvokeIp6AddrResolverCallback(sStartIp6AddrResolverInfo.mCallback, ip6AddrResult);
+    AdvanceTime(10);
+
+    VerifyOrQuit(ResolveAddressUsingProxy("earth", "fd00::1"));
+    VerifyOrQuit(ResolveAddressUsingProxy("mars", "fd00::2"));
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that a change on the SRP server invalidates the cached proxy responses");
+
+    VerifyOrQuit(!ResolveAddressUsingProxy("earth", "fd00::1"));
+
+    memset(&service, 0, sizeof(service));
+    service.mName         = "_answer._udp";
+    service.mInstanceName = "cache";
+    service.mPort         = 1234;
+
+    SuccessOrQuit(srpClient->SetHostName("mercury"));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    SuccessOrQuit(srpClient->AddService(service));
+    AdvanceTime(2000);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) != nullptr);
+
+    VerifyOrQuit(ResolveAddressUsingProxy("earth", "fd00::1"));
+    VerifyOrQuit(ResolveAddressUsingProxy("mars", "fd00::2"));
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Check that the least recently used entry is evicted when the cache is full");
+
+    dnsServer->ClearAnswerCache();
+    dnsServer->ResetAnswerCacheCounters();
+
+    for (uint16_t index = 0; index < kCacheSize; index++)
+    {
+        snprintf(hostLabel, sizeof(hostLabel), "host%u", index);
+        VerifyOrQuit(ResolveAddressUsingProxy(hostLabel, "fd00::4"));
+    }
+
+    VerifyOrQuit(counters->mInsertions == kCacheSize);
+    VerifyOrQuit(counters->mEvictions == 0);
+
+    // Use `host0` so that `host1` becomes the least recently used.
+
+    VerifyOrQuit(!ResolveAddressUsingProxy("host0", "fd00::4"));
+
+    VerifyOrQuit(ResolveAddressUsingProxy("pluto", "fd00::5"));
+    VerifyOrQuit(counters->mEvictions == 1);
+
+    VerifyOrQuit(!ResolveAddressUsingProxy("host0", "fd00::4"));
+    VerifyOrQuit(!ResolveAddressUsingProxy("pluto", "fd00::5"));
+    VerifyOrQuit(ResolveAddressUsingProxy("host1", "fd00::4"));
+
+    Log("--------------------------------------------------------------------------------------------");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestProxyAnswerCache");
+}
+
+#endif // OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+
 #endif // ENABLE_DISCOVERY_PROXY_TEST
 
 int main(void)
@@ -3608,6 +3851,9 @@ int main(void)
     TestProxyFilterInvalidAddresses();
     TestProxyStateChanges();
     TestProxyInvokeCallbackFromStartApi();
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ANSWER_CACHE_ENABLE
+    TestProxyAnswerCache();
+#endif
 
     printf("All tests passed\n");
 #else
@@ -28,6 +28,8 @@
 
 #include "test_lowpan.hpp"
 
+#include <chrono>
+
 #include "test_platform.h"
 #include "test_util.hpp"
 
@@ -2161,6 +2163,150 @@ void TestLowpanDecompressRecursion(void)
     printf("PASS\n\n");
 }
 
+void TestLowpanFlowCache(void)
+{
+    static constexpr uint16_t kNumIterations = 5000;
+
+    static const uint8_t kPayload[] = {0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+
+    Instance         *instance           = testInitInstance();
+    Lowpan::Lowpan   &lowpan             = instance->Get<Lowpan::Lowpan>();
+    MessagePool      &messagePool        = instance->Get<MessagePool>();
+    otMeshLocalPrefix meshLocalPrefix    = {{0xfd, 0x00, 0xca, 0xfe, 0xfa, 0xce, 0x12, 0x34}};
+    otMeshLocalPrefix newMeshLocalPrefix = {{0xfd, 0x00, 0xbe, 0xef, 0xfa, 0xce, 0x12, 0x34}};
+    Mac::Addresses    macAddrs;
+    Ip6::Header       ip6Header;
+    Ip6::UdpHeader    udpHeader;
+    uint8_t           expected[127];
+    uint16_t          expectedLength;
+    uint8_t           frame[127];
+    FrameBuilder      frameBuilder;
+    Message          *message;
+
+    printf("\n=== Test name: Lowpan Flow Cache ===\n\n");
+
+    instance->Get<Mle::Mle>().SetMeshLocalPrefix(static_cast<Ip6::NetworkPrefix &>(meshLocalPrefix));
+
+    // Mesh-local unicast UDP datagram between two RLOC addresses.
+
+    macAddrs.mSource.SetShort(0x2800);
+    macAddrs.mDestination.SetShort(0x6c00);
+
+    ip6Header.InitVersionTrafficClassFlow();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + sizeof(kPayload));
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(64);
+    SuccessOrQuit(ip6Header.GetSource().FromString("fd00:cafe:face:1234:0:ff:fe00:2800"));
+    SuccessOrQuit(ip6Header.GetDestination().FromString("fd00:cafe:face:1234:0:ff:fe00:6c00"));
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(19788);
+    udpHeader.SetDestinationPort(19788);
+    udpHeader.SetLength(sizeof(udpHeader) + sizeof(kPayload));
+
+    // Compress the same flow (with a different UDP checksum each
+    // time) and verify the compressed headers are the same other
+    // than the checksum.
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t i = 0; i < kNumIterations; i++)
+        {
+            udpHeader.SetChecksum(i);
+
+            VerifyOrQuit((message = messagePool.Allocate(Message::kTypeIp6)) != nullptr);
+            SuccessOrQuit(message->Append(ip6Header));
+            SuccessOrQuit(message->Append(udpHeader));
+            SuccessOrQuit(message->AppendBytes(kPayload, sizeof(kPayload)));
+
+            frameBuilder.Init(frame, sizeof(frame));
+            SuccessOrQuit(lowpan.Compress(*message, macAddrs, frameBuilder));
+
+            VerifyOrQuit(message->GetOffset() == sizeof(ip6Header) + sizeof(udpHeader));
+            VerifyOrQuit(BigEndian::ReadUint16(frame + frameBuilder.GetLength() - sizeof(uint16_t)) == i);
+
+            if (i == 0)
+            {
+                expectedLength = frameBuilder.GetLength();
+                memcpy(expected, frame, expectedLength);
+                DumpBuffer("Compressed headers", expected, expectedLength);
+            }
+            else
+            {
+                VerifyOrQuit(frameBuilder.GetLength() == expectedLength);
+                VerifyOrQuit(memcmp(frame, expected, expectedLength - sizeof(uint16_t)) == 0);
+            }
+
+            message->Free();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        printf("Compressed %u datagrams in %lld usec\n", kNumIterations, static_cast<long long>(us));
+    }
+
+    // Decompress the compressed headers repeatedly and verify the
+    // IPv6 and UDP headers.
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t i = 0; i < kNumIterations; i++)
+        {
+            FrameData      frameData;
+            Ip6::Header    decompressedIp6Header;
+            Ip6::UdpHeader decompressedUdpHeader;
+
+            VerifyOrQuit((message = messagePool.Allocate(Message::kTypeIp6)) != nullptr);
+
+            memcpy(frame, expected, expectedLength);
+            memcpy(frame + expectedLength, kPayload, sizeof(kPayload));
+            frameData.Init(frame, expectedLength + sizeof(kPayload));
+
+            SuccessOrQuit(lowpan.Decompress(*message, macAddrs, frameData, 0));
+            VerifyOrQuit(frameData.GetLength() == sizeof(kPayload));
+
+            SuccessOrQuit(message->Read(0, decompressedIp6Header));
+            SuccessOrQuit(message->Read(sizeof(Ip6::Header), decompressedUdpHeader));
+
+            VerifyOrQuit(memcmp(&decompressedIp6Header, &ip6Header, sizeof(Ip6::Header)) == 0);
+            VerifyOrQuit(decompressedUdpHeader.GetSourcePort() == udpHeader.GetSourcePort());
+            VerifyOrQuit(decompressedUdpHeader.GetDestinationPort() == udpHeader.GetDestinationPort());
+            VerifyOrQuit(decompressedUdpHeader.GetLength() == udpHeader.GetLength());
+
+            message->Free();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        printf("Decompressed %u datagrams in %lld usec\n", kNumIterations, static_cast<long long>(us));
+    }
+
+    // Change the mesh-local prefix and verify that the cached entries
+    // are not used, i.e., the addresses are no longer compressed
+    // using context 0 and are carried in-line.
+
+    instance->Get<Mle::Mle>().SetMeshLocalPrefix(static_cast<Ip6::NetworkPrefix &>(newMeshLocalPrefix));
+
+    VerifyOrQuit((message = messagePool.Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->Append(ip6Header));
+    SuccessOrQuit(message->Append(udpHeader));
+    SuccessOrQuit(message->AppendBytes(kPayload, sizeof(kPayload)));
+
+    frameBuilder.Init(frame, sizeof(frame));
+    SuccessOrQuit(lowpan.Compress(*message, macAddrs, frameBuilder));
+    DumpBuffer("Compressed headers after mesh-local prefix change", frame, frameBuilder.GetLength());
+    VerifyOrQuit(frameBuilder.GetLength() == expectedLength + 2 * sizeof(Ip6::Address));
+
+    message->Free();
+
+    testFreeInstance(instance);
+    printf("PASS\n\n");
+}
+
 } // namespace ot
 
 int main(void)
@@ -2169,6 +2315,7 @@ int main(void)
     ot::TestLowpanMeshHeader();
     ot::TestLowpanFragmentHeader();
     ot::TestLowpanDecompressRecursion();
+    ot::TestLowpanFlowCache();
 
     printf("All tests passed\n");
     return 0;
@@ -260,6 +260,7 @@ public:
 };
 
 void TestLowpanDecompressRecursion(void);
+void TestLowpanFlowCache(void);
 
 } // namespace ot
 
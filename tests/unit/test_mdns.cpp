@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
 #include <openthread/config.h>
 
 #include "test_platform.h"
@@ -1761,7 +1763,7 @@ uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
 //----------------------------------------------------------------------------------------------------------------------
 // Heap allocation
 
-Array<void *, 500> sHeapAllocatedPtrs;
+Array<void *, 20000> sHeapAllocatedPtrs;
 
 #if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 
@@ -4646,6 +4648,299 @@ void TestQuery(void)
 
 //----------------------------------------------------------------------------------------------------------------------
 
+void TestQueryNameCaseInsensitive(void)
+{
+    static constexpr uint16_t kNumServices = 64;
+
+    Core             *mdns = InitTest();
+    Core::Service     services[kNumServices];
+    DnsNameString     instanceNames[kNumServices];
+    DnsNameString     queryName;
+    const DnsMessage *dnsMsg;
+    uint16_t          heapAllocations;
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestQueryNameCaseInsensitive");
+
+    AdvanceTime(1);
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Register %u services with mixed-case names", kNumServices);
+
+    for (uint16_t index = 0; index < kNumServices; index++)
+    {
+        Core::Service &service = services[index];
+
+        instanceNames[index].Append("MyInst-%u", index);
+
+        ClearAllBytes(service);
+        service.mHostName        = "MixedHost";
+        service.mServiceInstance = instanceNames[index].AsCString();
+        service.mServiceType     = "_MiXed._udp";
+        service.mTxtData         = kTxtData1;
+        service.mTxtDataLength   = sizeof(kTxtData1);
+        service.mPort            = 1000 + index;
+        service.mTtl             = 1500;
+
+        SuccessOrQuit(mdns->RegisterService(service, 0, nullptr));
+    }
+
+    AdvanceTime(30 * 1000);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Query for SRV records using different letter cases and validate the responses");
+
+    for (uint16_t index = 0; index < kNumServices; index += 7)
+    {
+        queryName.Clear();
+        queryName.Append("%s.%s.LOCAL.", instanceNames[index].AsCString(), "_mixed._UDP");
+        queryName.ConvertToLowercase();
+
+        sDnsMessages.Clear();
+        SendQuery(queryName.AsCString(), ResourceRecord::kTypeSrv);
+
+        AdvanceTime(1000);
+
+        dnsMsg = sDnsMessages.GetHead();
+        VerifyOrQuit(dnsMsg != nullptr);
+        dnsMsg->ValidateHeader(kMulticastResponse, /* Q */ 0, /* Ans */ 1, /* Auth */ 0, /* Addnl */ 1);
+        dnsMsg->Validate(services[index], kInAnswerSection, kCheckSrv);
+        VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+    }
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Query for a name that differs only in its last char and validate no response");
+
+    AdvanceTime(2000);
+
+    // The name "myinst-<kNumServices>" differs from the last
+    // registered "MyInst-<kNumServices - 1>" only in its last char
+    // (other than the letter case).
+
+    static_assert(kNumServices % 10 != 0, "kNumServices must not be a multiple of 10");
+
+    queryName.Clear();
+    queryName.Append("myinst-%u._mixed._udp.local.", kNumServices);
+
+    sDnsMessages.Clear();
+    SendQuery(queryName.AsCString(), ResourceRecord::kTypeSrv);
+
+    AdvanceTime(1000);
+    VerifyOrQuit(sDnsMessages.IsEmpty());
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
+
+    Log("End of test");
+
+    testFreeInstance(sInstance);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void TestManyEntriesSteadyState(void)
+{
+    static constexpr uint16_t kNumHosts   = 5000;
+    static constexpr uint16_t kNumQueries = 60;
+
+    Core             *mdns = InitTest();
+    Core::Host        host;
+    Ip6::Address      hostAddress;
+    DnsNameString     hostName;
+    DnsNameString     hostFullName;
+    const DnsMessage *dnsMsg;
+    uint16_t          heapAllocations;
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestManyEntriesSteadyState");
+
+    AdvanceTime(1);
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    SuccessOrQuit(hostAddress.FromString("fd00::1234"));
+    host.mAddresses       = &hostAddress;
+    host.mAddressesLength = 1;
+    host.mTtl             = 1500;
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Register %u hosts and wait for all probes and announcements", kNumHosts);
+
+    for (uint16_t index = 0; index < kNumHosts; index++)
+    {
+        hostName.Clear();
+        hostName.Append("host%u", index);
+        host.mHostName = hostName.AsCString();
+
+        SuccessOrQuit(mdns->RegisterHost(host, 0, nullptr));
+    }
+
+    for (uint16_t count = 0; count < 30; count++)
+    {
+        AdvanceTime(1000);
+        sDnsMessages.Clear();
+    }
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Send a query for a different host every second and validate the responses");
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t index = 0; index < kNumQueries; index++)
+        {
+            hostName.Clear();
+            hostName.Append("host%u", (index * 83) % kNumHosts);
+            host.mHostName = hostName.AsCString();
+
+            hostFullName.Clear();
+            hostFullName.Append("%s.local.", host.mHostName);
+
+            SendQuery(hostFullName.AsCString(), ResourceRecord::kTypeAaaa);
+
+            AdvanceTime(1000);
+
+            dnsMsg = sDnsMessages.GetHead();
+            VerifyOrQuit(dnsMsg != nullptr);
+            dnsMsg->ValidateHeader(kMulticastResponse, /* Q */ 0, /* Ans */ 1, /* Auth */ 0, /* Addnl */ 1);
+            dnsMsg->Validate(host, kInAnswerSection);
+            VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+
+            sDnsMessages.Clear();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        printf("Steady state with %u hosts: %u sec (one query per sec) processed in %lld usec (%lld usec per sec)\n",
+               kNumHosts, kNumQueries, static_cast<long long>(us), static_cast<long long>(us / kNumQueries));
+    }
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
+
+    Log("End of test");
+
+    testFreeInstance(sInstance);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void TestQueryAndResponseBenchmark(uint16_t aNumServices)
+{
+    static constexpr uint16_t kNumQueries   = 200;
+    static constexpr uint16_t kNumResponses = 200;
+
+    Core         *mdns = InitTest();
+    Core::Service service;
+    DnsNameString instanceName;
+    DnsNameString fullName;
+    uint16_t      heapAllocations;
+    uint32_t      numAnswers;
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestQueryAndResponseBenchmark(%u)", aNumServices);
+
+    AdvanceTime(1);
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    ClearAllBytes(service);
+    service.mHostName      = "benchhost";
+    service.mServiceType   = "_bench._udp";
+    service.mTxtData       = kTxtData1;
+    service.mTxtDataLength = sizeof(kTxtData1);
+    service.mTtl           = 1500;
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Register %u services and wait for all probes and announcements", aNumServices);
+
+    for (uint16_t index = 0; index < aNumServices; index++)
+    {
+        instanceName.Clear();
+        instanceName.Append("BenchInst-%u", index);
+        service.mServiceInstance = instanceName.AsCString();
+        service.mPort            = 1000 + index;
+
+        SuccessOrQuit(mdns->RegisterService(service, 0, nullptr));
+    }
+
+    for (uint16_t count = 0; count < 30; count++)
+    {
+        AdvanceTime(1000);
+        sDnsMessages.Clear();
+    }
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Measure processing of %u SRV queries for registered services", kNumQueries);
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t index = 0; index < kNumQueries; index++)
+        {
+            fullName.Clear();
+            fullName.Append("benchinst-%u._BENCH._udp.local.", (index * 97) % aNumServices);
+            SendQuery(fullName.AsCString(), ResourceRecord::kTypeSrv);
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        printf("%u services: %u queries processed in %lld usec\n", aNumServices, kNumQueries,
+               static_cast<long long>(us));
+    }
+
+    AdvanceTime(2000);
+
+    numAnswers = 0;
+
+    for (const DnsMessage &dnsMsg : sDnsMessages)
+    {
+        numAnswers += dnsMsg.mHeader.GetAnswerCount();
+    }
+
+    VerifyOrQuit(numAnswers > 0);
+    sDnsMessages.Clear();
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Measure processing of %u SRV responses for names not registered", kNumResponses);
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t index = 0; index < kNumResponses; index++)
+        {
+            fullName.Clear();
+            fullName.Append("BenchInst-%u._bench._udp.local.", aNumServices + index);
+            SendSrvResponse(fullName.AsCString(), "otherhost.local.", 1234, 0, 0, 120, kInAnswerSection);
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        printf("%u services: %u responses processed in %lld usec\n", aNumServices, kNumResponses,
+               static_cast<long long>(us));
+    }
+
+    AdvanceTime(2000);
+    sDnsMessages.Clear();
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
+
+    Log("End of test");
+
+    testFreeInstance(sInstance);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 void TestMultiPacket(void)
 {
     static const char *const kSubTypes[] = {"_s1", "_r2", "vxy"};
@@ -6333,6 +6628,101 @@ void TestBrowserMalformedPtrName(void)
     testFreeInstance(sInstance);
 }
 
+void TestBrowserMultiPacketKnownAnswers(void)
+{
+    static constexpr uint16_t kNumInstances   = 100;
+    static constexpr uint32_t kMaxMessageSize = 1200;
+
+    Core                   *mdns = InitTest();
+    Core::Browser           browser;
+    const DnsMessage       *dnsMsg;
+    const Core::TxCounters *counters;
+    uint16_t                heapAllocations;
+    uint16_t                numMessages;
+    uint16_t                numAnswers;
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestBrowserMultiPacketKnownAnswers");
+
+    AdvanceTime(1);
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    ClearAllBytes(browser);
+    browser.mServiceType  = "_srv._udp";
+    browser.mSubTypeLabel = nullptr;
+    browser.mInfraIfIndex = kInfraIfIndex;
+    browser.mCallback     = HandleBrowseResult;
+
+    sDnsMessages.Clear();
+    SuccessOrQuit(mdns->StartBrowser(browser));
+
+    AdvanceTime(DetermineQueryWaitTime(0));
+
+    VerifyOrQuit(!sDnsMessages.IsEmpty());
+    dnsMsg = sDnsMessages.GetHead();
+    dnsMsg->ValidateHeader(kMulticastQuery, /* Q */ 1, /* Ans */ 0, /* Auth */ 0, /* Addnl */ 0);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Send responses with many PTR records");
+
+    for (uint16_t index = 0; index < kNumInstances; index++)
+    {
+        DnsNameString ptrName;
+
+        ptrName.Append("service-instance-%03u._srv._udp.local.", index);
+        SendPtrResponse("_srv._udp.local.", ptrName.AsCString(), 120 * 60, kInAnswerSection);
+    }
+
+    AdvanceTime(1);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Validate the known-answers are sent as multi-packet queries");
+
+    for (uint8_t queryCount = 1; queryCount < kNumInitialQueries; queryCount++)
+    {
+        sDnsMessages.Clear();
+        mdns->ResetTxCounters();
+
+        AdvanceTime(DetermineQueryWaitTime(queryCount));
+
+        numMessages = 0;
+        numAnswers  = 0;
+
+        for (dnsMsg = sDnsMessages.GetHead(); dnsMsg != nullptr; dnsMsg = dnsMsg->GetNext())
+        {
+            VerifyOrQuit(dnsMsg->mType == kMulticastQuery);
+            VerifyOrQuit(dnsMsg->mHeader.GetQuestionCount() == ((numMessages == 0) ? 1 : 0));
+            VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() > 0);
+            VerifyOrQuit(dnsMsg->mHeader.IsTruncationFlagSet() == (dnsMsg->GetNext() != nullptr));
+
+            numMessages++;
+            numAnswers += dnsMsg->mHeader.GetAnswerCount();
+        }
+
+        VerifyOrQuit(numMessages > 1);
+        VerifyOrQuit(numAnswers == kNumInstances);
+
+        counters = &mdns->GetTxCounters();
+        VerifyOrQuit(counters->mQueryMessages == numMessages);
+        VerifyOrQuit(counters->mTruncatedQueryMessages + 1 == numMessages);
+        VerifyOrQuit(counters->mQueryRecords == kNumInstances + 1);
+        VerifyOrQuit(counters->mQueryBytes <= numMessages * kMaxMessageSize);
+
+        Log("  Sent %u known-answers in %u messages, %lu bytes", numAnswers, numMessages,
+            ToUlong(counters->mQueryBytes));
+    }
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
+
+    Log("End of test");
+
+    testFreeInstance(sInstance);
+}
+
 void TestSrvResolver(void)
 {
     Core              *mdns = InitTest();
@@ -9025,6 +9415,10 @@ int main(void)
     ot::Dns::Multicast::TestServiceSubTypeReg();
     ot::Dns::Multicast::TestHostOrServiceAndKeyReg();
     ot::Dns::Multicast::TestQuery();
+    ot::Dns::Multicast::TestQueryNameCaseInsensitive();
+    ot::Dns::Multicast::TestManyEntriesSteadyState();
+    ot::Dns::Multicast::TestQueryAndResponseBenchmark(1000);
+    ot::Dns::Multicast::TestQueryAndResponseBenchmark(5000);
     ot::Dns::Multicast::TestMultiPacket();
     ot::Dns::Multicast::TestResponseAggregation();
     ot::Dns::Multicast::TestQuestionUnicastDisallowed();
@@ -9034,6 +9428,7 @@ int main(void)
 
     ot::Dns::Multicast::TestBrowser();
     ot::Dns::Multicast::TestBrowserMalformedPtrName();
+    ot::Dns::Multicast::TestBrowserMultiPacketKnownAnswers();
     ot::Dns::Multicast::TestSrvResolver();
     ot::Dns::Multicast::TestTxtResolver();
     ot::Dns::Multicast::TestIp6AddrResolver();
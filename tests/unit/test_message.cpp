@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
 #include "common/appender.hpp"
 #include "common/debug.hpp"
 #include "common/message.hpp"
@@ -537,6 +539,120 @@ void TestAppender(void)
     testFreeInstance(instance);
 }
 
+void TestMessageReadCursor(uint16_t aReservedLength)
+{
+    static constexpr uint16_t kMessageSize  = 1280;
+    static constexpr uint16_t kFragmentSize = 96;
+    static constexpr uint16_t kNumRounds    = 2000;
+
+    Instance           *instance;
+    Message            *message;
+    Message            *message2;
+    Message::ReadCursor cursor;
+    uint8_t             writeBuffer[kMessageSize];
+    uint8_t             readBuffer[kMessageSize];
+
+    printf("TestMessageReadCursor(aReservedLength: %u)\n", aReservedLength);
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMessageSize);
+
+    VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6, aReservedLength)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMessageSize));
+
+    VerifyOrQuit((message2 = instance->Get<MessagePool>().Allocate(Message::kTypeIp6, aReservedLength)) != nullptr);
+    SuccessOrQuit(message2->AppendBytes(writeBuffer, kMessageSize / 2));
+
+    // Sequential reads of consecutive fragments using the cursor.
+
+    for (uint16_t fragmentSize = 1; fragmentSize <= kFragmentSize + 1; fragmentSize += 5)
+    {
+        memset(readBuffer, 0, sizeof(readBuffer));
+        cursor.Clear();
+
+        for (uint16_t offset = 0; offset < kMessageSize; offset += fragmentSize)
+        {
+            uint16_t length = Min<uint16_t>(fragmentSize, kMessageSize - offset);
+
+            VerifyOrQuit(message->ReadBytes(offset, &readBuffer[offset], length, cursor) == length);
+        }
+
+        VerifyOrQuit(memcmp(readBuffer, writeBuffer, kMessageSize) == 0);
+    }
+
+    // Reads at decreasing or random offsets, past the end of the
+    // message, and alternating between messages using the same
+    // cursor.
+
+    cursor.Clear();
+
+    for (uint16_t i = 0; i < 500; i++)
+    {
+        Message *msg    = ((i % 3) == 0) ? message2 : message;
+        uint16_t offset = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kMessageSize);
+        uint16_t length = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kMessageSize - offset + 10);
+        uint16_t expectedLength;
+
+        expectedLength = (offset < msg->GetLength()) ? Min<uint16_t>(length, msg->GetLength() - offset) : 0;
+
+        memset(readBuffer, 0, sizeof(readBuffer));
+        VerifyOrQuit(msg->ReadBytes(offset, readBuffer, length, cursor) == expectedLength);
+        VerifyOrQuit(memcmp(readBuffer, &writeBuffer[offset], expectedLength) == 0);
+    }
+
+    // Compare the time to read all fragments of the message with and
+    // without the cursor.
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            for (uint16_t offset = 0; offset < kMessageSize; offset += kFragmentSize)
+            {
+                message->ReadBytes(offset, &readBuffer[offset], Min<uint16_t>(kFragmentSize, kMessageSize - offset));
+            }
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        printf("  Read %u fragments of %u-byte message %u times without cursor: %lu usec\n",
+               (kMessageSize + kFragmentSize - 1) / kFragmentSize, kMessageSize, kNumRounds,
+               static_cast<unsigned long>(us));
+    }
+
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            cursor.Clear();
+
+            for (uint16_t offset = 0; offset < kMessageSize; offset += kFragmentSize)
+            {
+                message->ReadBytes(offset, &readBuffer[offset], Min<uint16_t>(kFragmentSize, kMessageSize - offset),
+                                   cursor);
+            }
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        printf("  Read %u fragments of %u-byte message %u times with cursor: %lu usec\n",
+               (kMessageSize + kFragmentSize - 1) / kFragmentSize, kMessageSize, kNumRounds,
+               static_cast<unsigned long>(us));
+    }
+
+    VerifyOrQuit(memcmp(readBuffer, writeBuffer, kMessageSize) == 0);
+
+    message->Free();
+    message2->Free();
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
@@ -548,6 +664,11 @@ int main(void)
         ot::TestMessage(reservedLength);
     }
 
+    for (uint16_t reservedLength : kReserveLengths)
+    {
+        ot::TestMessageReadCursor(reservedLength);
+    }
+
     ot::UnitTester::TestCloning();
     ot::TestAppender();
 
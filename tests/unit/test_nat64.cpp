@@ -26,6 +26,7 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
 #include <stdio.h>
 
 #include "test_platform.h"
@@ -42,6 +43,38 @@ namespace Nat64 {
 
 static ot::Instance *sInstance;
 
+static uint32_t sNow = 0;
+static uint32_t sAlarmTime;
+static bool     sAlarmOn = false;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        sNow     = sAlarmTime;
+        sAlarmOn = false;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    sNow = time;
+}
+
 void DumpIp6Message(const char *aTextMessage, const Message &aMessage)
 {
     Ip6::Headers ip6Headers;
@@ -433,6 +466,367 @@ void TestNat64Counters(void)
     VerifyOrQuit(iter.GetNext(mapping) == kErrorNotFound);
 
     Log("End of TestNat64Counters");
+
+    testFreeInstance(sInstance);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static constexpr uint16_t kNumMappings        = OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS;
+static constexpr uint16_t kBaseSrcPort        = 10000;
+static constexpr uint16_t kServerPort         = 4660;
+static constexpr uint16_t kPayloadLength      = 16;
+static constexpr uint16_t kLargePayloadLength = 1000;
+
+struct MappingInfo
+{
+    Ip6::Address mIp6Address;
+    uint16_t     mSrcPort;
+    Ip4::Address mIp4Address;
+    uint16_t     mTranslatedPort;
+};
+
+static const uint8_t kPayload[kLargePayloadLength] = {0};
+
+static MappingInfo sMappings[kNumMappings];
+
+static void PrepareHost(MappingInfo &aInfo, uint16_t aIndex)
+{
+    SuccessOrQuit(aInfo.mIp6Address.FromString("fd02::"));
+    aInfo.mIp6Address.mFields.m16[7] = BigEndian::HostSwap16(aIndex + 1);
+    aInfo.mSrcPort                   = kBaseSrcPort + aIndex;
+}
+
+template <typename AddressType>
+static void VerifyUdpChecksum(Message           &aMessage,
+                              uint16_t           aOffset,
+                              const AddressType &aSource,
+                              const AddressType &aDestination)
+{
+    // Verifies the UDP checksum by calculating it over the whole
+    // datagram again.
+
+    Ip4::UdpHeader udpHeader;
+    uint16_t       checksum;
+
+    SuccessOrQuit(aMessage.Read(aOffset, udpHeader));
+    checksum = udpHeader.GetChecksum();
+    udpHeader.SetChecksum(0);
+    aMessage.Write(aOffset, udpHeader);
+
+    aMessage.SetOffset(aOffset);
+    Checksum::UpdateMessageChecksum(aMessage, aSource, aDestination, Ip4::kProtoUdp);
+    aMessage.SetOffset(0);
+
+    SuccessOrQuit(aMessage.Read(aOffset, udpHeader));
+    VerifyOrQuit(udpHeader.GetChecksum() == checksum);
+}
+
+static Message *NewUdp6Message(const MappingInfo &aInfo, const Ip4::Address &aServer, uint16_t aPayloadLength)
+{
+    Message       *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+    Ip6::Header    ip6Header;
+    Ip6::Prefix    prefix;
+    Ip6::Address   dstAddress;
+    Ip4::UdpHeader udpHeader;
+
+    VerifyOrQuit(message != nullptr);
+
+    SuccessOrQuit(sInstance->Get<Translator>().GetNat64Prefix(prefix));
+    dstAddress.SynthesizeFromIp4Address(prefix, aServer);
+
+    ip6Header.Clear();
+    ip6Header.InitVersionTrafficClassFlow();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + aPayloadLength);
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(64);
+    ip6Header.SetSource(aInfo.mIp6Address);
+    ip6Header.SetDestination(dstAddress);
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(aInfo.mSrcPort);
+    udpHeader.SetDestinationPort(kServerPort);
+    udpHeader.SetLength(sizeof(udpHeader) + aPayloadLength);
+
+    SuccessOrQuit(message->Append(ip6Header));
+    SuccessOrQuit(message->Append(udpHeader));
+    SuccessOrQuit(message->AppendBytes(kPayload, aPayloadLength));
+
+    message->SetOffset(sizeof(ip6Header));
+    Checksum::UpdateMessageChecksum(*message, ip6Header.GetSource(), ip6Header.GetDestination(), Ip6::kProtoUdp);
+    message->SetOffset(0);
+
+    return message;
+}
+
+static Message *NewUdp4Message(const MappingInfo &aInfo, const Ip4::Address &aServer, uint16_t aPayloadLength)
+{
+    Message       *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+    Ip4::Header    ip4Header;
+    Ip4::UdpHeader udpHeader;
+
+    VerifyOrQuit(message != nullptr);
+
+    ip4Header.Clear();
+    ip4Header.InitVersionIhl();
+    ip4Header.SetTotalLength(sizeof(ip4Header) + sizeof(udpHeader) + aPayloadLength);
+    ip4Header.SetProtocol(Ip4::kProtoUdp);
+    ip4Header.SetTtl(64);
+    ip4Header.SetSource(aServer);
+    ip4Header.SetDestination(aInfo.mIp4Address);
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(kServerPort);
+    udpHeader.SetDestinationPort(aInfo.mTranslatedPort);
+    udpHeader.SetLength(sizeof(udpHeader) + aPayloadLength);
+
+    SuccessOrQuit(message->Append(ip4Header));
+    SuccessOrQuit(message->Append(udpHeader));
+    SuccessOrQuit(message->AppendBytes(kPayload, aPayloadLength));
+
+    message->SetOffset(sizeof(ip4Header));
+    Checksum::UpdateMessageChecksum(*message, ip4Header.GetSource(), ip4Header.GetDestination(), Ip4::kProtoUdp);
+    message->SetOffset(0);
+
+    return message;
+}
+
+static Error Translate6To4(MappingInfo &aInfo, const Ip4::Address &aServer)
+{
+    Message     *message = NewUdp6Message(aInfo, aServer, kPayloadLength);
+    Ip4::Headers ip4Headers;
+    Error        error;
+
+    error = sInstance->Get<Translator>().TranslateIp6ToIp4(*message);
+
+    if (error == kErrorNone)
+    {
+        SuccessOrQuit(ip4Headers.ParseFrom(*message));
+        VerifyOrQuit(ip4Headers.IsUdp());
+        VerifyOrQuit(ip4Headers.GetDestinationAddress() == aServer);
+        VerifyOrQuit(ip4Headers.GetDestinationPort() == kServerPort);
+        VerifyUdpChecksum(*message, sizeof(Ip4::Header), ip4Headers.GetSourceAddress(),
+                          ip4Headers.GetDestinationAddress());
+
+        aInfo.mIp4Address     = ip4Headers.GetSourceAddress();
+        aInfo.mTranslatedPort = ip4Headers.GetSourcePort();
+    }
+
+    message->Free();
+
+    return error;
+}
+
+static Error Translate4To6(const MappingInfo &aInfo, const Ip4::Address &aServer)
+{
+    Message     *message = NewUdp4Message(aInfo, aServer, kPayloadLength);
+    Ip6::Headers ip6Headers;
+    Error        error;
+
+    error = sInstance->Get<Translator>().TranslateIp4ToIp6(*message);
+
+    if (error == kErrorNone)
+    {
+        SuccessOrQuit(ip6Headers.ParseFrom(*message));
+        VerifyOrQuit(ip6Headers.IsUdp());
+        VerifyOrQuit(ip6Headers.GetDestinationAddress() == aInfo.mIp6Address);
+        VerifyOrQuit(ip6Headers.GetDestinationPort() == aInfo.mSrcPort);
+        VerifyOrQuit(ip6Headers.GetSourcePort() == kServerPort);
+        VerifyUdpChecksum(*message, sizeof(Ip6::Header), ip6Headers.GetSourceAddress(),
+                          ip6Headers.GetDestinationAddress());
+    }
+
+    message->Free();
+
+    return error;
+}
+
+static uint16_t CountMappings(void)
+{
+    Translator::AddressMappingIterator iter;
+    Translator::AddressMapping         mapping;
+    uint16_t                           count = 0;
+
+    iter.Init(*sInstance);
+
+    while (iter.GetNext(mapping) == kErrorNone)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void TestNat64MappingTable(void)
+{
+    static constexpr uint32_t kMinEvictTimeout = 2 * Time::kOneMinuteInMsec;
+
+    Ip6::Prefix  prefix;
+    Ip4::Cidr    cidr;
+    Ip4::Address server;
+    MappingInfo  newHost;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestNat64MappingTable");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    // Use a CIDR with enough addresses for one mapping per host, so
+    // that the pool size is the limit in either translation mode.
+
+    SuccessOrQuit(prefix.FromString("fd01::/96"));
+    SuccessOrQuit(cidr.FromString("10.1.0.0/16"));
+    SuccessOrQuit(server.FromString("172.16.243.197"));
+
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Translator>().SetNat64Prefix(prefix);
+    sInstance->Get<Translator>().SetEnabled(true);
+
+    // Create a mapping for each host, then verify that an existing
+    // mapping is found (the same IPv4 address and port are used) in
+    // both directions.
+
+    for (uint16_t index = 0; index < kNumMappings; index++)
+    {
+        MappingInfo info;
+
+        PrepareHost(sMappings[index], index);
+        SuccessOrQuit(Translate6To4(sMappings[index], server));
+
+        info = sMappings[index];
+        SuccessOrQuit(Translate6To4(info, server));
+        VerifyOrQuit(info.mIp4Address == sMappings[index].mIp4Address);
+        VerifyOrQuit(info.mTranslatedPort == sMappings[index].mTranslatedPort);
+    }
+
+    VerifyOrQuit(CountMappings() == kNumMappings);
+
+    for (const MappingInfo &info : sMappings)
+    {
+        SuccessOrQuit(Translate4To6(info, server));
+    }
+
+    // The pool is full and no mapping is eligible for eviction
+    // (all were used recently), so a new host is dropped.
+
+    PrepareHost(newHost, kNumMappings);
+    VerifyOrQuit(Translate6To4(newHost, server) == kErrorDrop);
+    VerifyOrQuit(CountMappings() == kNumMappings);
+
+    // Once all mappings are eligible, the least recently used one is
+    // evicted. Use the first mapping again, so the second one becomes
+    // the least recently used.
+
+    AdvanceTime(kMinEvictTimeout);
+    SuccessOrQuit(Translate4To6(sMappings[0], server));
+    SuccessOrQuit(Translate6To4(newHost, server));
+    VerifyOrQuit(CountMappings() == kNumMappings);
+
+    SuccessOrQuit(Translate4To6(sMappings[0], server));
+    SuccessOrQuit(Translate4To6(newHost, server));
+    VerifyOrQuit(Translate4To6(sMappings[1], server) == kErrorDrop);
+
+    for (uint16_t index = 2; index < kNumMappings; index++)
+    {
+        SuccessOrQuit(Translate4To6(sMappings[index], server));
+    }
+
+    // Mappings expire after the idle timeout and are removed by the
+    // periodic timer.
+
+    AdvanceTime(2 * OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec);
+    VerifyOrQuit(CountMappings() == 0);
+
+    Log("End of TestNat64MappingTable");
+
+    testFreeInstance(sInstance);
+}
+
+void TestNat64Benchmark(uint16_t aPayloadLength)
+{
+    static constexpr uint16_t kNumRounds = 20;
+
+    Ip6::Prefix  prefix;
+    Ip4::Cidr    cidr;
+    Ip4::Address server;
+    uint64_t     duration6To4 = 0;
+    uint64_t     duration4To6 = 0;
+    uint64_t     maxLatency   = 0;
+    uint32_t     numPackets   = 0;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestNat64Benchmark(payload: %u bytes)", aPayloadLength);
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    SuccessOrQuit(prefix.FromString("fd01::/96"));
+    SuccessOrQuit(cidr.FromString("10.1.0.0/16"));
+    SuccessOrQuit(server.FromString("172.16.243.197"));
+
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Translator>().SetNat64Prefix(prefix);
+    sInstance->Get<Translator>().SetEnabled(true);
+
+    for (uint16_t index = 0; index < kNumMappings; index++)
+    {
+        PrepareHost(sMappings[index], index);
+        SuccessOrQuit(Translate6To4(sMappings[index], server));
+    }
+
+    // Measure only the translation itself, message preparation is
+    // excluded.
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (const MappingInfo &info : sMappings)
+        {
+            Message *message;
+            uint64_t latency;
+
+            message = NewUdp6Message(info, server, aPayloadLength);
+
+            {
+                auto start = std::chrono::steady_clock::now();
+
+                SuccessOrQuit(sInstance->Get<Translator>().TranslateIp6ToIp4(*message));
+                latency = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+                        .count());
+            }
+
+            message->Free();
+            duration6To4 += latency;
+            maxLatency = Max(maxLatency, latency);
+
+            message = NewUdp4Message(info, server, aPayloadLength);
+
+            {
+                auto start = std::chrono::steady_clock::now();
+
+                SuccessOrQuit(sInstance->Get<Translator>().TranslateIp4ToIp6(*message));
+                latency = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+                        .count());
+            }
+
+            message->Free();
+            duration4To6 += latency;
+            maxLatency = Max(maxLatency, latency);
+
+            numPackets++;
+        }
+    }
+
+    Log("%u mappings, %lu packets in each direction", kNumMappings, ToUlong(numPackets));
+    Log("  6to4: avg %lu ns/packet", ToUlong(static_cast<uint32_t>(duration6To4 / numPackets)));
+    Log("  4to6: avg %lu ns/packet", ToUlong(static_cast<uint32_t>(duration4To6 / numPackets)));
+    Log("  max latency: %lu ns", ToUlong(static_cast<uint32_t>(maxLatency)));
+
+    Log("End of TestNat64Benchmark");
+
+    testFreeInstance(sInstance);
 }
 
 } // namespace Nat64
@@ -445,6 +839,9 @@ int main(void)
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     ot::Nat64::TestNat64Translation();
     ot::Nat64::TestNat64Counters();
+    ot::Nat64::TestNat64MappingTable();
+    ot::Nat64::TestNat64Benchmark(ot::Nat64::kPayloadLength);
+    ot::Nat64::TestNat64Benchmark(ot::Nat64::kLargePayloadLength);
     printf("All tests passed\n");
 #else
     printf("NAT64 is not enabled\n");
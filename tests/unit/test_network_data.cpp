@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
 #include <openthread/config.h>
 
 #include "common/array.hpp"
@@ -1117,7 +1119,239 @@ void TestNetworkDataContextLength(void)
     testFreeInstance(instance);
 }
 
+void TestNetworkDataPrefixLookup(void)
+{
+    class TestLeader : public Leader
+    {
+    public:
+        void Populate(const uint8_t *aTlvs, uint8_t aTlvsLength)
+        {
+            memcpy(GetBytes(), aTlvs, aTlvsLength);
+            SetLength(aTlvsLength);
+        }
+    };
+
+    static constexpr uint8_t  kNumOnMeshPrefixes = 10;
+    static constexpr uint16_t kBrRloc16          = 0x2800;
+    static constexpr uint16_t kNat64Rloc16       = 0x4c00;
+    static constexpr uint32_t kNumIterations     = 20000;
+
+    Instance *instance;
+    uint8_t   networkData[NetworkData::kMaxSize];
+    uint8_t   length = 0;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataPrefixLookup()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    // Prepare a Network Data of (close to) maximum size. It contains
+    // `kNumOnMeshPrefixes` Prefix TLVs `fd00:0:0:<i>::/64` each with
+    // a Border Router sub-TLV (on-mesh, default route) and a Context
+    // sub-TLV (with Context ID `i + 1`), followed by a Prefix TLV
+    // `64:ff9b::/96` with a NAT64 Has Route sub-TLV.
+
+    for (uint8_t i = 0; i < kNumOnMeshPrefixes; i++)
+    {
+        const uint8_t kPrefixTlv[] = {
+            0x03, 0x14, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, i,    0x05, 0x04,
+            0x28, 0x00, 0x03, 0x00, 0x07, 0x02, static_cast<uint8_t>(0x10 | (i + 1)), 0x40,
+        };
+
+        memcpy(&networkData[length], kPrefixTlv, sizeof(kPrefixTlv));
+        length += sizeof(kPrefixTlv);
+    }
+
+    {
+        const uint8_t kNat64PrefixTlv[] = {
+            0x03, 0x13, 0x00, 0x60, 0x00, 0x64, 0xff, 0x9b, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x4c, 0x00, 0x20,
+        };
+
+        memcpy(&networkData[length], kNat64PrefixTlv, sizeof(kNat64PrefixTlv));
+        length += sizeof(kNat64PrefixTlv);
+    }
+
+    printf("\nNetwork Data length %u (max %u)", length, NetworkData::kMaxSize);
+
+    {
+        Leader         &leader = instance->Get<Leader>();
+        Ip6::Address    onMeshAddress;
+        Ip6::Address    otherAddress;
+        Ip6::Address    nat64Address;
+        Lowpan::Context context;
+        uint16_t        rloc16;
+
+        reinterpret_cast<TestLeader &>(leader).Populate(networkData, length);
+
+        SuccessOrQuit(onMeshAddress.FromString("fd00:0:0:9::1234"));
+        SuccessOrQuit(otherAddress.FromString("fd00:0:0:abcd::1"));
+        SuccessOrQuit(nat64Address.FromString("64:ff9b::102:304"));
+
+        // Verify the lookup results.
+
+        VerifyOrQuit(leader.IsOnMesh(onMeshAddress));
+        VerifyOrQuit(!leader.IsOnMesh(otherAddress));
+        VerifyOrQuit(!leader.IsOnMesh(nat64Address));
+
+        VerifyOrQuit(leader.IsNat64(nat64Address));
+        VerifyOrQuit(!leader.IsNat64(onMeshAddress));
+
+        leader.FindContextForAddress(onMeshAddress, context);
+        VerifyOrQuit(context.IsValid());
+        VerifyOrQuit(context.GetContextId() == kNumOnMeshPrefixes);
+        VerifyOrQuit(context.GetPrefix().GetLength() == 64);
+
+        leader.FindContextForAddress(otherAddress, context);
+        VerifyOrQuit(!context.IsValid());
+
+        for (uint8_t id = 1; id <= kNumOnMeshPrefixes; id++)
+        {
+            leader.FindContextForId(id, context);
+            VerifyOrQuit(context.IsValid());
+            VerifyOrQuit(context.GetContextId() == id);
+            VerifyOrQuit(context.GetPrefix().GetBytes()[7] == id - 1);
+        }
+
+        leader.FindContextForId(kNumOnMeshPrefixes + 1, context);
+        VerifyOrQuit(!context.IsValid());
+
+        SuccessOrQuit(leader.RouteLookup(onMeshAddress, nat64Address, rloc16));
+        VerifyOrQuit(rloc16 == kNat64Rloc16);
+
+        SuccessOrQuit(leader.RouteLookup(onMeshAddress, otherAddress, rloc16));
+        VerifyOrQuit(rloc16 == kBrRloc16);
+
+        VerifyOrQuit(leader.RouteLookup(otherAddress, nat64Address, rloc16) == kErrorNoRoute);
+
+        // Measure the lookup time.
+
+        {
+            auto     start   = std::chrono::steady_clock::now();
+            uint32_t matches = 0;
+
+            for (uint32_t i = 0; i < kNumIterations; i++)
+            {
+                leader.FindContextForAddress(onMeshAddress, context);
+                matches += context.IsValid() ? 1 : 0;
+                matches += leader.IsOnMesh(onMeshAddress) ? 1 : 0;
+                matches += leader.IsNat64(nat64Address) ? 1 : 0;
+                matches += (leader.RouteLookup(onMeshAddress, nat64Address, rloc16) == kErrorNone) ? 1 : 0;
+            }
+
+            auto end = std::chrono::steady_clock::now();
+            auto us  = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+            VerifyOrQuit(matches == 4 * kNumIterations);
+
+            printf("\n%lu iterations of context/on-mesh/NAT64/route lookups took %lld usec", ToUlong(kNumIterations),
+                   static_cast<long long>(us));
+        }
+
+        // Update the Network Data (remove the NAT64 prefix) without
+        // signaling the change and verify that lookups reflect it.
+
+        reinterpret_cast<TestLeader &>(leader).Populate(networkData, length - 21);
+
+        VerifyOrQuit(!leader.IsNat64(nat64Address));
+        VerifyOrQuit(leader.RouteLookup(onMeshAddress, nat64Address, rloc16) == kErrorNone);
+        VerifyOrQuit(rloc16 == kBrRloc16);
+    }
+
+    printf("\n");
+
+    testFreeInstance(instance);
+}
+
 } // namespace NetworkData
+
+class UnitTester
+{
+public:
+    static void TestNetworkDataPrefixIndexSameLengthEdit(void)
+    {
+        // A Prefix TLV `fd00::/64` with a Border Router sub-TLV
+        // (on-mesh and default route flags) and a Context sub-TLV.
+
+        static constexpr uint8_t kOnMeshFlagsOffset = 16;
+
+        const uint8_t kNetworkData[] = {
+            0x03, 0x14, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x05, 0x04, 0x28, 0x00, 0x03, 0x00, 0x07, 0x02, 0x11, 0x40,
+        };
+
+        Instance    *instance;
+        Ip6::Address address;
+        Message     *message;
+        OffsetRange  offsetRange;
+        uint8_t      length;
+        uint8_t      version;
+
+        printf("\n\n-------------------------------------------------");
+        printf("\nTestNetworkDataPrefixIndexSameLengthEdit()\n");
+
+        instance = testInitInstance();
+        VerifyOrQuit(instance != nullptr);
+
+        {
+            NetworkData::Leader &leader = instance->Get<NetworkData::Leader>();
+
+            SuccessOrQuit(address.FromString("fd00::1234"));
+
+            message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+            VerifyOrQuit(message != nullptr);
+            SuccessOrQuit(message->AppendBytes(kNetworkData, sizeof(kNetworkData)));
+            offsetRange.Init(0, sizeof(kNetworkData));
+
+            SuccessOrQuit(leader.SetNetworkData(/* aVersion */ 1, /* aStableVersion */ 1, NetworkData::kFullSet,
+                                                *message, offsetRange));
+            message->Free();
+
+            VerifyOrQuit(leader.IsOnMesh(address));
+
+            // Clear the on-mesh flag in place (keeping the same Network
+            // Data length) and update the version without signaling
+            // the change. Verify that the prefix index is rebuilt.
+
+            length  = leader.GetLength();
+            version = leader.GetVersion(NetworkData::kFullSet);
+
+            leader.GetBytes()[kOnMeshFlagsOffset] = 0x02;
+            leader.mVersion++;
+
+            VerifyOrQuit(leader.GetLength() == length);
+            VerifyOrQuit(leader.GetVersion(NetworkData::kFullSet) != version);
+            VerifyOrQuit(!leader.IsOnMesh(address));
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
+            {
+                // Verify the same on a Leader clone which does not
+                // change its versions when updated.
+
+                NetworkData::Leader leaderClone(*instance);
+
+                leaderClone.MarkAsClone();
+                SuccessOrQuit(leader.CopyNetworkData(NetworkData::kFullSet, leaderClone));
+                VerifyOrQuit(!leaderClone.IsOnMesh(address));
+
+                version = leaderClone.GetVersion(NetworkData::kFullSet);
+
+                leaderClone.GetBytes()[kOnMeshFlagsOffset] = 0x03;
+                leaderClone.IncrementVersions(/* aIncludeStable */ true);
+
+                VerifyOrQuit(leaderClone.GetVersion(NetworkData::kFullSet) == version);
+                VerifyOrQuit(leaderClone.IsOnMesh(address));
+            }
+#endif
+        }
+
+        printf("\n");
+
+        testFreeInstance(instance);
+    }
+};
+
 } // namespace ot
 
 int main(void)
@@ -1129,6 +1363,8 @@ int main(void)
     ot::NetworkData::TestNetworkDataDsnSrpServices();
     ot::NetworkData::TestNetworkDataDsnSrpAnycastSeqNumSelection();
     ot::NetworkData::TestNetworkDataContextLength();
+    ot::NetworkData::TestNetworkDataPrefixLookup();
+    ot::UnitTester::TestNetworkDataPrefixIndexSameLengthEdit();
 
     printf("\nAll tests passed\n");
     return 0;
@@ -319,7 +319,7 @@ OT_TOOL_WEAK otError otPlatSettingsGet(otInstance *, uint16_t aKey, int aIndex,
         return OT_ERROR_NOT_FOUND;
     }
 
-    if (aIndex > setting->second.size())
+    if (aIndex >= setting->second.size())
     {
         return OT_ERROR_NOT_FOUND;
     }
@@ -373,6 +373,12 @@ OT_TOOL_WEAK otError otPlatSettingsDelete(otInstance *, uint16_t aKey, int aInde
         return OT_ERROR_NOT_FOUND;
     }
 
+    if (aIndex == -1)
+    {
+        settings.erase(setting);
+        return OT_ERROR_NONE;
+    }
+
     if (aIndex >= setting->second.size())
     {
         return OT_ERROR_NOT_FOUND;
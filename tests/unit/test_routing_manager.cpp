@@ -3404,6 +3404,207 @@ void TestPrefixStaleTime(void)
     FinalizeTest();
 }
 
+void TestIncrementalEvaluation(void)
+{
+    Ip6::Prefix                                   onLinkPrefixA  = PrefixFromString("2000:abba:baba:bbbb::", 64);
+    Ip6::Prefix                                   onLinkPrefixB  = PrefixFromString("2000:abba:baba:aaaa::", 64);
+    Ip6::Prefix                                   routePrefix    = PrefixFromString("2000:1234:5678::", 64);
+    Ip6::Address                                  routerAddressA = AddressFromString("fd00::aaaa");
+    Ip6::Address                                  routerAddressB = AddressFromString("fd00::bbbb");
+    BorderRouter::RxRaTracker::EvaluationCounters counters;
+    uint16_t                                      heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestIncrementalEvaluation");
+
+    InitTest();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start Routing Manager.
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(true));
+
+    AdvanceTime(30000);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Advertise an on-link and a route prefix from router A. Check the
+    // discovered prefix table and the favored on-link prefix.
+
+    SendRouterAdvert(routerAddressA, {Pio(onLinkPrefixA, 1800, 1800)},
+                     {Rio(routePrefix, 1800, NetworkData::kRoutePreferenceMedium)});
+
+    AdvanceTime(10);
+
+    VerifyPrefixTable({OnLinkPrefix(onLinkPrefixA, 1800, 1800, routerAddressA)},
+                      {RoutePrefix(routePrefix, 1800, NetworkData::kRoutePreferenceMedium, routerAddressA)});
+
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetFavoredOnLinkPrefix() == onLinkPrefixA);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Send the same RA again from router A. Check that it is
+    // processed by an incremental evaluation and that the table and
+    // the favored on-link prefix are not changed.
+
+    counters = sInstance->Get<BorderRouter::RxRaTracker>().GetEvaluationCounters();
+
+    SendRouterAdvert(routerAddressA, {Pio(onLinkPrefixA, 1800, 1800)},
+                     {Rio(routePrefix, 1800, NetworkData::kRoutePreferenceMedium)});
+
+    AdvanceTime(10);
+
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetEvaluationCounters().mIncrementalEvaluations ==
+                 counters.mIncrementalEvaluations + 1);
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetEvaluationCounters().mFullEvaluations ==
+                 counters.mFullEvaluations);
+
+    VerifyPrefixTable({OnLinkPrefix(onLinkPrefixA, 1800, 1800, routerAddressA)},
+                      {RoutePrefix(routePrefix, 1800, NetworkData::kRoutePreferenceMedium, routerAddressA)});
+
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetFavoredOnLinkPrefix() == onLinkPrefixA);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Advertise a numerically smaller on-link prefix from a new
+    // router B. Check that it is also processed by an incremental
+    // evaluation and that the favored on-link prefix is updated.
+
+    counters = sInstance->Get<BorderRouter::RxRaTracker>().GetEvaluationCounters();
+
+    SendRouterAdvert(routerAddressB, {Pio(onLinkPrefixB, 1800, 1800)});
+
+    AdvanceTime(10);
+
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetEvaluationCounters().mIncrementalEvaluations ==
+                 counters.mIncrementalEvaluations + 1);
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetEvaluationCounters().mFullEvaluations ==
+                 counters.mFullEvaluations);
+
+    VerifyPrefixTable({OnLinkPrefix(onLinkPrefixA, 1800, 1800, routerAddressA),
+                       OnLinkPrefix(onLinkPrefixB, 1800, 1800, routerAddressB)},
+                      {RoutePrefix(routePrefix, 1800, NetworkData::kRoutePreferenceMedium, routerAddressA)});
+
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetFavoredOnLinkPrefix() == onLinkPrefixB);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Keep refreshing the prefixes from routers A and B for longer
+    // than the stale time. Check that the routers and prefixes are
+    // kept and no RS is emitted.
+
+    sRsEmitted = false;
+
+    for (uint16_t count = 0; count < 10; count++)
+    {
+        AdvanceTime(100 * 1000);
+
+        SendRouterAdvert(routerAddressA, {Pio(onLinkPrefixA, 1800, 1800)},
+                         {Rio(routePrefix, 1800, NetworkData::kRoutePreferenceMedium)});
+        SendRouterAdvert(routerAddressB, {Pio(onLinkPrefixB, 1800, 1800)});
+    }
+
+    AdvanceTime(10);
+
+    VerifyOrQuit(!sRsEmitted);
+
+    VerifyPrefixTable({OnLinkPrefix(onLinkPrefixA, 1800, 1800, routerAddressA),
+                       OnLinkPrefix(onLinkPrefixB, 1800, 1800, routerAddressB)},
+                      {RoutePrefix(routePrefix, 1800, NetworkData::kRoutePreferenceMedium, routerAddressA)});
+
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetFavoredOnLinkPrefix() == onLinkPrefixB);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(false));
+    AdvanceTime(3000);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    Log("End of TestIncrementalEvaluation");
+    FinalizeTest();
+}
+
+void TestFavoredOnLinkPrefixDeprecation(void)
+{
+    Ip6::Prefix                                   onLinkPrefixA  = PrefixFromString("2000:abba:baba:bbbb::", 64);
+    Ip6::Prefix                                   onLinkPrefixB  = PrefixFromString("2000:abba:baba:aaaa::", 64);
+    Ip6::Address                                  routerAddressA = AddressFromString("fd00::aaaa");
+    Ip6::Address                                  routerAddressB = AddressFromString("fd00::bbbb");
+    Ip6::Address                                  routerAddressC = AddressFromString("fd00::cccc");
+    BorderRouter::RxRaTracker::EvaluationCounters counters;
+    uint16_t                                      heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestFavoredOnLinkPrefixDeprecation");
+
+    InitTest();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start Routing Manager.
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(true));
+
+    AdvanceTime(30000);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Router B advertises the numerically smaller on-link prefix B
+    // once, which becomes the favored on-link prefix. Router C also
+    // advertises prefix B but with a preferred lifetime too short for
+    // it to be favored. Router A advertises prefix A.
+
+    SendRouterAdvert(routerAddressA, {Pio(onLinkPrefixA, 7200, 1800)});
+    SendRouterAdvert(routerAddressB, {Pio(onLinkPrefixB, 7200, 1800)});
+    SendRouterAdvert(routerAddressC, {Pio(onLinkPrefixB, 7200, 1000)});
+
+    AdvanceTime(10);
+
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetFavoredOnLinkPrefix() == onLinkPrefixB);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Keep refreshing the prefixes from routers A and C, so that
+    // neither prefix becomes stale and only the entries of A and C
+    // are evaluated. Check that prefix B remains favored until the
+    // entry from router B gets deprecated.
+
+    sRsEmitted = false;
+
+    for (uint16_t count = 0; count < 17; count++)
+    {
+        AdvanceTime(100 * 1000);
+
+        SendRouterAdvert(routerAddressA, {Pio(onLinkPrefixA, 7200, 1800)});
+        SendRouterAdvert(routerAddressC, {Pio(onLinkPrefixB, 7200, 1000)});
+    }
+
+    AdvanceTime(90 * 1000);
+
+    VerifyOrQuit(!sRsEmitted);
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetFavoredOnLinkPrefix() == onLinkPrefixB);
+
+    counters = sInstance->Get<BorderRouter::RxRaTracker>().GetEvaluationCounters();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Check that the deprecation of the entry from router B triggers
+    // a full evaluation (without any new RA) and that prefix A is now
+    // the favored on-link prefix.
+
+    AdvanceTime(20 * 1000);
+
+    VerifyOrQuit(!sRsEmitted);
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetEvaluationCounters().mFullEvaluations >
+                 counters.mFullEvaluations);
+    VerifyOrQuit(sInstance->Get<BorderRouter::RxRaTracker>().GetFavoredOnLinkPrefix() == onLinkPrefixA);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(false));
+    AdvanceTime(3000);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    Log("End of TestFavoredOnLinkPrefixDeprecation");
+    FinalizeTest();
+}
+
 void TestRouterNsProbe(void)
 {
     Ip6::Prefix  localOnLink;
@@ -5439,6 +5640,8 @@ int main(void)
     ot::TestExtPanIdChange();
     ot::TestConflictingPrefix();
     ot::TestPrefixStaleTime();
+    ot::TestIncrementalEvaluation();
+    ot::TestFavoredOnLinkPrefixDeprecation();
     ot::TestRouterNsProbe();
     ot::TestLearningAndCopyingOfFlags();
     ot::TestLearnRaHeader();
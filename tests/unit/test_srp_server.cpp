@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
 #include <openthread/config.h>
 
 #include "test_platform.h"
@@ -834,6 +836,389 @@ void TestSrpServerClientRemove(bool aShouldRemoveKeyLease)
     Log("End of TestSrpServerClientRemove");
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+
+void TestSrpServerLeaseExpire(void)
+{
+    static constexpr uint32_t kLease    = 40;
+    static constexpr uint32_t kKeyLease = 90;
+
+    Srp::Server                      *srpServer;
+    Srp::Client                      *srpClient;
+    Srp::Client::Service              service1;
+    Srp::Client::Service              service2;
+    const Srp::Server::Host          *host;
+    const Srp::Server::LeaseCounters *counters;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerLeaseExpire");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    srpServer->SetEnabled(true);
+
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP client with short lease and key lease intervals.
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->SetLeaseInterval(kLease);
+    srpClient->SetKeyLeaseInterval(kKeyLease);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register two services and validate the granted leases.
+
+    SuccessOrQuit(srpClient->AddService(service1));
+    SuccessOrQuit(srpClient->AddService(service2));
+
+    sUpdateHandlerMode       = kAccept;
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+    VerifyOrQuit(service2.GetState() == Srp::Client::kRegistered);
+    ValidateHost(*srpServer, kHostName);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host->GetLease() == kLease);
+    VerifyOrQuit(host->GetKeyLease() == kKeyLease);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Stop the client so that it does not refresh its registration.
+
+    srpClient->DisableAutoStartMode();
+    srpClient->Stop();
+
+    srpServer->ResetLeaseCounters();
+    counters = &srpServer->GetLeaseCounters();
+    VerifyOrQuit(counters->mTimerFires == 0);
+    VerifyOrQuit(counters->mExpirations == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Wait for the lease to expire. Validate that the host and its
+    // services are marked as deleted but their names are retained.
+
+    AdvanceTime(kLease * 1000);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(host->IsDeleted());
+    VerifyOrQuit(host->GetServices().GetHead() != nullptr);
+
+    for (const Srp::Server::Service &service : host->GetServices())
+    {
+        VerifyOrQuit(service.IsDeleted());
+    }
+
+    VerifyOrQuit(counters->mTimerFires == 1);
+    VerifyOrQuit(counters->mHostsProcessed == 1);
+    VerifyOrQuit(counters->mExpirations == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Wait for the key lease to expire. Validate that the host is
+    // fully removed.
+
+    AdvanceTime((kKeyLease - kLease) * 1000);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    VerifyOrQuit(counters->mTimerFires == 2);
+    VerifyOrQuit(counters->mHostsProcessed == 2);
+    VerifyOrQuit(counters->mExpirations == 2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerLeaseExpire");
+}
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint16_t CountSavedSrpServerHosts(void)
+{
+    uint16_t count = 0;
+
+    while (otPlatSettingsGet(sInstance, OT_SETTINGS_KEY_SRP_SERVER_HOSTS, count, nullptr, nullptr) == OT_ERROR_NONE)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void RestartInstance(void)
+{
+    // Simulates a restart of the device. The settings are kept and
+    // `TimerMilli` starts again from zero.
+
+    Log("Restarting OT instance");
+
+    // Stop the SRP server without disabling it (so its saved hosts
+    // are kept) to free its hosts before the instance is reset.
+
+    sInstance->Get<NetworkData::Publisher>().UnpublishDnsSrpService();
+    AdvanceTime(100);
+    VerifyOrQuit(sInstance->Get<Srp::Server>().GetState() == Srp::Server::kStateStopped);
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, false));
+    SuccessOrQuit(otThreadSetEnabled(sInstance, false));
+
+    sNow     = 0;
+    sAlarmOn = false;
+
+    sInstance = testResetInstance(sInstance);
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true));
+    SuccessOrQuit(otThreadSetEnabled(sInstance, true));
+
+    AdvanceTime(10000);
+    VerifyOrQuit(otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_LEADER);
+}
+
+void StartSrpServerAndRegisterServices(Srp::Client::Service &aService1,
+                                       Srp::Client::Service &aService2,
+                                       uint32_t              aLease,
+                                       uint32_t              aKeyLease)
+{
+    Srp::Server *srpServer = &sInstance->Get<Srp::Server>();
+    Srp::Client *srpClient = &sInstance->Get<Srp::Client>();
+
+    PrepareService1(aService1);
+    PrepareService2(aService2);
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    srpServer->SetEnabled(true);
+
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->SetLeaseInterval(aLease);
+    srpClient->SetKeyLeaseInterval(aKeyLease);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    SuccessOrQuit(srpClient->AddService(aService1));
+    SuccessOrQuit(srpClient->AddService(aService2));
+
+    sUpdateHandlerMode       = kAccept;
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    VerifyOrQuit(aService1.GetState() == Srp::Client::kRegistered);
+    VerifyOrQuit(aService2.GetState() == Srp::Client::kRegistered);
+    ValidateHost(*srpServer, kHostName);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Stop the client so that it does not register again and wait
+    // for the server to save its hosts.
+
+    srpClient->DisableAutoStartMode();
+    srpClient->Stop();
+
+    AdvanceTime(10 * 1000);
+    VerifyOrQuit(CountSavedSrpServerHosts() == 1);
+}
+
+void TestSrpServerPersistence(void)
+{
+    static constexpr uint32_t kLease    = 300;
+    static constexpr uint32_t kKeyLease = 600;
+
+    Srp::Server                *srpServer;
+    Srp::Client::Service        service1;
+    Srp::Client::Service        service2;
+    const Srp::Server::Host    *host;
+    const Srp::Server::Service *service;
+    Srp::Server::Host::Key      key;
+    Srp::Server::LeaseInfo      leaseInfo;
+    uint16_t                    numServices;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerPersistence");
+
+    InitTest();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client, and register two services.
+
+    StartSrpServerAndRegisterServices(service1, service2, kLease, kKeyLease);
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    key       = srpServer->GetNextHost(nullptr)->GetKey();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Restart the instance and enable the server. Validate the
+    // restored host and services and their leases, which continue
+    // from the remaining lease when the host was saved.
+
+    RestartInstance();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    ValidateHost(*srpServer, kHostName);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(!host->IsDeleted());
+    VerifyOrQuit(host->GetKey() == key);
+    VerifyOrQuit(host->GetLease() == kLease);
+    VerifyOrQuit(host->GetKeyLease() == kKeyLease);
+
+    host->GetLeaseInfo(leaseInfo);
+    VerifyOrQuit(leaseInfo.mRemainingLease < Time::SecToMsec(kLease));
+    VerifyOrQuit(leaseInfo.mRemainingLease > Time::SecToMsec(kLease) - 60 * 1000);
+
+    numServices = 0;
+    service     = nullptr;
+
+    while ((service = host->GetNextService(service)) != nullptr)
+    {
+        VerifyOrQuit(!service->IsDeleted());
+        VerifyOrQuit(service->GetLease() == kLease);
+
+        if (service->GetPort() == service1.GetPort())
+        {
+            VerifyOrQuit(service->GetNumberOfSubTypes() == 3);
+            VerifyOrQuit(service->GetWeight() == service1.GetWeight());
+            VerifyOrQuit(service->GetPriority() == service1.GetPriority());
+            VerifyOrQuit(service->GetTxtDataLength() > 0);
+        }
+        else
+        {
+            VerifyOrQuit(service->GetPort() == service2.GetPort());
+            VerifyOrQuit(service->GetNumberOfSubTypes() == 1);
+            VerifyOrQuit(service->GetPriority() == service2.GetPriority());
+        }
+
+        numServices++;
+    }
+
+    VerifyOrQuit(numServices == 2);
+
+    // The restored host is not changed, so its saved entry is kept.
+
+    AdvanceTime(10 * 1000);
+    VerifyOrQuit(CountSavedSrpServerHosts() == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable the server on purpose and validate that the saved
+    // hosts are cleared and the host is not restored when the
+    // server is enabled again.
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+    VerifyOrQuit(CountSavedSrpServerHosts() == 0);
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register the services again and restart the instance. Validate
+    // that the restored host expires once its remaining lease and
+    // key lease pass, and that its saved entry is then deleted.
+
+    StartSrpServerAndRegisterServices(service1, service2, kLease, kKeyLease);
+
+    RestartInstance();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(!host->IsDeleted());
+
+    AdvanceTime(Time::SecToMsec(kLease));
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(host->IsDeleted());
+
+    AdvanceTime(Time::SecToMsec(kKeyLease - kLease));
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    AdvanceTime(10 * 1000);
+    VerifyOrQuit(CountSavedSrpServerHosts() == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerPersistence");
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
 void TestUpdateLeaseShortVariant(void)
 {
@@ -1610,6 +1995,379 @@ void TestSrpServerFastStartMode(void)
 
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
 
+void TestSrpServerUpdateRate(void)
+{
+    static constexpr uint16_t kNumUpdates = 100;
+
+    Srp::Server         *srpServer;
+    Srp::Client         *srpClient;
+    Srp::Client::Service service1;
+    Srp::Client::Service service2;
+    uint16_t             heapAllocations;
+    uint64_t             usec = 0;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerUpdateRate");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client, register a service.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    srpServer->SetEnabled(true);
+
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    SuccessOrQuit(srpClient->AddService(service1));
+
+    sUpdateHandlerMode = kAccept;
+
+    AdvanceTime(2 * 1000);
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Alternately add and remove the second service. Each change is
+    // sent as a signed SRP update which the server verifies and
+    // commits. Measure the time it takes to process the updates.
+
+    for (uint16_t count = 0; count < kNumUpdates; count++)
+    {
+        bool shouldAdd = ((count % 2) == 0);
+
+        if (shouldAdd)
+        {
+            SuccessOrQuit(srpClient->AddService(service2));
+        }
+        else
+        {
+            SuccessOrQuit(srpClient->RemoveService(service2));
+        }
+
+        sProcessedUpdateCallback = false;
+        sProcessedClientCallback = false;
+
+        {
+            auto start = std::chrono::steady_clock::now();
+
+            AdvanceTime(2 * 1000);
+
+            auto end = std::chrono::steady_clock::now();
+
+            usec += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        }
+
+        VerifyOrQuit(sProcessedUpdateCallback);
+        VerifyOrQuit(sProcessedClientCallback);
+        VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+        VerifyOrQuit(service2.GetState() == (shouldAdd ? Srp::Client::kRegistered : Srp::Client::kRemoved));
+    }
+
+    printf("%u SRP updates (client sign + server verify and commit) processed in %llu usec (%llu updates/sec)\n",
+           kNumUpdates, static_cast<unsigned long long>(usec),
+           static_cast<unsigned long long>((usec == 0) ? 0 : (kNumUpdates * 1000000ull) / usec));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerUpdateRate");
+}
+
+class UnitTester
+{
+public:
+    static void TestSrpServerNameLookupBenchmark(void)
+    {
+        // Commits `kNumHosts` hosts, each with `kNumServicesPerHost`
+        // services, directly on the SRP server and measures the time
+        // to look up hosts, service instances, and service types, and
+        // to check a new host for name conflicts.
+
+        static constexpr uint16_t kNumLookups = 10000;
+
+        Srp::Server       *srpServer;
+        Srp::Server::Host *newHost;
+        Dns::Name::Buffer  name;
+        Dns::Name::Buffer  serviceName;
+        uint16_t           heapAllocations;
+        uint64_t           usec;
+
+        Log("--------------------------------------------------------------------------------------------");
+        Log("TestSrpServerNameLookupBenchmark");
+
+        InitTest();
+
+        srpServer       = &sInstance->Get<Srp::Server>();
+        heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+        for (uint16_t hostIndex = 0; hostIndex < kNumHosts; hostIndex++)
+        {
+            Srp::Server::Host *host = AllocateHost(hostIndex, hostIndex, hostIndex);
+
+            VerifyOrQuit(srpServer->FindHost(*host) == nullptr);
+            srpServer->AddCommittedHost(*host);
+        }
+
+        // Host name lookups
+
+        usec = 0;
+
+        for (uint16_t count = 0; count < kNumLookups; count++)
+        {
+            uint16_t                 hostIndex = (count * 7919) % kNumHosts;
+            const Srp::Server::Host *host      = nullptr;
+
+            GetHostName(hostIndex, name);
+
+            {
+                auto     start = std::chrono::steady_clock::now();
+                uint32_t hash  = Dns::Name::CalculateHash(name);
+
+                while ((host = srpServer->mHostNameTable.FindNext(hash, host)) != nullptr)
+                {
+                    if (host->Matches(name))
+                    {
+                        break;
+                    }
+                }
+
+                auto end = std::chrono::steady_clock::now();
+
+                usec += static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+            }
+
+            VerifyOrQuit(host != nullptr);
+        }
+
+        PrintResult("host name lookups", kNumLookups, usec);
+
+        // Service instance name lookups
+
+        usec = 0;
+
+        for (uint16_t count = 0; count < kNumLookups; count++)
+        {
+            uint16_t                    hostIndex    = (count * 7919) % kNumHosts;
+            uint16_t                    serviceIndex = count % kNumServicesPerHost;
+            const Srp::Server::Service *service      = nullptr;
+
+            GetInstanceName(hostIndex, serviceIndex, name);
+
+            {
+                auto     start = std::chrono::steady_clock::now();
+                uint32_t hash  = Dns::Name::CalculateHash(name);
+
+                while ((service = srpServer->mInstanceNameTable.FindNext(hash, service)) != nullptr)
+                {
+                    if (service->MatchesInstanceName(name))
+                    {
+                        break;
+                    }
+                }
+
+                auto end = std::chrono::steady_clock::now();
+
+                usec += static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+            }
+
+            VerifyOrQuit(service != nullptr);
+            VerifyOrQuit(service->GetHost().GetKey().m8[0] == static_cast<uint8_t>(hostIndex >> 8));
+            VerifyOrQuit(service->GetHost().GetKey().m8[1] == static_cast<uint8_t>(hostIndex & 0xff));
+        }
+
+        PrintResult("service instance name lookups", kNumLookups, usec);
+
+        // Service type (PTR) lookups
+
+        usec = 0;
+
+        for (uint16_t count = 0; count < kNumLookups; count++)
+        {
+            uint16_t                    hostIndex    = (count * 7919) % kNumHosts;
+            uint16_t                    serviceIndex = count % kNumServicesPerHost;
+            const Srp::Server::Service *service      = nullptr;
+            uint16_t                    numMatches   = 0;
+
+            GetServiceName(hostIndex, serviceIndex, serviceName);
+
+            {
+                auto     start = std::chrono::steady_clock::now();
+                uint32_t hash  = Dns::Name::CalculateHash(serviceName);
+
+                while ((service = srpServer->mServiceNameTable.FindNext(hash, service)) != nullptr)
+                {
+                    if (service->MatchesServiceName(serviceName))
+                    {
+                        numMatches++;
+                    }
+                }
+
+                auto end = std::chrono::steady_clock::now();
+
+                usec += static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+            }
+
+            VerifyOrQuit(numMatches == kNumHosts * kNumServicesPerHost / kNumServiceTypes);
+        }
+
+        PrintResult("service type lookups", kNumLookups, usec);
+
+        // Name conflict checks of a new host (using a different key)
+        // with already allocated service instance names, and of a
+        // new host with no conflicting names.
+
+        newHost = AllocateHost(kNumHosts, kNumHosts / 2, kNumHosts);
+
+        {
+            auto start = std::chrono::steady_clock::now();
+
+            for (uint16_t count = 0; count < kNumLookups; count++)
+            {
+                VerifyOrQuit(srpServer->HasNameConflictsWith(*newHost));
+            }
+
+            auto end = std::chrono::steady_clock::now();
+
+            usec = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        }
+
+        PrintResult("name conflict checks (with conflict)", kNumLookups, usec);
+        newHost->Free();
+
+        newHost = AllocateHost(kNumHosts, kNumHosts, kNumHosts);
+
+        {
+            auto start = std::chrono::steady_clock::now();
+
+            for (uint16_t count = 0; count < kNumLookups; count++)
+            {
+                VerifyOrQuit(!srpServer->HasNameConflictsWith(*newHost));
+            }
+
+            auto end = std::chrono::steady_clock::now();
+
+            usec = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        }
+
+        PrintResult("name conflict checks (no conflict)", kNumLookups, usec);
+        newHost->Free();
+
+        // Remove all hosts and verify that all heap allocations
+        // are freed.
+
+        while (!srpServer->mHosts.IsEmpty())
+        {
+            Srp::Server::Host *host = srpServer->mHosts.GetHead();
+
+            srpServer->RemoveCommittedHost(*host);
+            host->Free();
+        }
+
+        srpServer->mHostNameTable.Clear();
+        srpServer->mInstanceNameTable.Clear();
+        srpServer->mServiceNameTable.Clear();
+
+        VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+        Log("Finalizing OT instance");
+        FinalizeTest();
+
+        VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+        Log("End of TestSrpServerNameLookupBenchmark");
+    }
+
+private:
+    static constexpr uint16_t kNumHosts           = 2000;
+    static constexpr uint16_t kNumServicesPerHost = 3;
+    static constexpr uint16_t kNumServiceTypes    = 40;
+
+    static void GetHostName(uint16_t aHostIndex, Dns::Name::Buffer &aName)
+    {
+        snprintf(aName, sizeof(aName), "host%04u.default.service.arpa.", aHostIndex);
+    }
+
+    static void GetServiceName(uint16_t aHostIndex, uint16_t aServiceIndex, Dns::Name::Buffer &aName)
+    {
+        snprintf(aName, sizeof(aName), "_type%02u._udp.default.service.arpa.",
+                 (aHostIndex * 3 + aServiceIndex) % kNumServiceTypes);
+    }
+
+    static void GetInstanceName(uint16_t aHostIndex, uint16_t aServiceIndex, Dns::Name::Buffer &aName)
+    {
+        snprintf(aName, sizeof(aName), "inst%04u-%u._type%02u._udp.default.service.arpa.", aHostIndex, aServiceIndex,
+                 (aHostIndex * 3 + aServiceIndex) % kNumServiceTypes);
+    }
+
+    static Srp::Server::Host *AllocateHost(uint16_t aHostIndex, uint16_t aServiceHostIndex, uint16_t aKeyIndex)
+    {
+        Srp::Server::Host *host = Srp::Server::Host::Allocate(*sInstance, TimerMilli::GetNow());
+        Dns::Name::Buffer  name;
+
+        VerifyOrQuit(host != nullptr);
+
+        GetHostName(aHostIndex, name);
+        SuccessOrQuit(host->SetFullName(name));
+
+        host->mKey.m8[0] = static_cast<uint8_t>(aKeyIndex >> 8);
+        host->mKey.m8[1] = static_cast<uint8_t>(aKeyIndex & 0xff);
+
+        for (uint16_t serviceIndex = 0; serviceIndex < kNumServicesPerHost; serviceIndex++)
+        {
+            Srp::Server::Service *service;
+            Dns::Name::Buffer     serviceName;
+
+            GetInstanceName(aServiceHostIndex, serviceIndex, name);
+            GetServiceName(aServiceHostIndex, serviceIndex, serviceName);
+
+            service = host->AddNewService(name, name, TimerMilli::GetNow());
+            VerifyOrQuit(service != nullptr);
+            SuccessOrQuit(service->SetServiceName(serviceName));
+        }
+
+        return host;
+    }
+
+    static void PrintResult(const char *aAction, uint16_t aNumLookups, uint64_t aUsec)
+    {
+        printf("SRP server with %u hosts x %u services: %u %s in %llu usec (%llu per sec)\n", kNumHosts,
+               kNumServicesPerHost, aNumLookups, aAction, static_cast<unsigned long long>(aUsec),
+               static_cast<unsigned long long>((aUsec == 0) ? 0 : (aNumLookups * 1000000ull) / aUsec));
+    }
+};
+
 #endif // ENABLE_SRP_TEST
 
 } // namespace ot
@@ -1622,6 +2380,10 @@ int main(void)
     ot::TestSrpServerIgnore();
     ot::TestSrpServerClientRemove(/* aShouldRemoveKeyLease */ true);
     ot::TestSrpServerClientRemove(/* aShouldRemoveKeyLease */ false);
+    ot::TestSrpServerLeaseExpire();
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    ot::TestSrpServerPersistence();
+#endif
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     ot::TestUpdateLeaseShortVariant();
     ot::TestSrpClientDelayedResponse();
@@ -1631,6 +2393,8 @@ int main(void)
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     ot::TestSrpServerFastStartMode();
 #endif
+    ot::TestSrpServerUpdateRate();
+    ot::UnitTester::TestSrpServerNameLookupBenchmark();
 
     printf("All tests passed\n");
 #else
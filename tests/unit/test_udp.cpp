@@ -0,0 +1,241 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "instance/instance.hpp"
+#include "net/udp6.hpp"
+
+namespace ot {
+namespace Ip6 {
+
+#define Log(...) printf(OT_FIRST_ARG(__VA_ARGS__) "\n" OT_REST_ARGS(__VA_ARGS__))
+
+static Instance *sInstance;
+
+struct ReceiveContext
+{
+    void Clear(void) { mNumReceived = 0; }
+
+    uint16_t mNumReceived;
+};
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    static_cast<ReceiveContext *>(aContext)->mNumReceived++;
+}
+
+static void ReceiveDatagram(uint16_t aSockPort, const Address &aPeerAddr, uint16_t aPeerPort)
+{
+    static const uint8_t kPayload[] = {0x01, 0x02, 0x03, 0x04};
+
+    Message    *message = sInstance->Get<Ip6>().NewMessage();
+    MessageInfo messageInfo;
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->AppendBytes(kPayload, sizeof(kPayload)));
+
+    messageInfo.SetPeerAddr(aPeerAddr);
+    messageInfo.SetPeerPort(aPeerPort);
+    messageInfo.SetSockPort(aSockPort);
+
+    sInstance->Get<Udp>().HandlePayload(*message, messageInfo);
+    message->Free();
+}
+
+void TestUdpSocketDemux(void)
+{
+    static constexpr uint16_t kNumSockets = 64;
+    static constexpr uint16_t kBasePort   = 20000;
+    static constexpr uint16_t kPort       = 1234;
+    static constexpr uint16_t kPeerPort   = 5678;
+
+    Address        peerAddr;
+    ReceiveContext contexts[kNumSockets];
+    ReceiveContext contextA;
+    ReceiveContext contextB;
+    ReceiveContext contextC;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestUdpSocketDemux");
+
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    SuccessOrQuit(peerAddr.FromString("fd00::1234"));
+
+    {
+        // Datagrams are delivered to the socket bound to the
+        // destination port only.
+
+        Udp::Socket *sockets[kNumSockets];
+
+        for (uint16_t index = 0; index < kNumSockets; index++)
+        {
+            contexts[index].Clear();
+            sockets[index] = new Udp::Socket(*sInstance, HandleUdpReceive, &contexts[index]);
+            SuccessOrQuit(sockets[index]->Open(kNetifThreadInternal));
+            SuccessOrQuit(sockets[index]->Bind(kBasePort + index));
+            VerifyOrQuit(sInstance->Get<Udp>().IsPortInUse(kBasePort + index));
+        }
+
+        for (uint16_t index = 0; index < kNumSockets; index++)
+        {
+            ReceiveDatagram(kBasePort + index, peerAddr, kPeerPort);
+        }
+
+        ReceiveDatagram(kBasePort + kNumSockets, peerAddr, kPeerPort);
+
+        for (const ReceiveContext &context : contexts)
+        {
+            VerifyOrQuit(context.mNumReceived == 1);
+        }
+
+        for (Udp::Socket *socket : sockets)
+        {
+            SuccessOrQuit(socket->Close());
+            delete socket;
+        }
+
+        for (uint16_t index = 0; index < kNumSockets; index++)
+        {
+            VerifyOrQuit(!sInstance->Get<Udp>().IsPortInUse(kBasePort + index));
+        }
+    }
+
+    {
+        // The most recently opened matching socket receives the
+        // datagram, independent of the order the sockets are bound
+        // in. A connected socket only matches its peer.
+
+        Udp::Socket socketA(*sInstance, HandleUdpReceive, &contextA);
+        Udp::Socket socketB(*sInstance, HandleUdpReceive, &contextB);
+        Udp::Socket socketC(*sInstance, HandleUdpReceive, &contextC);
+
+        contextA.Clear();
+        contextB.Clear();
+        contextC.Clear();
+
+        SuccessOrQuit(socketA.Open(kNetifThreadInternal));
+        SuccessOrQuit(socketB.Open(kNetifThreadInternal));
+        SuccessOrQuit(socketC.Open(kNetifThreadInternal));
+
+        SuccessOrQuit(socketB.Bind(kPort));
+        SuccessOrQuit(socketA.Bind(kPort));
+        SuccessOrQuit(socketC.Bind(kPort));
+        SuccessOrQuit(socketC.Connect(SockAddr(peerAddr, kPeerPort)));
+
+        ReceiveDatagram(kPort, peerAddr, kPeerPort);
+        VerifyOrQuit(contextC.mNumReceived == 1);
+
+        ReceiveDatagram(kPort, peerAddr, kPeerPort + 1);
+        VerifyOrQuit(contextB.mNumReceived == 1);
+        VerifyOrQuit(contextA.mNumReceived == 0);
+
+        // Re-binding a socket keeps its precedence.
+
+        SuccessOrQuit(socketB.Bind(kPort + 1));
+        ReceiveDatagram(kPort, peerAddr, kPeerPort + 1);
+        VerifyOrQuit(contextA.mNumReceived == 1);
+
+        SuccessOrQuit(socketB.Bind(kPort));
+        ReceiveDatagram(kPort, peerAddr, kPeerPort + 1);
+        VerifyOrQuit(contextB.mNumReceived == 2);
+
+        SuccessOrQuit(socketB.Close());
+        ReceiveDatagram(kPort, peerAddr, kPeerPort + 1);
+        VerifyOrQuit(contextA.mNumReceived == 2);
+
+        SuccessOrQuit(socketC.Close());
+        ReceiveDatagram(kPort, peerAddr, kPeerPort);
+        VerifyOrQuit(contextA.mNumReceived == 3);
+        VerifyOrQuit(contextC.mNumReceived == 1);
+
+        SuccessOrQuit(socketA.Close());
+        VerifyOrQuit(!sInstance->Get<Udp>().IsPortInUse(kPort));
+    }
+
+    Log("End of TestUdpSocketDemux");
+
+    testFreeInstance(sInstance);
+}
+
+void TestUdpEphemeralPort(void)
+{
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestUdpEphemeralPort");
+
+    sInstance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != nullptr);
+
+    {
+        // An ephemeral port already used by an open socket is skipped.
+
+        Udp::Socket socketA(*sInstance, HandleUdpReceive, nullptr);
+        Udp::Socket socketB(*sInstance, HandleUdpReceive, nullptr);
+        Udp::Socket socketC(*sInstance, HandleUdpReceive, nullptr);
+        uint16_t    port;
+
+        SuccessOrQuit(socketA.Open(kNetifThreadInternal));
+        SuccessOrQuit(socketA.Bind(0));
+        port = socketA.GetSockName().GetPort();
+        VerifyOrQuit(port != 0);
+
+        SuccessOrQuit(socketB.Open(kNetifThreadInternal));
+        SuccessOrQuit(socketB.Bind(port + 1));
+
+        SuccessOrQuit(socketC.Open(kNetifThreadInternal));
+        SuccessOrQuit(socketC.Bind(0));
+        VerifyOrQuit(socketC.GetSockName().GetPort() == port + 2);
+
+        SuccessOrQuit(socketA.Close());
+        SuccessOrQuit(socketB.Close());
+        SuccessOrQuit(socketC.Close());
+    }
+
+    Log("End of TestUdpEphemeralPort");
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace Ip6
+} // namespace ot
+
+int main(void)
+{
+    ot::Ip6::TestUdpSocketDemux();
+    ot::Ip6::TestUdpEphemeralPort();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -51,7 +51,22 @@
 #define FRAMES_PER_SEG 5
 #define FRAMECAP_6LOWPAN (122 - 11 - 5)
 #define IP6HDR_SIZE (2 + 1 + 1 + 16 + 16) // IPHC header (2) + Next header (1) + Hop count (1) + Dest. addr (16) + Src. addr (16)
-#define MSS_6LOWPAN ((FRAMES_PER_SEG * FRAMECAP_6LOWPAN) - IP6HDR_SIZE - sizeof(struct tcphdr))
+
+/*
+ * The MSS is chosen so that a full-sized segment is sent in exactly
+ * FRAMES_PER_SEG 802.15.4 frames after 6LoWPAN compression and
+ * fragmentation. The first fragment carries a FRAG1 header and the
+ * compressed IPv6 header (at most IP6HDR_SIZE bytes), each of the next
+ * fragments a FRAGN header. The payload of all but the last fragment
+ * is a multiple of 8 bytes of the uncompressed datagram.
+ */
+#define FRAG1HDR_SIZE 4
+#define FRAGNHDR_SIZE 5
+#define FRAG_ROUND_DOWN(len) ((len) & ~0x7)
+#define DATAGRAM_SIZE_6LOWPAN (sizeof(struct ip6_hdr) + \
+	FRAG_ROUND_DOWN(FRAMECAP_6LOWPAN - FRAG1HDR_SIZE - IP6HDR_SIZE) + \
+	(FRAMES_PER_SEG - 1) * FRAG_ROUND_DOWN(FRAMECAP_6LOWPAN - FRAGNHDR_SIZE))
+#define MSS_6LOWPAN (DATAGRAM_SIZE_6LOWPAN - sizeof(struct ip6_hdr) - sizeof(struct tcphdr))
 
 /*
  * samkumar: The remaining constants were present in the original FreeBSD code,
@@ -75,8 +90,11 @@ enum tcp_input_consts {
 	V_tcp_abc_l_var = 2 // this is what was in the original tcp_input.c
 };
 
+/*
+ * The delayed ACK timeout is not a constant here; it is obtained from the host
+ * using tcplp_sys_get_delack_time().
+ */
 enum tcp_subr_consts {
-	tcp_delacktime = TCPTV_DELACK,
 	tcp_keepinit = TCPTV_KEEP_INIT,
 	tcp_keepidle = TCPTV_KEEP_IDLE,
 	tcp_keepintvl = TCPTV_KEEPINTVL,
@@ -306,19 +306,43 @@ cc_post_recovery(struct tcpcb *tp, struct tcphdr *th)
 /*
  * Indicate whether this ack should be delayed.  We can delay the ack if
  * following conditions are met:
- *	- There is no delayed ack timer in progress.
+ *	- Fewer than the ACK thinning number of segments have been received
+ *	  since we last sent an ACK.
  *	- Our last ack wasn't a 0-sized window. We never want to delay
  *	  the ack that opens up a 0-sized window.
  *	- LRO wasn't used for this segment. We make sure by checking that the
  *	  segment size is not larger than the MSS.
  *	- Delayed acks are enabled or this is a half-synchronized T/TCP
  *	  connection.
+ *
+ * The original macro only delayed the ack if no delayed ack timer
+ * was in progress, i.e., it acknowledged every second segment. On
+ * half-duplex radio links every ACK competes with data segments for the
+ * channel, so the host may ask for ACKs to be sent for every N segments
+ * (tcplp_sys_get_ack_thinning()). N = 2 gives the original behavior. The
+ * delayed ack timer still bounds how long an ACK is held back.
  */
-#define DELAY_ACK(tp, tlen)						\
-	((!tcp_timer_active(tp, TT_DELACK) &&				\
-	    (tp->t_flags & TF_RXWIN0SENT) == 0) &&			\
-	    (tlen <= tp->t_maxopd) &&					\
-	    (V_tcp_delack_enabled || (tp->t_flags & TF_NEEDSYN)))
+static inline int
+delay_ack(struct tcpcb *tp, int tlen)
+{
+	if ((tp->t_flags & TF_RXWIN0SENT) != 0 || tlen > tp->t_maxopd)
+		return (0);
+	/*
+	 * A zero delayed ACK timeout means that ACKs are never delayed, even
+	 * for a half-synchronized connection; arming the timer with zero
+	 * would stop it and the ACK would not be sent.
+	 */
+	if (tcplp_sys_get_delack_time(tp->instance) == 0)
+		return (0);
+	if (!V_tcp_delack_enabled && !(tp->t_flags & TF_NEEDSYN))
+		return (0);
+	if (tp->t_segs_unacked + 1 >= tcplp_sys_get_ack_thinning(tp->instance))
+		return (0);
+	tp->t_segs_unacked++;
+	return (1);
+}
+
+#define DELAY_ACK(tp, tlen) delay_ack(tp, tlen)
 
 static inline void
 cc_ecnpkt_handler(struct tcpcb *tp, struct tcphdr *th, uint8_t iptos)
@@ -351,7 +375,7 @@ cc_ecnpkt_handler(struct tcpcb *tp, struct tcphdr *th, uint8_t iptos)
 		CC_ALGO(tp)->ecnpkt_handler(tp->ccv);
 
 		if (tp->ccv->flags & CCF_ACKNOW)
-			tcp_timer_activate(tp, TT_DELACK, tcp_delacktime);
+			tcp_timer_activate(tp, TT_DELACK, tcplp_sys_get_delack_time(tp->instance));
 	}
 }
 
@@ -927,7 +951,8 @@ tcplp_input(struct ip6_hdr* ip6, struct tcphdr* th, otMessage* msg, struct tcpcb
 				tp->t_flags |= TF_SIGNATURE;
 	#endif
 #endif
-			if (/*sc->sc_flags & SCF_SACK*/ to.to_flags & TOF_SACKPERM)
+			if (/*sc->sc_flags & SCF_SACK*/ (to.to_flags & TOF_SACKPERM) &&
+			    tcplp_sys_sack_enabled(tp->instance))
 				tp->t_flags |= TF_SACK_PERMIT;
 		}
 		if (/*sc->sc_flags & SCF_ECN*/(th->th_flags & (TH_ECE|TH_CWR)) && V_tcp_do_ecn)
@@ -1586,7 +1611,7 @@ tcp_do_segment(struct ip6_hdr* ip6, struct tcphdr *th, otMessage* msg,
 			 */
 			if (DELAY_ACK(tp, tlen) && tlen != 0 && !tfo_partial_ack)
 				tcp_timer_activate(tp, TT_DELACK,
-				    tcp_delacktime);
+				    tcplp_sys_get_delack_time(tp->instance));
 			else
 				tp->t_flags |= TF_ACKNOW;
 
@@ -2726,7 +2751,21 @@ step6:
 check_delack:
 	if (tp->t_flags & TF_DELACK) {
 		tp->t_flags &= ~TF_DELACK;
-		tcp_timer_activate(tp, TT_DELACK, tcp_delacktime);
+		/*
+		 * With ACK thinning, several segments may be delayed;
+		 * only the first one arms the timer, so that it bounds the delay
+		 * of the oldest unacknowledged segment.
+		 *
+		 * TF_DELACK is also set without DELAY_ACK (e.g., for a
+		 * FIN on a half-synchronized connection). If the delayed ACK
+		 * timeout is zero, send the ACK now instead.
+		 */
+		if (tcplp_sys_get_delack_time(tp->instance) == 0) {
+			tp->t_flags |= TF_ACKNOW;
+			(void) tcplp_output(tp);
+		} else if (!tcp_timer_active(tp, TT_DELACK))
+			tcp_timer_activate(tp, TT_DELACK,
+			    tcplp_sys_get_delack_time(tp->instance));
 	}
 	return;
 
@@ -123,7 +123,7 @@ void initialize_tcb(struct tcpcb* tp) {
 
 	if (V_tcp_do_rfc1323)
 		tp->t_flags = (TF_REQ_SCALE|TF_REQ_TSTMP);
-	if (V_tcp_do_sack)
+	if (V_tcp_do_sack && tcplp_sys_sack_enabled(tp->instance))
 		tp->t_flags |= TF_SACK_PERMIT;
 	TAILQ_INIT(&tp->snd_holes);
 
@@ -394,7 +394,12 @@ tcp_maxmtu6(struct tcpcb* tp, struct tcp_ifcap *cap)
 
 	KASSERT (tp != NULL, ("tcp_maxmtu6 with NULL tcpcb pointer"));
 	if (!IN6_IS_ADDR_UNSPECIFIED(&tp->faddr)) {
-		maxmtu = FRAMES_PER_SEG * FRAMECAP_6LOWPAN;
+		/*
+		 * The callers subtract IP6HDR_SIZE and the TCP header size
+		 * from the returned value to get the MSS, so this gives
+		 * MSS_6LOWPAN (see tcp_const.h).
+		 */
+		maxmtu = MSS_6LOWPAN + IP6HDR_SIZE + sizeof(struct tcphdr);
 	}
 
 	return (maxmtu);
@@ -202,6 +202,12 @@ struct tcpcb {
 	/* samkumar: This field was there previously. */
 	uint8_t	t_state;		/* state of this connection */
 
+	/*
+	 * Number of in-order segments whose ACK has been delayed since we last
+	 * sent an ACK, used for ACK thinning. Placed here to fill padding.
+	 */
+	uint8_t	t_segs_unacked;
+
 	/* Pool of SACK holes (on per-connection basis, for OpenThread port). */
 	struct sackhole sackhole_pool[SACKHOLE_POOL_SIZE];
 	uint8_t sackhole_bmp[SACKHOLE_BMP_SIZE];
@@ -89,6 +89,9 @@ bool          tcplp_sys_autobind(otInstance *      aInstance,
                                  bool              aBindAddress,
                                  bool              aBindPort);
 uint32_t      tcplp_sys_generate_isn();
+bool          tcplp_sys_sack_enabled(otInstance *aInstance);
+uint32_t      tcplp_sys_get_delack_time(otInstance *aInstance);
+uint8_t       tcplp_sys_get_ack_thinning(otInstance *aInstance);
 
 #ifdef __cplusplus
 } // extern "C"